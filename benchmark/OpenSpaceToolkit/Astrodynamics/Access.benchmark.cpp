@@ -2,7 +2,11 @@
 
 #include "benchmark/benchmark.h"
 
+#include <cmath>
+#include <functional>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
@@ -21,6 +25,7 @@
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Time.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Access/FlattenedAzimuthElevationMasks.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Access/VisibilityCriterion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -30,8 +35,10 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utility/FastAtan2.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::container::Map;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
@@ -55,6 +62,8 @@ using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::Access;
 using ostk::astrodynamics::access::AccessTarget;
+using ostk::astrodynamics::access::Ephemeris;
+using ostk::astrodynamics::access::FlattenedAzimuthElevationMasks;
 using ostk::astrodynamics::access::Generator;
 using ostk::astrodynamics::access::VisibilityCriterion;
 using ostk::astrodynamics::Trajectory;
@@ -63,6 +72,7 @@ using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::SGP4;
 using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::utility::FastAtan2;
 
 static const int DEFAULT_ITERATIONS = 10;
 
@@ -173,12 +183,9 @@ static AccessTarget MakeLOSTarget()
     return AccessTarget::FromPosition(visibilityCriterion, groundStationPosition);
 }
 
-// A spread of ground stations across the globe, each with an above-the-horizon elevation criterion.
-static Array<AccessTarget> MakeElevationTargets(const Index aTargetCount)
+// A spread of ground stations across the globe, all sharing the same visibility criterion.
+static Array<AccessTarget> MakeGroundTargets(const Index aTargetCount, const VisibilityCriterion& aVisibilityCriterion)
 {
-    const VisibilityCriterion elevationCriterion =
-        VisibilityCriterion::FromElevationInterval(MathInterval::Closed(0.0, 90.0));
-
     Array<AccessTarget> targets = Array<AccessTarget>::Empty();
     targets.reserve(aTargetCount);
 
@@ -193,12 +200,59 @@ static Array<AccessTarget> MakeElevationTargets(const Index aTargetCount)
             lla.toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_), Frame::ITRF()
         );
 
-        targets.add(AccessTarget::FromPosition(elevationCriterion, position));
+        targets.add(AccessTarget::FromPosition(aVisibilityCriterion, position));
     }
 
     return targets;
 }
 
+// A spread of ground stations across the globe, each with an above-the-horizon elevation criterion.
+static Array<AccessTarget> MakeElevationTargets(const Index aTargetCount)
+{
+    return MakeGroundTargets(
+        aTargetCount, VisibilityCriterion::FromElevationInterval(MathInterval::Closed(0.0, 90.0))
+    );
+}
+
+// A spread of ground stations across the globe, each with a 10 deg minimum elevation and a 2000 km range limit.
+static Array<AccessTarget> MakeAERTargets(const Index aTargetCount)
+{
+    return MakeGroundTargets(
+        aTargetCount,
+        VisibilityCriterion::FromAERInterval(
+            MathInterval::Closed(0.0, 360.0), MathInterval::Closed(10.0, 90.0), MathInterval::Closed(0.0, 2.0e6)
+        )
+    );
+}
+
+// Terrain-like azimuth-elevation mask [deg].
+static const Map<Real, Real> REFERENCE_AZIMUTH_ELEVATION_MASK = {
+    {0.0, 5.0},
+    {45.0, 12.0},
+    {90.0, 3.0},
+    {135.0, 20.0},
+    {180.0, 8.0},
+    {225.0, 15.0},
+    {270.0, 2.0},
+    {315.0, 10.0},
+};
+
+// A spread of ground stations across the globe, each with the reference azimuth-elevation mask and a 2000 km range
+// limit.
+static Array<AccessTarget> MakeAERMaskTargets(const Index aTargetCount)
+{
+    return MakeGroundTargets(
+        aTargetCount,
+        VisibilityCriterion::FromAERMask(REFERENCE_AZIMUTH_ELEVATION_MASK, MathInterval::Closed(0.0, 2.0e6))
+    );
+}
+
+// A spread of ground stations across the globe, each with a line-of-sight criterion.
+static Array<AccessTarget> MakeLineOfSightTargets(const Index aTargetCount)
+{
+    return MakeGroundTargets(aTargetCount, VisibilityCriterion::FromLineOfSight(REFERENCE_ENVIRONMENT));
+}
+
 // Scenario 1: tabulated model with ITRF output frame, one target, two-week window. The target is in ITRF, so no
 // per-step frame transform is required.
 static void benchmarkTabulatedItrf1Target2Weeks(benchmark::State& state)
@@ -247,6 +301,162 @@ static void benchmarkTabulatedItrf100Targets1Week(benchmark::State& state)
     }
 }
 
+// Scenario 4: a constellation of 10 sun-synchronous satellites (spread in LTAN) against 50 elevation targets over one
+// day. The sampling grid, target geometry and per-instant frame transforms are shared across the satellites.
+static void benchmarkConstellation10Satellites50Targets1Day(benchmark::State& state)
+{
+    static const Array<Trajectory> trajectories = []() -> Array<Trajectory>
+    {
+        Array<Trajectory> satelliteTrajectories = Array<Trajectory>::Empty();
+
+        for (Index i = 0; i < 10; ++i)
+        {
+            satelliteTrajectories.add(Orbit::SunSynchronous(
+                REFERENCE_START_INSTANT,
+                Length::Kilometers(500.0),
+                Time(6 + i, 0, 0),
+                REFERENCE_ENVIRONMENT.accessCelestialObjectWithName("Earth")
+            ));
+        }
+
+        return satelliteTrajectories;
+    }();
+    static const Array<AccessTarget> targets = MakeElevationTargets(50);
+
+    const Generator generator = {REFERENCE_ENVIRONMENT};
+    const Interval interval = Interval::Closed(REFERENCE_START_INSTANT, REFERENCE_START_INSTANT + Duration::Days(1.0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(generator.computeAccesses(interval, targets, trajectories));
+    }
+}
+
+// Scenario 5: fixed-target filtering throughput. One satellite against state.range(0) targets over one day, in coarse
+// mode so that the time is dominated by the per-instant visibility kernel rather than by crossing refinement.
+static void benchmarkFixedTargetFilter(
+    benchmark::State& state, const std::function<Array<AccessTarget>(const Index)>& aTargetFactory
+)
+{
+    static const Trajectory trajectory = MakeTabulatedTrajectory(Frame::ITRF());
+
+    const Index targetCount = state.range(0);
+    const Array<AccessTarget> targets = aTargetFactory(targetCount);
+
+    const Generator generator = {REFERENCE_ENVIRONMENT};
+    const Interval interval = Interval::Closed(REFERENCE_START_INSTANT, REFERENCE_START_INSTANT + Duration::Days(1.0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(generator.computeAccesses(interval, targets, trajectory, true));
+    }
+
+    state.SetItemsProcessed(state.iterations() * targetCount);
+}
+
+// Scenario 5b: azimuth-elevation mask kernel alone, for state.range(0) targets. state.range(1) selects the path: the
+// reference one (std::atan2 and VisibilityCriterion::AERMask::isSatisfied, target by target) when 0, the fixed-target
+// one (FastAtan2 over all targets and FlattenedAzimuthElevationMasks) otherwise.
+static void benchmarkAERMaskKernel(benchmark::State& state)
+{
+    const Index targetCount = state.range(0);
+    const bool isReference = state.range(1) == 0;
+
+    const Array<VisibilityCriterion::AERMask> aerMasks = Array<VisibilityCriterion::AERMask>(
+        targetCount, VisibilityCriterion::AERMask(REFERENCE_AZIMUTH_ELEVATION_MASK, MathInterval::Closed(0.0, 2.0e6))
+    );
+    const FlattenedAzimuthElevationMasks masks = {aerMasks};
+
+    // observer directions spread over the whole sphere, in the SEZ frames of the targets
+    Eigen::ArrayXd south(targetCount);
+    Eigen::ArrayXd east(targetCount);
+    Eigen::ArrayXd zenith(targetCount);
+
+    for (Index i = 0; i < targetCount; ++i)
+    {
+        const double azimuth_rad = std::fmod(2.399963 * i, 2.0 * M_PI);
+        const double elevation_rad = std::asin(-1.0 + 2.0 * (i + 0.5) / targetCount);
+        const double range_m = 5.0e5 + 2.5e6 * ((i * 7) % targetCount) / targetCount;
+
+        south(i) = -range_m * std::cos(elevation_rad) * std::cos(azimuth_rad);
+        east(i) = range_m * std::cos(elevation_rad) * std::sin(azimuth_rad);
+        zenith(i) = range_m * std::sin(elevation_rad);
+    }
+
+    Index visibleCount = 0;
+
+    for (auto _ : state)
+    {
+        visibleCount = 0;
+
+        const Eigen::ArrayXd horizontalRanges_m = (south.square() + east.square()).sqrt();
+        const Eigen::ArrayXd ranges_m = (horizontalRanges_m.square() + zenith.square()).sqrt();
+
+        if (isReference)
+        {
+            for (Index i = 0; i < targetCount; ++i)
+            {
+                const double azimuth_rad = std::atan2(east(i), -south(i));
+                const double elevation_rad = std::atan2(zenith(i), horizontalRanges_m(i));
+
+                visibleCount += aerMasks[i].isSatisfied(azimuth_rad, elevation_rad, ranges_m(i)) ? 1 : 0;
+            }
+        }
+        else
+        {
+            const Eigen::ArrayXd elevations_rad = FastAtan2(zenith, horizontalRanges_m);
+            Eigen::ArrayXd azimuths_rad = FastAtan2(east, -south);
+            azimuths_rad = (azimuths_rad < 0.0).select(azimuths_rad + 2.0 * M_PI, azimuths_rad);
+
+            for (Index i = 0; i < targetCount; ++i)
+            {
+                visibleCount += masks.isSatisfied(i, azimuths_rad(i), elevations_rad(i), ranges_m(i)) ? 1 : 0;
+            }
+        }
+
+        benchmark::DoNotOptimize(visibleCount);
+    }
+
+    state.SetItemsProcessed(state.iterations() * targetCount);
+    state.counters["visible"] = static_cast<double>(visibleCount);
+}
+
+// Scenario 6: crossing refinement cost. One satellite against state.range(0) elevation targets over one day, with
+// state.range(1) threads. The observer is read from a precomputed ephemeris, which makes the coarse scan cheap; the
+// coarse-mode variant (state.range(2) == 1) gives the scan-only baseline, to be subtracted from the refined run.
+static void benchmarkCrossingRefinement(benchmark::State& state)
+{
+    static const Trajectory trajectory = MakeTabulatedTrajectory(Frame::ITRF());
+
+    const Index targetCount = state.range(0);
+    const Array<AccessTarget> targets = MakeElevationTargets(targetCount);
+    const bool coarse = state.range(2) == 1;
+
+    Generator generator = {REFERENCE_ENVIRONMENT};
+    generator.setThreadCount(state.range(1));
+
+    const Interval interval = Interval::Closed(REFERENCE_START_INSTANT, REFERENCE_START_INSTANT + Duration::Days(1.0));
+    const Ephemeris ephemeris = generator.generateEphemeris(interval, trajectory);
+
+    Index accessCount = 0;
+
+    for (auto _ : state)
+    {
+        const Array<Array<Access>> accesses = generator.computeAccesses(interval, targets, ephemeris, coarse);
+
+        accessCount = 0;
+
+        for (const Array<Access>& targetAccesses : accesses)
+        {
+            accessCount += targetAccesses.getSize();
+        }
+
+        benchmark::DoNotOptimize(accesses);
+    }
+
+    state.counters["accesses"] = static_cast<double>(accessCount);
+}
+
 // Register the functions as a benchmark
 BENCHMARK(benchmark001)->Name("Access | Ground Station <> TLE")->Iterations(DEFAULT_ITERATIONS);
 
@@ -264,3 +474,61 @@ BENCHMARK(benchmarkTabulatedItrf100Targets1Week)
     ->Name("Access | Tabulated (ITRF out) | 100 targets | 1 week | Elevation")
     ->Iterations(TABULATED_ITERATIONS)
     ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(benchmarkConstellation10Satellites50Targets1Day)
+    ->Name("Access | Constellation | 10 satellites | 50 targets | 1 day | Elevation")
+    ->Iterations(TABULATED_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(benchmarkFixedTargetFilter, Elevation, MakeElevationTargets)
+    ->Name("Access | Fixed target filter | 1 day | Elevation")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Iterations(TABULATED_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(benchmarkFixedTargetFilter, AER, MakeAERTargets)
+    ->Name("Access | Fixed target filter | 1 day | AER")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Iterations(TABULATED_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(benchmarkFixedTargetFilter, AERMask, MakeAERMaskTargets)
+    ->Name("Access | Fixed target filter | 1 day | AER mask")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Iterations(TABULATED_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(benchmarkAERMaskKernel)
+    ->Name("Access | AER mask kernel")
+    ->ArgNames({"targets", "fast"})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(benchmarkFixedTargetFilter, LineOfSight, MakeLineOfSightTargets)
+    ->Name("Access | Fixed target filter | 1 day | Line of sight")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Iterations(TABULATED_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(benchmarkCrossingRefinement)
+    ->Name("Access | Crossing refinement | 1 day | Elevation")
+    ->ArgNames({"targets", "threads", "coarse"})
+    ->Args({1000, 1, 1})
+    ->Args({1000, 1, 0})
+    ->Args({1000, 4, 1})
+    ->Args({1000, 4, 0})
+    ->Args({1000, 8, 0})
+    ->Iterations(TABULATED_ITERATIONS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -3,9 +3,14 @@
 #include "benchmark/benchmark.h"
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 
@@ -17,7 +22,11 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
@@ -25,6 +34,7 @@ using ostk::physics::coordinate::Velocity;
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 
@@ -123,8 +133,261 @@ static void benchmark004(benchmark::State &state)
     }
 }
 
+static const Array<State> REFERENCE_BATCH_INITIAL_STATES = []() -> Array<State>
+{
+    // 1000 members, dispersed around the reference state
+    Array<State> states = Array<State>::Empty();
+
+    for (Index i = 0; i < 1000; ++i)
+    {
+        const double scale = 1.0 + 1.0e-4 * (double(i) - 500.0);
+
+        states.add({
+            REFERENCE_START_INSTANT,
+            Position::Meters(REFERENCE_INITIAL_STATE.getPosition().getCoordinates() * scale, Frame::GCRF()),
+            Velocity::MetersPerSecond(
+                REFERENCE_INITIAL_STATE.getVelocity().getCoordinates() / std::sqrt(scale), Frame::GCRF()
+            ),
+        });
+    }
+
+    return states;
+}();
+
+static const Instant REFERENCE_BATCH_END_INSTANT = REFERENCE_START_INSTANT + Duration::Hours(1.0);
+
+static const NumericalSolver REFERENCE_BATCH_SOLVER =
+    NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 10.0);
+
+static Array<Shared<Dynamics>> sphericalEarthDynamics()
+{
+    const Shared<Celestial> earth = std::make_shared<Celestial>(Earth::Spherical());
+
+    return {std::make_shared<PositionDerivative>(), std::make_shared<CentralBodyGravity>(earth)};
+}
+
+static void benchmark005(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const Propagator propagator = {REFERENCE_BATCH_SOLVER, sphericalEarthDynamics()};
+        state.ResumeTiming();
+
+        for (const State &initialState : REFERENCE_BATCH_INITIAL_STATES)
+        {
+            benchmark::DoNotOptimize(propagator.calculateStateAt(initialState, REFERENCE_BATCH_END_INSTANT));
+        }
+    }
+}
+
+static void benchmark006(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const Propagator propagator = {REFERENCE_BATCH_SOLVER, sphericalEarthDynamics()};
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(
+            propagator.calculateBatchStateAt(REFERENCE_BATCH_INITIAL_STATES, REFERENCE_BATCH_END_INSTANT)
+        );
+    }
+}
+
+// Geostationary orbit, at X axis
+static const State REFERENCE_GEO_INITIAL_STATE = {
+    REFERENCE_START_INSTANT,
+    Position::Meters({42164000.0, 0.0, 0.0}, Frame::GCRF()),
+    Velocity::MetersPerSecond({0.0, 3074.66, 0.0}, Frame::GCRF()),
+};
+
+static const Instant REFERENCE_GEO_END_INSTANT = REFERENCE_START_INSTANT + Duration::Days(30.0);
+
+static NumericalSolver longArcSolver(const NumericalSolver::StepperType &aStepperType, const bool &isGaussJackson)
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        aStepperType,
+        300.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    numericalSolver.setGaussJacksonEnabled(isGaussJackson);
+
+    return numericalSolver;
+}
+
+static void calculateLongArcStateAt(benchmark::State &state, const NumericalSolver &aNumericalSolver)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const Shared<Celestial> earth = std::make_shared<Celestial>(Earth::EGM96(8, 8));
+        const Propagator propagator = {
+            aNumericalSolver,
+            {std::make_shared<PositionDerivative>(), std::make_shared<CentralBodyGravity>(earth)},
+        };
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(propagator.calculateStateAt(REFERENCE_GEO_INITIAL_STATE, REFERENCE_GEO_END_INSTANT));
+    }
+}
+
+static void benchmark007(benchmark::State &state)
+{
+    calculateLongArcStateAt(state, longArcSolver(NumericalSolver::StepperType::RungeKuttaFehlberg78, false));
+}
+
+static void benchmark008(benchmark::State &state)
+{
+    calculateLongArcStateAt(state, longArcSolver(NumericalSolver::StepperType::BulirschStoer, false));
+}
+
+static void benchmark009(benchmark::State &state)
+{
+    calculateLongArcStateAt(state, longArcSolver(NumericalSolver::StepperType::RungeKuttaFehlberg78, true));
+}
+
+static const NumericalSolver REFERENCE_ADAPTIVE_SOLVER = {
+    NumericalSolver::LogType::NoLog,
+    NumericalSolver::StepperType::RungeKuttaFehlberg78,
+    5.0,
+    1.0e-12,
+    1.0e-12,
+};
+
+static Array<Dynamics::Context> sphericalEarthContexts()
+{
+    const Array<Shared<Dynamics>> dynamics = sphericalEarthDynamics();
+
+    return {
+        Dynamics::Context(dynamics[0], {Pair<Index, Size>(3, 3)}, {Pair<Index, Size>(0, 3)}),
+        Dynamics::Context(dynamics[1], {Pair<Index, Size>(0, 3)}, {Pair<Index, Size>(3, 3)}),
+    };
+}
+
+static void benchmark010(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        NumericalSolver numericalSolver = REFERENCE_ADAPTIVE_SOLVER;
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetSystemOfEquations(
+            sphericalEarthContexts(), REFERENCE_START_INSTANT, REFERENCE_INITIAL_STATE.accessFrame()
+        );
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(
+            numericalSolver.integrateTime(REFERENCE_INITIAL_STATE, REFERENCE_END_INSTANT, systemOfEquations)
+        );
+    }
+}
+
+static void benchmark011(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        NumericalSolver numericalSolver = REFERENCE_ADAPTIVE_SOLVER;
+        const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6> systemOfEquations =
+            Dynamics::GetFixedSizeSystemOfEquations<6>(
+                sphericalEarthContexts(), REFERENCE_START_INSTANT, REFERENCE_INITIAL_STATE.accessFrame()
+            );
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(
+            numericalSolver.integrateTime<6>(REFERENCE_INITIAL_STATE, REFERENCE_END_INSTANT, systemOfEquations)
+        );
+    }
+}
+
+// Same as benchmark004, with the harmonics above the point mass term re-evaluated at an adaptive interval
+static void benchmark012(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const Shared<Celestial> earth = std::make_shared<Celestial>(Earth::EGM2008(100, 100));
+        const Shared<Dynamics> centralBodyGravity = std::make_shared<CentralBodyGravity>(earth);
+        centralBodyGravity->setMultiRateEvaluation(Duration::Minutes(2.0), 1.0e-9);
+        const Array<Shared<Dynamics>> dynamics = {std::make_shared<PositionDerivative>(), centralBodyGravity};
+
+        calculateStateAt(state, dynamics);
+    }
+}
+
+// Geostationary transfer orbit, 300km x 35786km, i=28.5deg, at perigee on X axis
+static const State REFERENCE_GTO_INITIAL_STATE = {
+    REFERENCE_START_INSTANT,
+    Position::Meters({6678137.0, 0.0, 0.0}, Frame::GCRF()),
+    Velocity::MetersPerSecond({0.0, 8921.303254950628, 4843.872450478382}, Frame::GCRF()),
+};
+
+// About two transfer orbit periods
+static const Instant REFERENCE_GTO_END_INSTANT = REFERENCE_START_INSTANT + Duration::Hours(21.0);
+
+static void calculateTransferStateAt(benchmark::State &state, const Real &aTruncationTolerance)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const Shared<Celestial> earth = std::make_shared<Celestial>(Earth::EGM2008(100, 100));
+        const Shared<CentralBodyGravity> centralBodyGravity = std::make_shared<CentralBodyGravity>(earth);
+        centralBodyGravity->setTruncationTolerance(aTruncationTolerance);
+        const Propagator propagator = {
+            REFERENCE_ADAPTIVE_SOLVER,
+            {std::make_shared<PositionDerivative>(), centralBodyGravity},
+        };
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(propagator.calculateStateAt(REFERENCE_GTO_INITIAL_STATE, REFERENCE_GTO_END_INSTANT));
+    }
+}
+
+static void benchmark013(benchmark::State &state)
+{
+    calculateTransferStateAt(state, Real::Undefined());
+}
+
+static void benchmark014(benchmark::State &state)
+{
+    calculateTransferStateAt(state, 1.0e-9);
+}
+
 // Register the functions as a benchmark
 BENCHMARK(benchmark001)->Name("Propagation | Numerical | Spherical")->Iterations(DEFAULT_ITERATIONS);
 BENCHMARK(benchmark002)->Name("Propagation | Numerical | EGM1984 {100, 100}")->Iterations(DEFAULT_ITERATIONS);
 BENCHMARK(benchmark003)->Name("Propagation | Numerical | EGM1996 {100, 100}")->Iterations(DEFAULT_ITERATIONS);
 BENCHMARK(benchmark004)->Name("Propagation | Numerical | EGM2008 {100, 100}")->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark005)
+    ->Name("Propagation | Numerical | Spherical | 1000 members | Per member")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark006)
+    ->Name("Propagation | Numerical | Spherical | 1000 members | Batch")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark007)
+    ->Name("Propagation | Numerical | EGM1996 {8, 8} | GEO 30 days | RungeKuttaFehlberg78")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark008)
+    ->Name("Propagation | Numerical | EGM1996 {8, 8} | GEO 30 days | BulirschStoer")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark009)
+    ->Name("Propagation | Numerical | EGM1996 {8, 8} | GEO 30 days | GaussJackson")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark010)
+    ->Name("Propagation | Numerical | Spherical | RungeKuttaFehlberg78 | Dynamic size")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark011)
+    ->Name("Propagation | Numerical | Spherical | RungeKuttaFehlberg78 | Fixed size")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark012)
+    ->Name("Propagation | Numerical | EGM2008 {100, 100} | Multi-rate")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark013)
+    ->Name("Propagation | Numerical | EGM2008 {100, 100} | GTO | Full degree")
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark014)
+    ->Name("Propagation | Numerical | EGM2008 {100, 100} | GTO | Altitude-adaptive degree")
+    ->Iterations(DEFAULT_ITERATIONS);
@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/Ephemeris.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Access/Generator.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Access/VisibilityCriterion.cpp>
 
@@ -203,6 +204,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access(pybind11::module& aModule)
     auto access = aModule.def_submodule("access");
 
     // Add elements to "access" module
+    OpenSpaceToolkitAstrodynamicsPy_Access_Ephemeris(access);
     OpenSpaceToolkitAstrodynamicsPy_Access_Generator(access);
     OpenSpaceToolkitAstrodynamicsPy_Access_VisibilityCriterion(access);
 }
@@ -0,0 +1,127 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/Ephemeris.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_Ephemeris(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::access::Ephemeris;
+    using ostk::astrodynamics::Trajectory;
+
+    class_<Ephemeris>(
+        aModule,
+        "Ephemeris",
+        R"doc(
+            Observer trajectory tabulated in a body-fixed frame, for reuse across access computations.
+
+            The trajectory is evaluated and its positions transformed once, so that several access computations for
+            the same observer (e.g. one per batch of targets) do not pay for it again.
+
+        )doc"
+    )
+
+        .def(
+            init<const Trajectory&, const Array<Instant>&, const Shared<const Frame>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    trajectory (Trajectory): The observer trajectory.
+                    instants (list[Instant]): The instants at which the trajectory is tabulated, in strictly ascending
+                        order.
+                    frame (Frame): The frame in which the positions are expressed. Defaults to Frame.ITRF().
+
+            )doc",
+            arg("trajectory"),
+            arg("instants"),
+            arg_v("frame", Frame::ITRF(), "Frame.ITRF()")
+        )
+
+        .def(
+            "is_defined",
+            &Ephemeris::isDefined,
+            R"doc(
+                Check if the ephemeris is defined.
+
+                Returns:
+                    bool: True if the ephemeris is defined, False otherwise.
+
+            )doc"
+        )
+        .def(
+            "get_trajectory",
+            &Ephemeris::accessTrajectory,
+            R"doc(
+                Get the observer trajectory.
+
+                Returns:
+                    Trajectory: The observer trajectory.
+
+            )doc"
+        )
+        .def(
+            "get_instants",
+            &Ephemeris::accessInstants,
+            R"doc(
+                Get the tabulated instants.
+
+                Returns:
+                    list[Instant]: The tabulated instants.
+
+            )doc"
+        )
+        .def(
+            "get_position_coordinates",
+            &Ephemeris::accessPositionCoordinates,
+            R"doc(
+                Get the tabulated position coordinates.
+
+                Returns:
+                    np.ndarray: The position coordinates [m], one column per instant.
+
+            )doc"
+        )
+        .def(
+            "get_frame",
+            &Ephemeris::accessFrame,
+            R"doc(
+                Get the frame of the tabulated positions.
+
+                Returns:
+                    Frame: The frame of the tabulated positions.
+
+            )doc"
+        )
+        .def(
+            "get_size",
+            &Ephemeris::getSize,
+            R"doc(
+                Get the number of tabulated instants.
+
+                Returns:
+                    int: The number of tabulated instants.
+
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &Ephemeris::Undefined,
+            R"doc(
+                Get an undefined ephemeris.
+
+                Returns:
+                    Ephemeris: An undefined ephemeris.
+
+            )doc"
+        )
+
+        ;
+}
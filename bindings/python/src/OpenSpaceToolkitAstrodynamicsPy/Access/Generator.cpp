@@ -21,6 +21,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
 
     using ostk::astrodynamics::Access;
     using ostk::astrodynamics::access::AccessTarget;
+    using ostk::astrodynamics::access::Ephemeris;
     using ostk::astrodynamics::access::Generator;
     using ostk::astrodynamics::Trajectory;
     using ostk::astrodynamics::trajectory::State;
@@ -174,15 +175,149 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
             )doc"
         );
 
-    class_<Generator, Shared<Generator>>(
+    class_<Generator, Shared<Generator>> generatorClass(
         aModule,
         "Generator",
         R"doc(
             An access generator.
 
+        )doc"
+    );
+
+    class_<Generator::Statistics>(
+        generatorClass,
+        "Statistics",
+        R"doc(
+            Counters and timers of the access computations run by a generator, per stage.
+
+            Stages are the sampling of the grid, the refinement of the crossings found on the grid, and the generation
+            of the accesses. Stage durations are summed over threads.
+
         )doc"
     )
 
+        .def_readonly(
+            "computation_count",
+            &Generator::Statistics::computationCount,
+            R"doc(
+                The number of access computations.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "sample_count",
+            &Generator::Statistics::sampleCount,
+            R"doc(
+                The number of (observer, grid instant) samples evaluated.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "trajectory_evaluation_count",
+            &Generator::Statistics::trajectoryEvaluationCount,
+            R"doc(
+                The number of trajectory state evaluations, across all stages.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "ephemeris_lookup_count",
+            &Generator::Statistics::ephemerisLookupCount,
+            R"doc(
+                The number of observer positions read from an ephemeris.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "frame_transform_count",
+            &Generator::Statistics::frameTransformCount,
+            R"doc(
+                The number of frame transforms computed, across all stages.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "crossing_count",
+            &Generator::Statistics::crossingCount,
+            R"doc(
+                The number of crossings refined.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "root_solver_iteration_count",
+            &Generator::Statistics::rootSolverIterationCount,
+            R"doc(
+                The number of root solver iterations, across all crossings.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "closest_approach_evaluation_count",
+            &Generator::Statistics::closestApproachEvaluationCount,
+            R"doc(
+                The number of range evaluations by the closest approach search.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "access_count",
+            &Generator::Statistics::accessCount,
+            R"doc(
+                The number of accesses generated, before the access filter.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "sampling_duration",
+            &Generator::Statistics::samplingDuration,
+            R"doc(
+                The time spent sampling the grid, summed over threads.
+
+                :type: Duration
+            )doc"
+        )
+        .def_readonly(
+            "refinement_duration",
+            &Generator::Statistics::refinementDuration,
+            R"doc(
+                The time spent refining crossings, summed over threads.
+
+                :type: Duration
+            )doc"
+        )
+        .def_readonly(
+            "generation_duration",
+            &Generator::Statistics::generationDuration,
+            R"doc(
+                The time spent generating accesses, summed over threads.
+
+                :type: Duration
+            )doc"
+        )
+        .def_readonly(
+            "total_duration",
+            &Generator::Statistics::totalDuration,
+            R"doc(
+                The wall-clock time of the computations.
+
+                :type: Duration
+            )doc"
+        )
+
+        ;
+
+    generatorClass
+
         .def(
             init<
                 const Environment&,
@@ -264,6 +399,66 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
 
             )doc"
         )
+        .def(
+            "get_batch_state_filter",
+            &Generator::getBatchStateFilter,
+            R"doc(
+                Get the batch state filter.
+
+                Returns:
+                    function: The batch state filter.
+
+            )doc"
+        )
+        .def(
+            "get_thread_count",
+            &Generator::getThreadCount,
+            R"doc(
+                Get the number of threads used to compute accesses.
+
+                Returns:
+                    int: The thread count.
+
+            )doc"
+        )
+
+        .def(
+            "get_horizon_prescreening",
+            &Generator::getHorizonPrescreening,
+            R"doc(
+                Get the horizon pre-screening bounds.
+
+                Returns:
+                    tuple[Length, Derived]: The maximum observer altitude and angular rate, undefined if disabled.
+
+            )doc"
+        )
+
+        .def(
+            "is_statistics_enabled",
+            &Generator::isStatisticsEnabled,
+            R"doc(
+                Check whether statistics are collected.
+
+                Returns:
+                    bool: True if statistics are collected, False otherwise.
+
+            )doc"
+        )
+        .def(
+            "get_statistics",
+            &Generator::getStatistics,
+            R"doc(
+                Get the statistics collected since they were enabled or last reset.
+
+                The counters are those of the work actually performed, which depends on how it is split: with more
+                than one thread, they can differ from those of the same computation on one thread.
+
+                Returns:
+                    Generator.Statistics: The statistics, accumulated over all computations.
+
+            )doc"
+        )
 
         .def(
             "get_condition_function",
@@ -303,7 +498,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
             arg("interval"),
             arg("access_target"),
             arg("to_trajectory"),
-            arg("coarse") = false
+            arg("coarse") = false,
+            call_guard<gil_scoped_release>()
         )
         .def(
             "compute_accesses",
@@ -326,7 +522,133 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
             arg("interval"),
             arg("access_targets"),
             arg("to_trajectory"),
-            arg("coarse") = false
+            arg("coarse") = false,
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "compute_accesses",
+            overload_cast<const Interval&, const Array<AccessTarget>&, const Array<Trajectory>&, const bool&>(
+                &Generator::computeAccesses, const_
+            ),
+            R"doc(
+                Compute the accesses between multiple access targets and multiple trajectories.
+
+                The sampling grid, the target geometry and the per-instant frame transforms are computed once and
+                shared across all trajectories.
+
+                Args:
+                    interval (Interval): The time interval over which to compute accesses.
+                    access_targets (list[AccessTarget]): The access targets to compute the accesses with.
+                    to_trajectories (list[Trajectory]): The trajectories to compute the accesses with.
+                    coarse (bool): True to use coarse mode. Defaults to False. Only available for fixed targets.
+
+                Returns:
+                    list[list[list[Access]]]: The accesses, indexed as [trajectory][access target].
+
+            )doc",
+            arg("interval"),
+            arg("access_targets"),
+            arg("to_trajectories"),
+            arg("coarse") = false,
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "compute_accesses",
+            overload_cast<const Interval&, const Array<AccessTarget>&, const Ephemeris&, const bool&>(
+                &Generator::computeAccesses, const_
+            ),
+            R"doc(
+                Compute the accesses between multiple access targets and a tabulated observer.
+
+                For fixed targets, the observer position is read from the ephemeris at every grid instant it
+                tabulates, rather than evaluated again. Build the ephemeris once with `generate_ephemeris`, and reuse
+                it across batches of targets.
+
+                Args:
+                    interval (Interval): The time interval over which to compute accesses.
+                    access_targets (list[AccessTarget]): The access targets to compute the accesses with.
+                    to_ephemeris (Ephemeris): The ephemeris of the observer, in the central celestial object frame.
+                    coarse (bool): True to use coarse mode. Defaults to False. Only available for fixed targets.
+
+                Returns:
+                    list[list[Access]]: The accesses, indexed as [access target].
+
+            )doc",
+            arg("interval"),
+            arg("access_targets"),
+            arg("to_ephemeris"),
+            arg("coarse") = false,
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "compute_accesses",
+            overload_cast<const Interval&, const Array<AccessTarget>&, const Array<Ephemeris>&, const bool&>(
+                &Generator::computeAccesses, const_
+            ),
+            R"doc(
+                Compute the accesses between multiple access targets and multiple tabulated observers.
+
+                Args:
+                    interval (Interval): The time interval over which to compute accesses.
+                    access_targets (list[AccessTarget]): The access targets to compute the accesses with.
+                    to_ephemerides (list[Ephemeris]): The ephemerides of the observers, in the central celestial
+                        object frame.
+                    coarse (bool): True to use coarse mode. Defaults to False. Only available for fixed targets.
+
+                Returns:
+                    list[list[list[Access]]]: The accesses, indexed as [ephemeris][access target].
+
+            )doc",
+            arg("interval"),
+            arg("access_targets"),
+            arg("to_ephemerides"),
+            arg("coarse") = false,
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "generate_ephemeris",
+            &Generator::generateEphemeris,
+            R"doc(
+                Generate the ephemeris of an observer on the sampling grid of an interval.
+
+                Args:
+                    interval (Interval): The time interval over which to tabulate the trajectory.
+                    trajectory (Trajectory): The trajectory of the observer.
+
+                Returns:
+                    Ephemeris: The ephemeris of the observer.
+
+            )doc",
+            arg("interval"),
+            arg("trajectory"),
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "stream_accesses",
+            &Generator::streamAccesses,
+            R"doc(
+                Stream the accesses between multiple fixed access targets and a trajectory.
+
+                The interval is scanned in consecutive windows, carrying accesses still open at the end of a window
+                over to the next one, so that memory does not grow with the interval duration. Each access is passed
+                to the callback once complete, along with the index of its target.
+
+                Args:
+                    interval (Interval): The time interval over which to compute accesses.
+                    access_targets (list[AccessTarget]): The fixed access targets to compute the accesses with.
+                    to_trajectory (Trajectory): The trajectory to compute the accesses with.
+                    callback (callable[[int, Access], None]): The function receiving the target index and the access.
+                    window_duration (Duration): The duration of a scanning window. Defaults to one day.
+                    coarse (bool): True to use coarse mode. Defaults to False.
+
+            )doc",
+            arg("interval"),
+            arg("access_targets"),
+            arg("to_trajectory"),
+            arg("callback"),
+            arg("window_duration") = Duration::Days(1.0),
+            arg("coarse") = false,
+            call_guard<gil_scoped_release>()
         )
         .def(
             "set_step",
@@ -376,6 +698,80 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
         )doc",
             arg("state_filter")
         )
+        .def(
+            "set_batch_state_filter",
+            &Generator::setBatchStateFilter,
+            R"doc(
+            Set the batch state filter.
+
+            At each sample instant, the filter receives the "to" state and the list of "from" states of the targets
+            satisfying their visibility criterion, and returns a list of booleans (one per "from" state) telling
+            whether each of them is retained.
+
+            Args:
+                batch_state_filter (function): The batch state filter.
+
+        )doc",
+            arg("batch_state_filter")
+        )
+        .def(
+            "set_thread_count",
+            &Generator::setThreadCount,
+            R"doc(
+            Set the number of threads used to compute accesses.
+
+            A thread count of 1 (the default) computes accesses serially. Results are identical for any thread count.
+            Access and state filters are invoked concurrently when more than one thread is used.
+
+            Args:
+                thread_count (int): The thread count, strictly positive.
+
+        )doc",
+            arg("thread_count")
+        )
+
+        .def(
+            "set_horizon_prescreening",
+            &Generator::setHorizonPrescreening,
+            R"doc(
+            Set the horizon pre-screening bounds.
+
+            For fixed targets with an elevation-based visibility criterion, grid steps at which every target is
+            guaranteed to remain below its minimum elevation are skipped. Results are unchanged as long as the
+            observer stays within both bounds. Undefined bounds disable the pre-screen.
+
+            Args:
+                maximum_altitude (Length): The maximum altitude of the observer above the central body equatorial radius.
+                maximum_angular_rate (Derived): The maximum angular rate of the observer, as seen from the central body center, in the body frame.
+
+        )doc",
+            arg("maximum_altitude"),
+            arg("maximum_angular_rate")
+        )
+
+        .def(
+            "set_statistics_enabled",
+            &Generator::setStatisticsEnabled,
+            R"doc(
+            Enable or disable the collection of statistics.
+
+            When enabled, every access computation adds its counters and timers to those of the generator, which
+            helps tuning the step and tolerance on a given scenario. Disabled by default.
+
+            Args:
+                is_enabled (bool): True to collect statistics, False otherwise.
+
+        )doc",
+            arg("is_enabled")
+        )
+        .def(
+            "reset_statistics",
+            &Generator::resetStatistics,
+            R"doc(
+            Reset the collected statistics.
+
+        )doc"
+        )
 
         .def_static(
             "undefined",
@@ -11,6 +11,7 @@
 
 using namespace pybind11;
 
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 
 using ostk::mathematics::object::Vector3d;
@@ -18,6 +19,7 @@ using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::Environment;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::Dynamics;
@@ -63,6 +65,20 @@ class PyDynamics : public Dynamics
             VectorXd, Dynamics, "compute_contribution", computeContribution, anInstant, x, aFrameSPtr
         );
     }
+
+    bool hasContributionJacobian() const override
+    {
+        PYBIND11_OVERRIDE_NAME(bool, Dynamics, "has_contribution_jacobian", hasContributionJacobian);
+    }
+
+    MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override
+    {
+        PYBIND11_OVERRIDE_NAME(
+            MatrixXd, Dynamics, "compute_contribution_jacobian", computeContributionJacobian, anInstant, x, aFrameSPtr
+        );
+    }
 };
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
@@ -78,7 +94,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
                 - get_read_coordinate_subsets
                 - get_write_coordinate_subsets
                 - compute_contribution
-            to create a custom dynamics class.
+            to create a custom dynamics class. Overriding has_contribution_jacobian and compute_contribution_jacobian
+            allows the state transition matrix to be propagated.
 
         )doc"
     )
@@ -108,6 +125,62 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "is_multi_rate_evaluation_enabled",
+            &Dynamics::isMultiRateEvaluationEnabled,
+            R"doc(
+                Check if multi-rate evaluation is enabled.
+
+                Returns:
+                    is_multi_rate_evaluation_enabled (bool): True if multi-rate evaluation is enabled.
+            )doc"
+        )
+
+        .def(
+            "get_multi_rate_maximum_interval",
+            &Dynamics::getMultiRateMaximumInterval,
+            R"doc(
+                Get the maximum interval between two evaluations of the slow part of the contribution.
+
+                Returns:
+                    maximum_interval (Duration): The maximum interval, undefined if multi-rate evaluation is disabled.
+            )doc"
+        )
+
+        .def(
+            "get_multi_rate_tolerance",
+            &Dynamics::getMultiRateTolerance,
+            R"doc(
+                Get the tolerance on the interpolation error of the slow part of the contribution.
+
+                Returns:
+                    tolerance (Real): The tolerance, undefined if multi-rate evaluation is disabled.
+            )doc"
+        )
+
+        .def(
+            "set_multi_rate_evaluation",
+            &Dynamics::setMultiRateEvaluation,
+            arg("maximum_interval"),
+            arg("tolerance"),
+            R"doc(
+                Set multi-rate evaluation, to evaluate an expensive and slowly varying contribution less often than at every call of the system of equations.
+
+                Only the fast part of the contribution (e.g. the point mass term of the central body gravity) is then evaluated at every call, while the remainder is re-evaluated at an adaptive interval and interpolated in between. Batch propagation and state transition matrix propagation keep evaluating the full contribution at every call.
+
+                Args:
+                    maximum_interval (Duration): The strictly positive maximum interval between two evaluations of the slow part.
+                    tolerance (Real): The strictly positive tolerance on the interpolation error of the slow part, in SI units of the contribution (e.g. m/s^2 for an acceleration).
+            )doc"
+        )
+        .def(
+            "disable_multi_rate_evaluation",
+            &Dynamics::disableMultiRateEvaluation,
+            R"doc(
+                Disable multi-rate evaluation, the full contribution is then evaluated at every call.
+            )doc"
+        )
+
         .def("__str__", &(shiftToString<Dynamics>))
         .def("__repr__", &(shiftToString<Dynamics>))
 
@@ -163,6 +236,55 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "compute_contributions",
+            &Dynamics::computeContributions,
+            arg("instant"),
+            arg("state_matrix"),
+            arg("frame"),
+            R"doc(
+                Compute the contributions of the dynamics for a batch of states at a given instant.
+
+                Args:
+                    instant (Instant): The instant at which to compute the contributions.
+                    state_matrix (numpy.ndarray): The state matrix at the instant, one row per member.
+                    frame (Frame): The reference frame in which to compute the contributions.
+
+                Returns:
+                    contributions (numpy.ndarray): The contributions of the dynamics at the instant, one row per member.
+            )doc"
+        )
+
+        .def(
+            "has_contribution_jacobian",
+            &Dynamics::hasContributionJacobian,
+            R"doc(
+                Check if the dynamics provides the Jacobian of its contribution.
+
+                Returns:
+                    has_contribution_jacobian (bool): True if the dynamics provides the Jacobian of its contribution.
+            )doc"
+        )
+
+        .def(
+            "compute_contribution_jacobian",
+            &Dynamics::computeContributionJacobian,
+            arg("instant"),
+            arg("state_vector"),
+            arg("frame"),
+            R"doc(
+                Compute the Jacobian of the contribution of the dynamics with respect to the state, at a given instant.
+
+                Args:
+                    instant (Instant): The instant at which to compute the Jacobian.
+                    state_vector (numpy.ndarray): The state vector at the instant.
+                    frame (Frame): The reference frame in which to compute the Jacobian.
+
+                Returns:
+                    jacobian (numpy.ndarray): The Jacobian, of size (write state size, read state size).
+            )doc"
+        )
+
         .def_static(
             "from_environment",
             &Dynamics::FromEnvironment,
@@ -61,6 +61,49 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_CentralBodyGravity(pybind11
                 )doc"
             )
 
+            .def(
+                "get_truncation_tolerance",
+                &CentralBodyGravity::getTruncationTolerance,
+                R"doc(
+                    Get the acceleration tolerance of the altitude-adaptive truncation of the gravitational model.
+
+                    Returns:
+                        Real: The tolerance, in m/s^2, undefined if the truncation is not adaptive.
+
+                )doc"
+            )
+
+            .def(
+                "set_truncation_tolerance",
+                &CentralBodyGravity::setTruncationTolerance,
+                arg("acceleration_tolerance"),
+                R"doc(
+                    Set the acceleration tolerance of the altitude-adaptive truncation of the gravitational model.
+
+                    The degree and order of the spherical harmonics expansion then follow the radius of each evaluated position: the higher degree terms, estimated with Kaula's rule, are dropped as long as their sum stays within the tolerance.
+
+                    Args:
+                        acceleration_tolerance (Real): The strictly positive tolerance, in m/s^2. Use Real.undefined() to use the full model at every radius.
+
+                )doc"
+            )
+
+            .def(
+                "get_truncation_degree_at",
+                &CentralBodyGravity::getTruncationDegreeAt,
+                arg("radius"),
+                R"doc(
+                    Get the effective degree of the gravitational model at a given radius.
+
+                    Args:
+                        radius (Real): The distance to the center of the central body, in meters.
+
+                    Returns:
+                        int: The effective degree, undefined if the truncation is not adaptive.
+
+                )doc"
+            )
+
             .def(
                 "compute_contribution",
                 &CentralBodyGravity::computeContribution,
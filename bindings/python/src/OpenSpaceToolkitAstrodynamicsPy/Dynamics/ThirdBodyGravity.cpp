@@ -2,6 +2,8 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/ThirdBodyGravity/ChebyshevEphemeris.cpp>
+
 inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::module& aModule)
 {
     using namespace pybind11;
@@ -12,6 +14,11 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
 
     using ostk::astrodynamics::Dynamics;
     using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+    using ostk::astrodynamics::dynamics::thirdbodygravity::ChebyshevEphemeris;
+
+    auto thirdBodyGravity = aModule.def_submodule("third_body_gravity");
+
+    OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity_ChebyshevEphemeris(thirdBodyGravity);
 
     {
         class_<ThirdBodyGravity, Dynamics, Shared<ThirdBodyGravity>>(
@@ -33,6 +40,21 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
 
                 )doc"
             )
+            .def(
+                init<const Shared<Celestial>&, const Shared<ChebyshevEphemeris>&>(),
+                arg("celestial"),
+                arg("ephemeris"),
+                R"doc(
+                    Constructor with a Chebyshev ephemeris.
+
+                    The position of the third body is interpolated from the ephemeris at the instants it covers.
+
+                    Args:
+                        celestial (Celestial): The celestial body, with a point-mass gravitational model.
+                        ephemeris (ChebyshevEphemeris): A Chebyshev ephemeris of the same celestial body.
+
+                )doc"
+            )
 
             .def("__str__", &(shiftToString<ThirdBodyGravity>))
             .def("__repr__", &(shiftToString<ThirdBodyGravity>))
@@ -61,6 +83,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
                 )doc"
             )
 
+            .def(
+                "get_ephemeris",
+                &ThirdBodyGravity::getEphemeris,
+                R"doc(
+                    Get the Chebyshev ephemeris.
+
+                    Returns:
+                        ChebyshevEphemeris: The Chebyshev ephemeris, None if there is none.
+
+                )doc"
+            )
+
             .def(
                 "compute_contribution",
                 &ThirdBodyGravity::computeContribution,
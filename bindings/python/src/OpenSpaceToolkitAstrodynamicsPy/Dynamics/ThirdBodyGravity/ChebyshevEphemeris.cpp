@@ -0,0 +1,146 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity/ChebyshevEphemeris.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity_ChebyshevEphemeris(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Interval;
+    using ostk::physics::unit::Length;
+
+    using ostk::astrodynamics::dynamics::thirdbodygravity::ChebyshevEphemeris;
+
+    class_<ChebyshevEphemeris, Shared<ChebyshevEphemeris>>(
+        aModule,
+        "ChebyshevEphemeris",
+        R"doc(
+            Celestial body position interpolated with piecewise Chebyshev polynomials.
+
+            Segments are bisected until the fit is within the requested tolerance. The same instance can be shared by
+            all propagations covering its interval.
+
+        )doc"
+    )
+        .def(
+            init<const Shared<Celestial>&, const Interval&, const Length&, const Shared<const Frame>&, const Size&>(),
+            arg("celestial"),
+            arg("interval"),
+            arg_v("tolerance", Length::Meters(1.0), "Length.meters(1.0)"),
+            arg_v("frame", Frame::GCRF(), "Frame.GCRF()"),
+            arg("degree") = 12,
+            R"doc(
+                Constructor.
+
+                Args:
+                    celestial (Celestial): The celestial body.
+                    interval (Interval): The interval to cover.
+                    tolerance (Length): The maximum position error. Defaults to 1 meter.
+                    frame (Frame): The frame in which positions are expressed. Defaults to GCRF.
+                    degree (int): The degree of the polynomials. Defaults to 12.
+
+            )doc"
+        )
+
+        .def(
+            "is_defined",
+            &ChebyshevEphemeris::isDefined,
+            R"doc(
+                Check if the ephemeris is defined.
+
+                Returns:
+                    bool: True if the ephemeris is defined.
+
+            )doc"
+        )
+        .def(
+            "contains",
+            &ChebyshevEphemeris::contains,
+            arg("instant"),
+            R"doc(
+                Check if the ephemeris covers an instant.
+
+                Args:
+                    instant (Instant): An instant.
+
+                Returns:
+                    bool: True if the instant lies within the fitted interval.
+
+            )doc"
+        )
+        .def(
+            "get_interval",
+            &ChebyshevEphemeris::accessInterval,
+            R"doc(
+                Get the fitted interval.
+
+                Returns:
+                    Interval: The fitted interval.
+
+            )doc"
+        )
+        .def(
+            "get_frame",
+            &ChebyshevEphemeris::accessFrame,
+            R"doc(
+                Get the frame in which positions are expressed.
+
+                Returns:
+                    Frame: The frame.
+
+            )doc"
+        )
+        .def(
+            "get_tolerance",
+            &ChebyshevEphemeris::getTolerance,
+            R"doc(
+                Get the tolerance.
+
+                Returns:
+                    Length: The maximum position error.
+
+            )doc"
+        )
+        .def(
+            "get_degree",
+            &ChebyshevEphemeris::getDegree,
+            R"doc(
+                Get the degree of the polynomials.
+
+                Returns:
+                    int: The degree of the polynomials.
+
+            )doc"
+        )
+        .def(
+            "get_segment_count",
+            &ChebyshevEphemeris::getSegmentCount,
+            R"doc(
+                Get the number of segments.
+
+                Returns:
+                    int: The number of segments the interval is split into.
+
+            )doc"
+        )
+        .def(
+            "compute_position_at",
+            &ChebyshevEphemeris::computePositionAt,
+            arg("instant"),
+            R"doc(
+                Compute the position of the celestial body.
+
+                Args:
+                    instant (Instant): An instant, within the fitted interval.
+
+                Returns:
+                    numpy.ndarray: The position coordinates [m], expressed in the ephemeris frame.
+
+            )doc"
+        );
+}
@@ -72,11 +72,17 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Estimator_OrbitDeterminationSolver(p
 
     orbitDeterminationSolver
         .def(
-            init<const Environment&, const NumericalSolver&, const LeastSquaresSolver&, const Shared<Frame>&>(),
+            init<
+                const Environment&,
+                const NumericalSolver&,
+                const LeastSquaresSolver&,
+                const Shared<Frame>&,
+                const bool&>(),
             arg_v("environment", DEFAULT_ENVIRONMENT, "Environment.default()"),
             arg_v("numerical_solver", DEFAULT_NUMERICAL_SOLVER, "NumericalSolver.default()"),
             arg_v("solver", DEFAULT_LEAST_SQUARES_SOLVER, "LeastSquaresSolver.default()"),
             arg_v("estimation_frame", DEFAULT_ESTIMATION_FRAME, "Frame.GCRF()"),
+            arg("is_state_transition_matrix_propagated") = false,
             R"doc(
                 Construct a new OrbitDeterminationSolver object.
 
@@ -85,6 +91,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Estimator_OrbitDeterminationSolver(p
                     numerical_solver (NumericalSolver, optional): The numerical solver. Defaults to NumericalSolver.default().
                     solver (LeastSquaresSolver, optional): The Least Squares solver. Defaults to LeastSquaresSolver.default().
                     estimation_frame (Frame, optional): The estimation frame. Defaults to Frame.GCRF().
+                    is_state_transition_matrix_propagated (bool, optional): If True, the state transition matrix is propagated alongside the state when all dynamics provide their Jacobian and the estimation frame is GCRF, instead of being computed with finite differences. Defaults to False.
             )doc"
         )
         .def(
@@ -131,6 +138,16 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Estimator_OrbitDeterminationSolver(p
                     Frame: The estimation frame.
             )doc"
         )
+        .def(
+            "is_state_transition_matrix_propagated",
+            &OrbitDeterminationSolver::isStateTransitionMatrixPropagated,
+            R"doc(
+                Check if the state transition matrix is propagated alongside the state.
+
+                Returns:
+                    bool: True if the state transition matrix is propagated.
+            )doc"
+        )
         .def(
             "estimate",
             &OrbitDeterminationSolver::estimate,
@@ -298,6 +298,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_LeastSquaresSolver(py::module
                     state_generator (callable[list[State],[State, list[Instant]]]): Function to generate states.
                     initial_guess_sigmas (dict[CoordinateSubset, np.ndarray], optional): Dictionary of sigmas for initial guess.
                     observation_sigmas (dict[CoordinateSubset, np.ndarray], optional): Dictionary of sigmas for observations.
+                    state_transition_matrix_generator (callable[tuple[list[State], list[np.ndarray]],[State, list[Instant]]], optional): Function to generate states and their state transition matrices. When provided, it is used instead of finite differences.
 
                 Returns:
                     LeastSquaresSolver::Analysis: The analysis of the estimate.
@@ -306,7 +307,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_LeastSquaresSolver(py::module
             arg("observations"),
             arg("state_generator"),
             arg_v("initial_guess_sigmas", DEFAULT_INITIAL_GUESS_SIGMAS, "{}"),
-            arg_v("observation_sigmas", DEFAULT_OBSERVATION_SIGMAS, "{}")
+            arg_v("observation_sigmas", DEFAULT_OBSERVATION_SIGMAS, "{}"),
+            arg_v("state_transition_matrix_generator", nullptr, "None")
         )
         .def_static(
             "calculate_empirical_covariance",
@@ -8,11 +8,15 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
 
     using ostk::core::container::Array;
     using ostk::core::type::Integer;
+    using ostk::core::type::Real;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
+    using ostk::physics::time::Duration;
     using ostk::physics::time::Instant;
 
     using ostk::astrodynamics::trajectory::orbit::model::Propagated;
+    using ostk::astrodynamics::trajectory::orbit::model::propagated::CheckpointStore;
     using ostk::astrodynamics::trajectory::orbit::model::Tabulated;
     using ostk::astrodynamics::trajectory::Propagator;
     using ostk::astrodynamics::trajectory::State;
@@ -29,6 +33,36 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
             )doc"
         );
 
+        class_<CheckpointStore> checkpoint_store_class(
+            propagated_class,
+            "CheckpointStore",
+            R"doc(
+                Store of propagated trajectory segments, answering state queries by interpolation.
+
+            )doc"
+        );
+
+        enum_<CheckpointStore::EvictionPolicy>(
+            checkpoint_store_class,
+            "EvictionPolicy",
+            R"doc(
+                Segment eviction policy.
+            )doc"
+        )
+
+            .value(
+                "LeastRecentlyUsed",
+                CheckpointStore::EvictionPolicy::LeastRecentlyUsed,
+                "Evict the segment that was queried the longest time ago."
+            )
+            .value(
+                "Farthest",
+                CheckpointStore::EvictionPolicy::Farthest,
+                "Evict the segment the farthest away from the segment being added."
+            )
+
+            ;
+
         propagated_class
 
             .def(
@@ -192,6 +226,64 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
                 )doc"
             )
 
+            .def(
+                "enable_checkpointing",
+                &Propagated::enableCheckpointing,
+                arg("segment_duration"),
+                arg("memory_budget"),
+                arg_v(
+                    "eviction_policy",
+                    CheckpointStore::EvictionPolicy::LeastRecentlyUsed,
+                    "CheckpointStore.EvictionPolicy.LeastRecentlyUsed"
+                ),
+                R"doc(
+                    Enable checkpointing.
+
+                    State queries are then answered by interpolation within segments of the given duration, aligned on
+                    the epoch. The first query in a segment propagates it, later ones reuse it.
+
+                    Args:
+                        segment_duration (Duration): The segment duration.
+                        memory_budget (int): The maximum memory used by the stored segments, in bytes.
+                        eviction_policy (CheckpointStore.EvictionPolicy, optional): The segment eviction policy. Defaults to LeastRecentlyUsed.
+
+                )doc"
+            )
+
+            .def(
+                "disable_checkpointing",
+                &Propagated::disableCheckpointing,
+                R"doc(
+                    Disable checkpointing, dropping the stored segments.
+
+                )doc"
+            )
+
+            .def(
+                "is_checkpointing_enabled",
+                &Propagated::isCheckpointingEnabled,
+                R"doc(
+                    Check if checkpointing is enabled.
+
+                    Returns:
+                        bool: True if checkpointing is enabled.
+
+                )doc"
+            )
+
+            .def(
+                "access_checkpoint_store",
+                &Propagated::accessCheckpointStore,
+                return_value_policy::reference_internal,
+                R"doc(
+                    Access the checkpoint store.
+
+                    Returns:
+                        CheckpointStore: The checkpoint store.
+
+                )doc"
+            )
+
             .def(
                 "to_tabulated",
                 &Propagated::toTabulated,
@@ -208,6 +300,173 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
                 )doc"
             )
 
+            ;
+
+        checkpoint_store_class
+
+            .def(
+                init<
+                    const Instant&,
+                    const Duration&,
+                    const Size&,
+                    const CheckpointStore::EvictionPolicy&,
+                    const Size&,
+                    const Real&>(),
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        epoch (Instant): The instant on which segments are aligned.
+                        segment_duration (Duration): The segment duration.
+                        memory_budget (int): The approximate maximum memory used by the stored segments and checkpoints, in bytes.
+                        eviction_policy (CheckpointStore.EvictionPolicy, optional): The eviction policy. Defaults to LeastRecentlyUsed.
+                        degree (int, optional): The degree of the interpolating polynomials. Defaults to 16.
+                        tolerance (float, optional): The interpolation error tolerance, relative to the largest magnitude of each coordinate over a segment. Defaults to 1e-12.
+
+                )doc",
+                arg("epoch"),
+                arg("segment_duration"),
+                arg("memory_budget"),
+                arg("eviction_policy") = CheckpointStore::EvictionPolicy::LeastRecentlyUsed,
+                arg("degree") = 16,
+                arg("tolerance") = 1e-12
+            )
+
+            .def(
+                "get_epoch",
+                &CheckpointStore::accessEpoch,
+                R"doc(
+                    Get the epoch on which segments are aligned.
+
+                    Returns:
+                        Instant: The epoch.
+
+                )doc"
+            )
+            .def(
+                "get_segment_duration",
+                &CheckpointStore::getSegmentDuration,
+                R"doc(
+                    Get the segment duration.
+
+                    Returns:
+                        Duration: The segment duration.
+
+                )doc"
+            )
+            .def(
+                "get_memory_budget",
+                &CheckpointStore::getMemoryBudget,
+                R"doc(
+                    Get the memory budget.
+
+                    Returns:
+                        int: The memory budget, in bytes.
+
+                )doc"
+            )
+            .def(
+                "get_eviction_policy",
+                &CheckpointStore::getEvictionPolicy,
+                R"doc(
+                    Get the eviction policy.
+
+                    Returns:
+                        CheckpointStore.EvictionPolicy: The eviction policy.
+
+                )doc"
+            )
+            .def(
+                "get_degree",
+                &CheckpointStore::getDegree,
+                R"doc(
+                    Get the degree of the interpolating polynomials.
+
+                    Returns:
+                        int: The degree.
+
+                )doc"
+            )
+            .def(
+                "get_tolerance",
+                &CheckpointStore::getTolerance,
+                R"doc(
+                    Get the relative interpolation error tolerance.
+
+                    Returns:
+                        float: The tolerance.
+
+                )doc"
+            )
+            .def(
+                "get_segment_count",
+                &CheckpointStore::getSegmentCount,
+                R"doc(
+                    Get the number of stored segments.
+
+                    Returns:
+                        int: The number of stored segments.
+
+                )doc"
+            )
+            .def(
+                "get_memory_usage",
+                &CheckpointStore::getMemoryUsage,
+                R"doc(
+                    Get the approximate memory used by the stored segments and checkpoints.
+
+                    Returns:
+                        int: The memory usage, in bytes.
+
+                )doc"
+            )
+            .def(
+                "get_hit_count",
+                &CheckpointStore::getHitCount,
+                R"doc(
+                    Get the number of queries answered from a stored segment.
+
+                    Returns:
+                        int: The hit count.
+
+                )doc"
+            )
+            .def(
+                "get_miss_count",
+                &CheckpointStore::getMissCount,
+                R"doc(
+                    Get the number of queries that required a propagation.
+
+                    Returns:
+                        int: The miss count.
+
+                )doc"
+            )
+            .def(
+                "clear",
+                &CheckpointStore::clear,
+                R"doc(
+                    Remove all stored segments and reset the statistics.
+
+                )doc"
+            )
+
+            .def_static(
+                "string_from_eviction_policy",
+                &CheckpointStore::StringFromEvictionPolicy,
+                R"doc(
+                    Get the string representation of an eviction policy.
+
+                    Args:
+                        eviction_policy (CheckpointStore.EvictionPolicy): The eviction policy.
+
+                    Returns:
+                        str: The string representation.
+
+                )doc",
+                arg("eviction_policy")
+            )
+
             ;
     }
 }
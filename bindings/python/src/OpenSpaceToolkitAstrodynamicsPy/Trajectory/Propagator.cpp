@@ -8,6 +8,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
     using ostk::core::container::Array;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::mathematics::curvefitting::Interpolator;
 
@@ -100,6 +101,10 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
             R"doc(
                 Access the numerical solver.
 
+                This is the configured numerical solver. Each calculation integrates with its own copy of it, so it
+                holds no observed states: use `calculate_state_at_with_observed_states` or
+                `calculate_state_to_condition_with_observed_states` to retrieve them.
+
                 Returns:
                     NumericalSolver&: The numerical solver.
 
@@ -182,12 +187,15 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
         .def(
             "calculate_state_at",
-            &Propagator::calculateStateAt,
+            overload_cast<const State&, const Instant&>(&Propagator::calculateStateAt, const_),
             arg("state"),
             arg("instant"),
+            call_guard<gil_scoped_release>(),
             R"doc(
                 Calculate the state at a given instant.
 
+                Can be called concurrently on the same propagator, from multiple threads.
+
                 Args:
                     state (State) The state.
                     instant (Instant) The instant.
@@ -199,7 +207,9 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
         )
         .def(
             "calculate_state_to_condition",
-            &Propagator::calculateStateToCondition,
+            overload_cast<const State&, const Instant&, const EventCondition&>(
+                &Propagator::calculateStateToCondition, const_
+            ),
             arg("state"),
             arg("instant"),
             arg("event_condition"),
@@ -216,15 +226,82 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
             )doc"
         )
+        .def(
+            "calculate_state_at_with_observed_states",
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const Instant& anInstant) -> std::pair<State, Array<State>>
+            {
+                Array<State> observedStates = Array<State>::Empty();
+                const State state = aPropagator.calculateStateAt(aState, anInstant, observedStates);
+
+                return {state, observedStates};
+            },
+            arg("state"),
+            arg("instant"),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Calculate the state at a given instant, along with the states observed by the numerical solver.
+
+                Each calculation integrates with its own copy of the numerical solver, so the observed states are only
+                available from this method: the solver returned by `access_numerical_solver` holds none.
+
+                Args:
+                    state (State) The state.
+                    instant (Instant) The instant.
+
+                Returns:
+                    tuple[State, list[State]]: The state at the given instant, and the observed states in the
+                    integration frame.
+
+            )doc"
+        )
+        .def(
+            "calculate_state_to_condition_with_observed_states",
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const Instant& anInstant,
+               const EventCondition& anEventCondition) -> std::pair<NumericalSolver::ConditionSolution, Array<State>>
+            {
+                Array<State> observedStates = Array<State>::Empty();
+                const NumericalSolver::ConditionSolution conditionSolution =
+                    aPropagator.calculateStateToCondition(aState, anInstant, anEventCondition, observedStates);
+
+                return {conditionSolution, observedStates};
+            },
+            arg("state"),
+            arg("instant"),
+            arg("event_condition"),
+            R"doc(
+                Calculate the state up to a given event condition, along with the states observed by the numerical
+                solver.
+
+                Each calculation integrates with its own copy of the numerical solver, so the observed states are only
+                available from this method: the solver returned by `access_numerical_solver` holds none.
+
+                Args:
+                    state (State) The state.
+                    instant (Instant) The instant.
+                    event_condition (EventCondition) The event condition.
+
+                Returns:
+                    tuple[ConditionSolution, list[State]]: The solution up to the given event condition, and the
+                    observed states in the integration frame.
+
+            )doc"
+        )
 
         .def(
             "calculate_states_at",
             &Propagator::calculateStatesAt,
             arg("state"),
             arg("instants"),
+            call_guard<gil_scoped_release>(),
             R"doc(
                 Calculate the states at given instants. It is more performant than looping `calculate_state_at` for multiple instants.
 
+                Can be called concurrently on the same propagator, from multiple threads.
+
                 Args:
                     state (State) The state.
                     instants (list[Instant]) The instants.
@@ -234,6 +311,139 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
             )doc"
         )
+        .def(
+            "can_calculate_state_transition_matrices",
+            &Propagator::canCalculateStateTransitionMatrices,
+            R"doc(
+                Check if the state transition matrices can be propagated, i.e. if all dynamics provide the Jacobian of
+                their contribution.
+
+                Returns:
+                    bool: True if the state transition matrices can be propagated.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_and_state_transition_matrices_at",
+            &Propagator::calculateStatesAndStateTransitionMatricesAt,
+            arg("state"),
+            arg("instants"),
+            R"doc(
+                Calculate the states and the state transition matrices at given instants, by integrating the variational
+                equations alongside the state.
+
+                The state transition matrices are expressed in the GCRF frame, with rows and columns ordered as the
+                coordinate subsets of the propagator.
+
+                Args:
+                    state (State) The state.
+                    instants (list[Instant]) The instants.
+
+                Returns:
+                    tuple[list[State], list[np.ndarray]]: The states and the state transition matrices at the given
+                    instants.
+
+            )doc"
+        )
+        .def(
+            "calculate_ensemble_state_at",
+            &Propagator::calculateEnsembleStateAt,
+            arg("states"),
+            arg("instant"),
+            arg("thread_count") = 0,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Calculate the state of each member of an ensemble at a given instant, propagating members concurrently.
+
+                Args:
+                    states (list[State]) The initial states of the ensemble members.
+                    instant (Instant) The instant.
+                    thread_count (int) The number of threads. Defaults to 0, which uses the hardware concurrency.
+
+                Returns:
+                    list[State]: The states at the given instant, one per member.
+
+            )doc"
+        )
+        .def(
+            "calculate_ensemble_states_at",
+            overload_cast<const Array<State>&, const Array<Instant>&, const Size&>(
+                &Propagator::calculateEnsembleStatesAt, const_
+            ),
+            arg("states"),
+            arg("instants"),
+            arg("thread_count") = 0,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Calculate the states of each member of an ensemble at given instants, propagating members concurrently.
+
+                Args:
+                    states (list[State]) The initial states of the ensemble members.
+                    instants (list[Instant]) The instants, shared by all members.
+                    thread_count (int) The number of threads. Defaults to 0, which uses the hardware concurrency.
+
+                Returns:
+                    list[list[State]]: The states at the given instants, one list per member.
+
+            )doc"
+        )
+        .def(
+            "calculate_ensemble_states_at",
+            overload_cast<const Array<State>&, const Array<Array<Instant>>&, const Size&>(
+                &Propagator::calculateEnsembleStatesAt, const_
+            ),
+            arg("states"),
+            arg("instant_arrays"),
+            arg("thread_count") = 0,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Calculate the states of each member of an ensemble at its own instants, propagating members concurrently.
+
+                Args:
+                    states (list[State]) The initial states of the ensemble members.
+                    instant_arrays (list[list[Instant]]) The instants of each member.
+                    thread_count (int) The number of threads. Defaults to 0, which uses the hardware concurrency.
+
+                Returns:
+                    list[list[State]]: The states at the given instants, one list per member.
+
+            )doc"
+        )
+
+        .def(
+            "calculate_batch_state_at",
+            &Propagator::calculateBatchStateAt,
+            arg("states"),
+            arg("instant"),
+            R"doc(
+                Calculate the state of each member of a batch at a given instant. All members must share the same initial instant, and are integrated together with a shared step.
+
+                Args:
+                    states (list[State]) The initial states of the batch members.
+                    instant (Instant) The instant.
+
+                Returns:
+                    list[State]: The states at the given instant, one per member.
+
+            )doc"
+        )
+        .def(
+            "calculate_batch_states_at",
+            &Propagator::calculateBatchStatesAt,
+            arg("states"),
+            arg("instants"),
+            R"doc(
+                Calculate the states of each member of a batch at given instants. All members must share the same initial instant, and are integrated together with a shared step.
+
+                Args:
+                    states (list[State]) The initial states of the batch members.
+                    instants (list[Instant]) The instants, shared by all members.
+
+                Returns:
+                    list[list[State]]: The states at the given instants, one list per member.
+
+            )doc"
+        )
 
         .def_static(
             "default",
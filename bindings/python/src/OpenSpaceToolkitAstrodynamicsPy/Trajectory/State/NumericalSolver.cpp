@@ -7,6 +7,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::type::Shared;
 
     using ostk::physics::time::Instant;
 
@@ -84,6 +85,119 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
 
         ;
 
+    class_<NumericalSolver::Profile, Shared<NumericalSolver::Profile>>(
+        numericalSolver,
+        "Profile",
+        R"doc(
+            Opt-in record of the cost of the solves performed by a numerical solver and its copies.
+
+            Records the number of evaluations of the system of equations, the accepted and rejected steps, the accepted
+            step sizes and the wall time of the solves, along with the wall time spent in each dynamics. Steps are recorded
+            where the solver takes them itself: in conditional integration and in the Sundman and Gauss-Jackson modes.
+            When integrating to a single instant otherwise, the accepted steps are recorded but not the rejected ones.
+
+        )doc"
+    )
+        .def(
+            init<>(),
+            R"doc(
+                Constructor.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<NumericalSolver::Profile>))
+        .def("__repr__", &(shiftToString<NumericalSolver::Profile>))
+
+        .def(
+            "get_solve_count",
+            &NumericalSolver::Profile::getSolveCount,
+            R"doc(
+                Get the number of recorded solves.
+
+                Returns:
+                    int: The solve count.
+            )doc"
+        )
+        .def(
+            "get_evaluation_count",
+            &NumericalSolver::Profile::getEvaluationCount,
+            R"doc(
+                Get the number of evaluations of the system of equations.
+
+                Returns:
+                    int: The evaluation count.
+            )doc"
+        )
+        .def(
+            "get_accepted_step_count",
+            &NumericalSolver::Profile::getAcceptedStepCount,
+            R"doc(
+                Get the number of accepted steps.
+
+                Returns:
+                    int: The accepted step count.
+            )doc"
+        )
+        .def(
+            "get_rejected_step_count",
+            &NumericalSolver::Profile::getRejectedStepCount,
+            R"doc(
+                Get the number of rejected steps.
+
+                Returns:
+                    int: The rejected step count.
+            )doc"
+        )
+        .def(
+            "get_step_sizes",
+            &NumericalSolver::Profile::getStepSizes,
+            R"doc(
+                Get the signed sizes of the accepted steps, in seconds, in the order they were taken.
+
+                Returns:
+                    list[float]: The step sizes.
+            )doc"
+        )
+        .def(
+            "get_duration",
+            &NumericalSolver::Profile::getDuration,
+            R"doc(
+                Get the wall time spent in the solves.
+
+                Returns:
+                    Duration: The solve duration.
+            )doc"
+        )
+        .def(
+            "get_evaluation_duration",
+            &NumericalSolver::Profile::getEvaluationDuration,
+            R"doc(
+                Get the wall time spent evaluating the system of equations.
+
+                Returns:
+                    Duration: The evaluation duration.
+            )doc"
+        )
+        .def(
+            "get_contribution_durations",
+            &NumericalSolver::Profile::getContributionDurations,
+            R"doc(
+                Get the wall time spent in each dynamics, in the order they were first recorded.
+
+                Returns:
+                    list[tuple[str, Duration]]: The dynamics names and durations.
+            )doc"
+        )
+        .def(
+            "reset",
+            &NumericalSolver::Profile::reset,
+            R"doc(
+                Reset the profile.
+            )doc"
+        )
+
+        ;
+
     {
         numericalSolver
 
@@ -173,6 +287,109 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                 )doc",
                 arg("maximum_step_size")
             )
+            .def(
+                "is_dense_output_enabled",
+                &NumericalSolver::isDenseOutputEnabled,
+                R"doc(
+                    Check whether dense output is enabled.
+
+                    Returns:
+                        bool: True if integrating to an array of instants uses dense output.
+                )doc"
+            )
+            .def(
+                "set_dense_output_enabled",
+                &NumericalSolver::setDenseOutputEnabled,
+                R"doc(
+                    Enable or disable dense output.
+
+                    When enabled, integrating to an array of instants steps through them once and interpolates the
+                    requested instants, instead of integrating from one instant to the next. Only supported by the
+                    RungeKuttaDopri5 and BulirschStoer steppers.
+
+                    Args:
+                        is_enabled (bool): True to enable dense output.
+                )doc",
+                arg("is_enabled")
+            )
+            .def(
+                "is_gauss_jackson_enabled",
+                &NumericalSolver::isGaussJacksonEnabled,
+                R"doc(
+                    Check whether Gauss-Jackson integration is enabled.
+
+                    Returns:
+                        bool: True if the 8th order Gauss-Jackson method is used.
+                )doc"
+            )
+            .def(
+                "set_gauss_jackson_enabled",
+                &NumericalSolver::setGaussJacksonEnabled,
+                R"doc(
+                    Enable or disable Gauss-Jackson integration.
+
+                    When enabled, the 8th order Gauss-Jackson summed multistep method integrates with a fixed step
+                    equal to the time step, with two evaluations of the dynamics per step. Positions are expected to
+                    be the first coordinates, followed by velocities. The method is started, and instants off the
+                    fixed step grid are reached, with a Runge-Kutta-Fehlberg 7(8) stepper using the solver
+                    tolerances. Cannot be combined with dense output.
+
+                    Args:
+                        is_enabled (bool): True to enable Gauss-Jackson integration.
+                )doc",
+                arg("is_enabled")
+            )
+            .def(
+                "get_sundman_exponent",
+                &NumericalSolver::getSundmanExponent,
+                R"doc(
+                    Get the exponent of the Sundman time transformation.
+
+                    Returns:
+                        Real: The exponent, or Real.undefined() if the transformation is disabled.
+                )doc"
+            )
+            .def(
+                "set_sundman_exponent",
+                &NumericalSolver::setSundmanExponent,
+                R"doc(
+                    Set the exponent of the Sundman time transformation, to efficiently integrate highly eccentric
+                    orbits.
+
+                    When set, the stepper steps in the regularized variable s defined by dt/ds = (r / r0)^exponent,
+                    where r is the norm of the first three coordinates (the position) and r0 its initial value, so
+                    that steps shorten around periapsis and lengthen around apoapsis. Instants between steps are
+                    reached by integrating in time. An exponent of 1.5 is a common choice. Not supported with
+                    Adams-Bashforth-Moulton steppers, and cannot be combined with dense output or Gauss-Jackson
+                    integration.
+
+                    Args:
+                        sundman_exponent (Real): The strictly positive exponent. Use Real.undefined() to disable the transformation.
+                )doc",
+                arg("sundman_exponent")
+            )
+            .def(
+                "get_profile",
+                &NumericalSolver::getProfile,
+                R"doc(
+                    Get the profile recording the solves.
+
+                    Returns:
+                        NumericalSolver.Profile: The profile, or None if profiling is disabled.
+                )doc"
+            )
+            .def(
+                "set_profile",
+                &NumericalSolver::setProfile,
+                R"doc(
+                    Set the profile recording the solves. Copies of the solver (e.g. the ones held by a propagator or
+                    a segment) record into the same profile.
+
+                    Args:
+                        profile (NumericalSolver.Profile): The profile, or None to disable profiling.
+                )doc",
+                arg("profile")
+            )
 
             .def(
                 "integrate_time",
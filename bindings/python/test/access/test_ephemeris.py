@@ -0,0 +1,90 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics import Environment
+from ostk.physics.coordinate import Frame
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.time import Scale
+from ostk.physics.unit import Angle
+from ostk.physics.unit import Length
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+from ostk.astrodynamics.access import Ephemeris
+
+
+@pytest.fixture
+def trajectory() -> Trajectory:
+    environment = Environment.default()
+    earth = environment.access_celestial_object_with_name("Earth")
+
+    epoch = Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+    coe = COE(
+        semi_major_axis=Length.kilometers(7000.0),
+        eccentricity=0.0,
+        inclination=Angle.degrees(45.0),
+        raan=Angle.degrees(0.0),
+        aop=Angle.degrees(0.0),
+        true_anomaly=Angle.degrees(0.0),
+    )
+
+    kepler = Kepler(
+        coe=coe,
+        epoch=epoch,
+        celestial_object=earth,
+        perturbation_type=Kepler.PerturbationType.No,
+    )
+
+    return Orbit(model=kepler, celestial_object=earth)
+
+
+@pytest.fixture
+def instants() -> list[Instant]:
+    return Interval.closed(
+        Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+        Instant.date_time(DateTime(2018, 1, 1, 1, 0, 0), Scale.UTC),
+    ).generate_grid(Duration.minutes(1.0))
+
+
+@pytest.fixture
+def ephemeris(trajectory: Trajectory, instants: list[Instant]) -> Ephemeris:
+    return Ephemeris(
+        trajectory=trajectory,
+        instants=instants,
+        frame=Frame.ITRF(),
+    )
+
+
+class TestEphemeris:
+    def test_constructor_success(self, trajectory: Trajectory, instants: list[Instant]):
+        ephemeris = Ephemeris(
+            trajectory=trajectory,
+            instants=instants,
+        )
+
+        assert isinstance(ephemeris, Ephemeris)
+        assert ephemeris.is_defined()
+        assert ephemeris.get_frame() == Frame.ITRF()
+
+    def test_constructor_failure(self, trajectory: Trajectory, instants: list[Instant]):
+        with pytest.raises(RuntimeError):
+            Ephemeris(
+                trajectory=trajectory,
+                instants=list(reversed(instants)),
+            )
+
+    def test_getters_success(self, ephemeris: Ephemeris, instants: list[Instant]):
+        assert ephemeris.get_trajectory() is not None
+        assert ephemeris.get_instants() == instants
+        assert ephemeris.get_size() == len(instants)
+        assert ephemeris.get_position_coordinates().shape == (3, len(instants))
+
+    def test_undefined_success(self):
+        assert not Ephemeris.undefined().is_defined()
@@ -8,6 +8,8 @@ from ostk.mathematics.object import RealInterval
 
 from ostk.physics.unit import Length
 from ostk.physics.unit import Angle
+from ostk.physics.unit import Derived
+from ostk.physics.unit import Time
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.time import Duration
@@ -27,6 +29,7 @@ from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
 from ostk.astrodynamics import Access
 from ostk.astrodynamics.access import Generator
 from ostk.astrodynamics.access import AccessTarget
+from ostk.astrodynamics.access import Ephemeris
 from ostk.astrodynamics.access import VisibilityCriterion
 
 
@@ -257,6 +260,8 @@ class TestGenerator:
         assert generator.get_tolerance() == Duration.microseconds(1.0)
         assert generator.get_access_filter() is not None
         assert generator.get_state_filter() is None
+        assert generator.get_thread_count() == 1
+        assert generator.get_horizon_prescreening()[0].is_defined() is False
 
     def test_get_condition_function_success(
         self,
@@ -318,6 +323,127 @@ class TestGenerator:
         assert isinstance(accesses[0], list)
         assert isinstance(accesses[0][0], Access)
 
+    def test_compute_accesses_multiple_trajectories_success(
+        self,
+        generator: Generator,
+        access_target: AccessTarget,
+        to_trajectory: Trajectory,
+    ):
+        accesses = generator.compute_accesses(
+            interval=Interval.closed(
+                Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+                Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+            ),
+            access_targets=[access_target],
+            to_trajectories=[to_trajectory, to_trajectory],
+        )
+
+        assert accesses is not None
+        assert isinstance(accesses, list)
+        assert len(accesses) == 2
+        assert isinstance(accesses[0], list)
+        assert len(accesses[0]) == 1
+        assert isinstance(accesses[0][0], list)
+        assert len(accesses[0][0]) == len(accesses[1][0])
+
+    def test_stream_accesses_success(
+        self,
+        generator: Generator,
+        access_target: AccessTarget,
+        to_trajectory: Trajectory,
+    ):
+        interval = Interval.closed(
+            Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+        )
+
+        expected_accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[access_target, access_target],
+            to_trajectory=to_trajectory,
+        )
+
+        streamed_accesses = [[], []]
+
+        generator.stream_accesses(
+            interval=interval,
+            access_targets=[access_target, access_target],
+            to_trajectory=to_trajectory,
+            callback=lambda target_index, access: streamed_accesses[target_index].append(
+                access
+            ),
+            window_duration=Duration.minutes(10.0),
+        )
+
+        for expected, streamed in zip(expected_accesses, streamed_accesses):
+            assert len(streamed) == len(expected)
+
+            for expected_access, streamed_access in zip(expected, streamed):
+                assert isinstance(streamed_access, Access)
+                assert (
+                    streamed_access.get_acquisition_of_signal()
+                    == expected_access.get_acquisition_of_signal()
+                )
+                assert (
+                    streamed_access.get_loss_of_signal()
+                    == expected_access.get_loss_of_signal()
+                )
+
+    def test_compute_accesses_with_ephemeris_success(
+        self,
+        generator: Generator,
+        access_target: AccessTarget,
+        to_trajectory: Trajectory,
+    ):
+        interval = Interval.closed(
+            Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+        )
+
+        ephemeris = generator.generate_ephemeris(
+            interval=interval,
+            trajectory=to_trajectory,
+        )
+
+        assert isinstance(ephemeris, Ephemeris)
+        assert ephemeris.is_defined()
+        assert ephemeris.get_size() == len(ephemeris.get_instants())
+        assert ephemeris.get_position_coordinates().shape == (3, ephemeris.get_size())
+
+        expected_accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[access_target, access_target],
+            to_trajectory=to_trajectory,
+        )
+
+        accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[access_target, access_target],
+            to_ephemeris=ephemeris,
+        )
+
+        access_table = generator.compute_accesses(
+            interval=interval,
+            access_targets=[access_target, access_target],
+            to_ephemerides=[ephemeris],
+        )
+
+        assert len(access_table) == 1
+
+        for accesses_per_target in (accesses, access_table[0]):
+            for expected, computed in zip(expected_accesses, accesses_per_target):
+                assert len(computed) == len(expected)
+
+                for expected_access, computed_access in zip(expected, computed):
+                    assert (
+                        computed_access.get_acquisition_of_signal()
+                        == expected_access.get_acquisition_of_signal()
+                    )
+                    assert (
+                        computed_access.get_loss_of_signal()
+                        == expected_access.get_loss_of_signal()
+                    )
+
     def test_set_step_success(self, generator: Generator):
         generator.set_step(Duration.seconds(1.0))
 
@@ -330,6 +456,113 @@ class TestGenerator:
     def test_set_state_filter_success(self, generator: Generator):
         generator.set_state_filter(state_filter=lambda state_1, state_2: True)
 
+    def test_set_batch_state_filter_success(
+        self,
+        generator: Generator,
+        access_target: AccessTarget,
+        to_trajectory: Trajectory,
+    ):
+        assert generator.get_batch_state_filter() is None
+
+        generator.set_batch_state_filter(
+            batch_state_filter=lambda to_state, from_states: [True] * len(from_states)
+        )
+
+        assert generator.get_batch_state_filter() is not None
+
+        interval = Interval.closed(
+            Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+        )
+
+        accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[access_target],
+            to_trajectory=to_trajectory,
+        )
+
+        assert len(accesses) == 1
+
+    def test_set_statistics_enabled_success(
+        self,
+        generator: Generator,
+        access_target: AccessTarget,
+        to_trajectory: Trajectory,
+    ):
+        assert generator.is_statistics_enabled() is False
+
+        generator.set_statistics_enabled(is_enabled=True)
+
+        assert generator.is_statistics_enabled() is True
+
+        interval = Interval.closed(
+            Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+        )
+
+        accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[access_target],
+            to_trajectory=to_trajectory,
+        )
+
+        statistics: Generator.Statistics = generator.get_statistics()
+
+        assert statistics.computation_count == 1
+        assert statistics.sample_count > 0
+        assert statistics.trajectory_evaluation_count > 0
+        assert statistics.access_count == len(accesses[0])
+        assert statistics.total_duration > Duration.zero()
+
+        generator.reset_statistics()
+
+        assert generator.get_statistics().computation_count == 0
+
+    def test_set_thread_count_success(self, generator: Generator):
+        generator.set_thread_count(thread_count=4)
+
+        assert generator.get_thread_count() == 4
+
+    def test_compute_accesses_multiple_threads_success(
+        self,
+        generator: Generator,
+        trajectory_target: AccessTarget,
+        to_trajectory: Trajectory,
+    ):
+        interval = Interval.closed(
+            Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+        )
+
+        serial_accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[trajectory_target, trajectory_target],
+            to_trajectory=to_trajectory,
+        )
+
+        generator.set_thread_count(thread_count=2)
+
+        parallel_accesses = generator.compute_accesses(
+            interval=interval,
+            access_targets=[trajectory_target, trajectory_target],
+            to_trajectory=to_trajectory,
+        )
+
+        assert len(parallel_accesses) == len(serial_accesses)
+
+        for serial, parallel in zip(serial_accesses, parallel_accesses):
+            assert len(parallel) == len(serial)
+
+    def test_set_horizon_prescreening_success(self, generator: Generator):
+        generator.set_horizon_prescreening(
+            maximum_altitude=Length.kilometers(600.0),
+            maximum_angular_rate=Derived(
+                1.3e-3, Derived.Unit.angular_velocity(Angle.Unit.Radian, Time.Unit.Second)
+            ),
+        )
+
+        assert generator.get_horizon_prescreening()[0] == Length.kilometers(600.0)
+
     def test_undefined_success(self):
         generator = Generator.undefined()
 
@@ -49,6 +49,19 @@ class TestCentralBodyGravity:
     def test_getters(self, dynamics: CentralBodyGravity, earth: Earth):
         assert dynamics.get_celestial() == earth
 
+    def test_set_truncation_tolerance(self, dynamics: CentralBodyGravity):
+        assert dynamics.get_truncation_tolerance().is_defined() is False
+
+        with pytest.raises(RuntimeError):
+            dynamics.set_truncation_tolerance(1.0e-9)
+
+        egm96_dynamics = CentralBodyGravity(Earth.EGM96(20, 20))
+        egm96_dynamics.set_truncation_tolerance(1.0e-9)
+
+        assert egm96_dynamics.get_truncation_tolerance() == 1.0e-9
+        assert egm96_dynamics.get_truncation_degree_at(7000000.0) == 20
+        assert egm96_dynamics.get_truncation_degree_at(42164000.0) < 20
+
     def test_compute_contribution(self, dynamics: CentralBodyGravity, state: State):
         contribution = dynamics.compute_contribution(
             state.get_instant(), state.get_coordinates(), state.get_frame()
@@ -56,3 +69,31 @@ class TestCentralBodyGravity:
 
         assert len(contribution) == 3
         assert contribution == pytest.approx([-8.134702887755102, 0.0, 0.0])
+
+    def test_compute_contributions(self, dynamics: CentralBodyGravity, state: State):
+        position = state.get_coordinates()[:3]
+        state_matrix = np.array([position, 2.0 * position])
+
+        contributions = dynamics.compute_contributions(
+            state.get_instant(), state_matrix, state.get_frame()
+        )
+
+        assert contributions.shape == (2, 3)
+        assert contributions[0] == pytest.approx([-8.134702887755102, 0.0, 0.0])
+        assert contributions[1] == pytest.approx([-8.134702887755102 / 4.0, 0.0, 0.0])
+
+    def test_compute_contribution_jacobian(
+        self, dynamics: CentralBodyGravity, state: State
+    ):
+        assert dynamics.has_contribution_jacobian()
+
+        jacobian = dynamics.compute_contribution_jacobian(
+            state.get_instant(), state.get_coordinates()[:3], state.get_frame()
+        )
+
+        assert jacobian.shape == (3, 3)
+
+        gravity_gradient: float = 8.134702887755102 / 7000000.0
+        assert np.diag(jacobian) == pytest.approx(
+            [2.0 * gravity_gradient, -gravity_gradient, -gravity_gradient]
+        )
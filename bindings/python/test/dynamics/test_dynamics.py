@@ -3,6 +3,7 @@
 import pytest
 
 from ostk.physics import Environment
+from ostk.physics.time import Duration
 
 from ostk.astrodynamics import Dynamics
 from ostk.astrodynamics.trajectory.state.coordinate_subset import CartesianPosition
@@ -43,6 +44,28 @@ class TestDynamics:
     def test_get_name(self, dynamics: Dynamics, name: str):
         assert dynamics.get_name() == name
 
+    def test_set_multi_rate_evaluation(self, dynamics: Dynamics):
+        assert dynamics.is_multi_rate_evaluation_enabled() is False
+        assert dynamics.get_multi_rate_maximum_interval().is_defined() is False
+        assert dynamics.get_multi_rate_tolerance().is_defined() is False
+
+        dynamics.set_multi_rate_evaluation(Duration.minutes(2.0), 1.0e-9)
+
+        assert dynamics.is_multi_rate_evaluation_enabled() is True
+        assert dynamics.get_multi_rate_maximum_interval() == Duration.minutes(2.0)
+        assert dynamics.get_multi_rate_tolerance() == 1.0e-9
+
+        with pytest.raises(RuntimeError):
+            dynamics.set_multi_rate_evaluation(Duration.zero(), 1.0e-9)
+
+        with pytest.raises(RuntimeError):
+            dynamics.set_multi_rate_evaluation(Duration.undefined(), 1.0e-9)
+
+        dynamics.disable_multi_rate_evaluation()
+
+        assert dynamics.is_multi_rate_evaluation_enabled() is False
+        assert dynamics.get_multi_rate_tolerance().is_defined() is False
+
     def test_from_environment(self, environment: Environment):
         dynamics: list[Dynamics] = Dynamics.from_environment(environment)
 
@@ -6,15 +6,19 @@ import numpy as np
 
 from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Interval
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
 from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
 from ostk.physics.environment.object.celestial import Moon
+from ostk.physics.unit import Length
 
 from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics import Dynamics
 from ostk.astrodynamics.dynamics import ThirdBodyGravity
+from ostk.astrodynamics.dynamics.third_body_gravity import ChebyshevEphemeris
 
 
 @pytest.fixture
@@ -65,3 +69,35 @@ class TestThirdBodyGravity:
         assert contribution == pytest.approx(
             [-4.620543790697659e-07, 2.948717888154649e-07, 1.301648617451192e-07]
         )
+
+    def test_compute_contribution_with_ephemeris(
+        self,
+        dynamics: ThirdBodyGravity,
+        moon: Moon,
+        state: State,
+    ):
+        ephemeris = ChebyshevEphemeris(
+            moon,
+            Interval.closed(state.get_instant(), state.get_instant() + Duration.days(1.0)),
+            Length.meters(1.0),
+        )
+
+        assert ephemeris.is_defined()
+        assert ephemeris.contains(state.get_instant())
+        assert ephemeris.get_segment_count() >= 1
+
+        interpolated_dynamics = ThirdBodyGravity(moon, ephemeris)
+
+        assert dynamics.get_ephemeris() is None
+        assert interpolated_dynamics.get_ephemeris() is not None
+
+        contribution = interpolated_dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+
+        assert contribution == pytest.approx(
+            dynamics.compute_contribution(
+                state.get_instant(), state.get_coordinates(), state.get_frame()
+            ),
+            rel=1e-6,
+        )
@@ -219,6 +219,14 @@ class TestOrbitDeterminationSolver:
         assert isinstance(orbit_determination_solver.access_propagator(), Propagator)
         assert isinstance(orbit_determination_solver.access_solver(), LeastSquaresSolver)
         assert isinstance(orbit_determination_solver.access_estimation_frame(), Frame)
+        assert orbit_determination_solver.is_state_transition_matrix_propagated() is False
+
+    def test_constructor_with_state_transition_matrix_propagated(self):
+        orbit_determination_solver = OrbitDeterminationSolver(
+            is_state_transition_matrix_propagated=True,
+        )
+
+        assert orbit_determination_solver.is_state_transition_matrix_propagated() is True
 
     def test_estimate(
         self,
@@ -228,6 +228,46 @@ class TestPropagated:
         with pytest.raises(Exception) as e:
             propagated.set_cached_state_array([])
 
+    def test_checkpointing(
+        self,
+        propagated: Propagated,
+        state: State,
+    ):
+        assert propagated.is_checkpointing_enabled() is False
+
+        propagated.enable_checkpointing(
+            segment_duration=Duration.minutes(10.0),
+            memory_budget=64000000,
+            eviction_policy=Propagated.CheckpointStore.EvictionPolicy.Farthest,
+        )
+
+        assert propagated.is_checkpointing_enabled() is True
+
+        checkpoint_store = propagated.access_checkpoint_store()
+
+        assert checkpoint_store.get_segment_duration() == Duration.minutes(10.0)
+        assert checkpoint_store.get_memory_budget() == 64000000
+        assert checkpoint_store.get_tolerance() == 1e-12
+        assert (
+            checkpoint_store.get_eviction_policy()
+            == Propagated.CheckpointStore.EvictionPolicy.Farthest
+        )
+
+        instant_array = [
+            state.get_instant() + Duration.minutes(float(offset)) for offset in range(30)
+        ]
+
+        propagated.calculate_states_at(instant_array)
+        propagated.calculate_states_at(instant_array)
+
+        assert checkpoint_store.get_segment_count() == 3
+        assert checkpoint_store.get_miss_count() == 3
+        assert checkpoint_store.get_hit_count() == 57
+
+        propagated.disable_checkpointing()
+
+        assert propagated.is_checkpointing_enabled() is False
+
     def test_to_tabulated(
         self,
         propagated: Propagated,
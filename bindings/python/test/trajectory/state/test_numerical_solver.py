@@ -168,6 +168,63 @@ class TestNumericalSolver:
         numerical_solver.set_maximum_step_size(Real.undefined())
         assert numerical_solver.get_maximum_step_size().is_defined() is False
 
+    def test_set_and_is_dense_output_enabled_success(
+        self,
+        log_type: NumericalSolver.LogType,
+        initial_time_step: float,
+        relative_tolerance: float,
+        absolute_tolerance: float,
+    ):
+        numerical_solver = NumericalSolver(
+            log_type=log_type,
+            stepper_type=NumericalSolver.StepperType.RungeKuttaDopri5,
+            time_step=initial_time_step,
+            relative_tolerance=relative_tolerance,
+            absolute_tolerance=absolute_tolerance,
+        )
+
+        assert numerical_solver.is_dense_output_enabled() is False
+
+        numerical_solver.set_dense_output_enabled(True)
+        assert numerical_solver.is_dense_output_enabled() is True
+
+        numerical_solver.set_dense_output_enabled(False)
+        assert numerical_solver.is_dense_output_enabled() is False
+
+    def test_set_dense_output_enabled_failure(
+        self, numerical_solver: NumericalSolver
+    ):
+        with pytest.raises(RuntimeError):
+            numerical_solver.set_dense_output_enabled(True)
+
+    def test_set_and_is_gauss_jackson_enabled_success(
+        self, numerical_solver: NumericalSolver
+    ):
+        assert numerical_solver.is_gauss_jackson_enabled() is False
+
+        numerical_solver.set_gauss_jackson_enabled(True)
+        assert numerical_solver.is_gauss_jackson_enabled() is True
+
+        with pytest.raises(RuntimeError):
+            numerical_solver.set_dense_output_enabled(True)
+
+        numerical_solver.set_gauss_jackson_enabled(False)
+        assert numerical_solver.is_gauss_jackson_enabled() is False
+
+    def test_set_and_get_sundman_exponent_success(
+        self, numerical_solver: NumericalSolver
+    ):
+        assert numerical_solver.get_sundman_exponent().is_defined() is False
+
+        numerical_solver.set_sundman_exponent(1.5)
+        assert numerical_solver.get_sundman_exponent() == 1.5
+
+        with pytest.raises(RuntimeError):
+            numerical_solver.set_gauss_jackson_enabled(True)
+
+        numerical_solver.set_sundman_exponent(Real.undefined())
+        assert numerical_solver.get_sundman_exponent().is_defined() is False
+
     def test_get_string_from_types(self):
         assert (
             NumericalSolver.string_from_stepper_type(
@@ -265,6 +322,42 @@ class TestNumericalSolver:
         assert 5e-9 >= abs(state_vector[0] - math.sin(time))
         assert 5e-9 >= abs(state_vector[1] - math.cos(time))
 
+    def test_set_and_get_profile_success(
+        self,
+        initial_state: State,
+        numerical_solver_conditional: NumericalSolver,
+        custom_condition: RealCondition,
+    ):
+        assert numerical_solver_conditional.get_profile() is None
+
+        profile = NumericalSolver.Profile()
+        numerical_solver_conditional.set_profile(profile)
+
+        assert numerical_solver_conditional.get_profile() is profile
+
+        numerical_solver_conditional.integrate_time(
+            initial_state,
+            initial_state.get_instant() + Duration.seconds(100.0),
+            oscillator,
+            custom_condition,
+        )
+
+        assert profile.get_solve_count() == 1
+        assert profile.get_evaluation_count() > 0
+        assert profile.get_accepted_step_count() == len(profile.get_step_sizes())
+        assert profile.get_rejected_step_count() >= 0
+        assert profile.get_duration() >= profile.get_evaluation_duration()
+        assert profile.get_contribution_durations() == []
+
+        profile.reset()
+
+        assert profile.get_solve_count() == 0
+        assert profile.get_evaluation_count() == 0
+
+        numerical_solver_conditional.set_profile(None)
+
+        assert numerical_solver_conditional.get_profile() is None
+
     def test_integrate_conditional_with_logger(
         self,
         initial_state: State,
@@ -1,5 +1,7 @@
 # Apache License 2.0
 
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 
 import numpy as np
@@ -386,6 +388,45 @@ class TestPropagator:
             (solution.state.get_instant() - state.get_instant()).in_seconds()
         )
 
+    def test_calculate_state_at_with_observed_states(
+        self, propagator: Propagator, state: State
+    ):
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        propagator_state, observed_states = (
+            propagator.calculate_state_at_with_observed_states(state, instant)
+        )
+
+        assert propagator_state == propagator.calculate_state_at(state, instant)
+        assert isinstance(observed_states, list)
+
+    def test_calculate_state_to_condition_with_observed_states(
+        self,
+        conditional_numerical_solver: NumericalSolver,
+        dynamics: list[Dynamics],
+        state: State,
+        event_condition: InstantCondition,
+    ):
+        propagator: Propagator = Propagator(conditional_numerical_solver, dynamics)
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        solution, observed_states = (
+            propagator.calculate_state_to_condition_with_observed_states(
+                state=state,
+                instant=instant,
+                event_condition=event_condition,
+            )
+        )
+
+        assert solution.condition_is_satisfied
+        assert len(observed_states) > 1
+        assert observed_states[0].get_instant() == state.get_instant()
+        assert observed_states[-1].get_instant() >= solution.state.get_instant()
+
+        # The accessed numerical solver is copied for each calculation, and never integrated with
+        assert propagator.access_numerical_solver().get_observed_states() == []
+
     def test_calculate_states_at(self, propagator: Propagator, state: State):
         instant_array = [
             Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
@@ -398,6 +439,115 @@ class TestPropagator:
             instant_array.reverse()
             propagator.calculate_states_at(state, instant_array)
 
+    def test_calculate_states_and_state_transition_matrices_at(
+        self,
+        propagator: Propagator,
+        thrust_dynamics: Thruster,
+        numerical_solver: NumericalSolver,
+        dynamics: list[Dynamics],
+        state: State,
+    ):
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+        ]
+
+        assert propagator.can_calculate_state_transition_matrices()
+
+        states, state_transition_matrices = (
+            propagator.calculate_states_and_state_transition_matrices_at(
+                state, instant_array
+            )
+        )
+
+        assert len(states) == 2
+        assert len(state_transition_matrices) == 2
+        assert state_transition_matrices[0].shape == (6, 6)
+
+        assert not Propagator(
+            numerical_solver, dynamics + [thrust_dynamics]
+        ).can_calculate_state_transition_matrices()
+
+    def test_calculate_ensemble_states_at(self, propagator: Propagator, state: State):
+        instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+        ]
+        states = [state, state]
+
+        ensemble_states = propagator.calculate_ensemble_state_at(states, instant)
+
+        assert len(ensemble_states) == 2
+        assert ensemble_states[0] == propagator.calculate_state_at(state, instant)
+        assert ensemble_states[1] == ensemble_states[0]
+
+        ensemble_state_arrays = propagator.calculate_ensemble_states_at(
+            states=states,
+            instants=instant_array,
+            thread_count=2,
+        )
+
+        assert len(ensemble_state_arrays) == 2
+        assert ensemble_state_arrays[0] == propagator.calculate_states_at(
+            state, instant_array
+        )
+
+        ensemble_state_arrays = propagator.calculate_ensemble_states_at(
+            states=states,
+            instant_arrays=[instant_array, []],
+        )
+
+        assert len(ensemble_state_arrays[0]) == 2
+        assert len(ensemble_state_arrays[1]) == 0
+
+        with pytest.raises(RuntimeError):
+            propagator.calculate_ensemble_states_at(
+                states=states,
+                instant_arrays=[instant_array],
+            )
+
+    def test_calculate_state_at_concurrently(self, propagator: Propagator, state: State):
+        instants = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, minute, 0), Scale.UTC)
+            for minute in range(1, 9)
+        ]
+
+        expected_states = [
+            propagator.calculate_state_at(state, instant) for instant in instants
+        ]
+
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            states = list(
+                executor.map(
+                    lambda instant: propagator.calculate_state_at(state, instant),
+                    instants,
+                )
+            )
+
+        assert states == expected_states
+
+    def test_calculate_batch_states_at(self, propagator: Propagator, state: State):
+        instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+        ]
+        states = [state, state]
+
+        batch_states = propagator.calculate_batch_state_at(states, instant)
+
+        assert len(batch_states) == 2
+        assert batch_states[0].get_instant() == instant
+
+        batch_state_arrays = propagator.calculate_batch_states_at(
+            states=states,
+            instants=instant_array,
+        )
+
+        assert len(batch_state_arrays) == 2
+        assert len(batch_state_arrays[0]) == 2
+
     def test_calculate_states_at_with_drag(
         self,
         numerical_solver: NumericalSolver,
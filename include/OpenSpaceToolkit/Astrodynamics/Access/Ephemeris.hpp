@@ -0,0 +1,140 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_Ephemeris__
+#define __OpenSpaceToolkit_Astrodynamics_Access_Ephemeris__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::Trajectory;
+
+/// @brief Observer trajectory tabulated in a body-fixed frame, for reuse across access computations.
+///
+/// @details Holds a trajectory along with the coordinates of its position, expressed in a given frame (ITRF by
+/// default), at a sorted set of instants. Building it evaluates the trajectory and transforms the positions once, so
+/// that several access computations for the same observer (e.g. one per batch of targets) do not pay for it again.
+/// The Generator reads the observer position from the table at every grid instant it contains, and only evaluates
+/// the trajectory at other instants (crossing refinement, access properties, state filter).
+class Ephemeris
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = {trajectory, interval.generateGrid(Duration::Minutes(1.0)), Frame::ITRF()};
+    /// @endcode
+    ///
+    /// @param aTrajectory The observer trajectory.
+    /// @param someInstants The instants at which the trajectory is tabulated, in strictly ascending order.
+    /// @param aFrameSPtr The frame in which the positions are expressed. Defaults to ITRF.
+    Ephemeris(
+        const Trajectory& aTrajectory,
+        const Array<Instant>& someInstants,
+        const Shared<const Frame>& aFrameSPtr = Frame::ITRF()
+    );
+
+    /// @brief Check whether this Ephemeris is defined.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = { ... };
+    ///     bool defined = ephemeris.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the Ephemeris is defined, false otherwise.
+    bool isDefined() const;
+
+    /// @brief Access the observer trajectory.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = { ... };
+    ///     const Trajectory& trajectory = ephemeris.accessTrajectory();
+    /// @endcode
+    ///
+    /// @return The observer trajectory.
+    const Trajectory& accessTrajectory() const;
+
+    /// @brief Access the tabulated instants.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = { ... };
+    ///     const Array<Instant>& instants = ephemeris.accessInstants();
+    /// @endcode
+    ///
+    /// @return The tabulated instants, in ascending order.
+    const Array<Instant>& accessInstants() const;
+
+    /// @brief Access the tabulated position coordinates.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = { ... };
+    ///     const MatrixXd& positionCoordinates = ephemeris.accessPositionCoordinates();
+    /// @endcode
+    ///
+    /// @return The position coordinates [m], one column per instant.
+    const MatrixXd& accessPositionCoordinates() const;
+
+    /// @brief Access the frame of the tabulated positions.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = { ... };
+    ///     Shared<const Frame> frameSPtr = ephemeris.accessFrame();
+    /// @endcode
+    ///
+    /// @return The frame of the tabulated positions.
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Get the number of tabulated instants.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = { ... };
+    ///     Size size = ephemeris.getSize();
+    /// @endcode
+    ///
+    /// @return The number of tabulated instants.
+    Size getSize() const;
+
+    /// @brief Construct an undefined Ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = Ephemeris::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined Ephemeris.
+    static Ephemeris Undefined();
+
+   private:
+    Trajectory trajectory_;
+    Array<Instant> instants_;
+    MatrixXd positionCoordinates_;
+    Shared<const Frame> frameSPtr_;
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,78 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_FlattenedAzimuthElevationMasks__
+#define __OpenSpaceToolkit_Astrodynamics_Access_FlattenedAzimuthElevationMasks__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/VisibilityCriterion.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Interval;
+
+/// @brief Azimuth-elevation masks of several targets, flattened into contiguous breakpoint buffers.
+///
+/// @details Used by the access generator to test many fixed targets at once. Breakpoints of target i are stored in
+/// [offsets[i], offsets[i + 1]), sorted by azimuth and covering [0, 2pi], as normalized by
+/// VisibilityCriterion::AERMask.
+class FlattenedAzimuthElevationMasks
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///     FlattenedAzimuthElevationMasks masks = {someAERMasks};
+    /// @endcode
+    ///
+    /// @param someAERMasks The AER masks, one per target
+    FlattenedAzimuthElevationMasks(const Array<VisibilityCriterion::AERMask>& someAERMasks);
+
+    /// @brief Get the number of targets
+    ///
+    /// @return The number of targets
+    Size getTargetCount() const;
+
+    /// @brief Same test as VisibilityCriterion::AERMask::isSatisfied, for target aTargetIndex.
+    ///
+    /// @details The azimuth is expected in [0, 2pi] and the elevation in [-pi/2, pi/2], in which case no reduction
+    /// is applied.
+    ///
+    /// @param aTargetIndex The target index
+    /// @param anAzimuth_rad The azimuth [rad]
+    /// @param anElevation_rad The elevation [rad]
+    /// @param aRange_m The range [m]
+    /// @return True if the mask of the target is satisfied
+    bool isSatisfied(
+        const Index& aTargetIndex, const double& anAzimuth_rad, const double& anElevation_rad, const double& aRange_m
+    ) const;
+
+   private:
+    std::vector<double> azimuths_rad_;
+    std::vector<double> elevations_rad_;
+    std::vector<Index> offsets_;
+    std::vector<Interval<Real>> ranges_;
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
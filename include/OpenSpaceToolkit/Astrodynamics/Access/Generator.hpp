@@ -3,10 +3,14 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Access_Generator__
 #define __OpenSpaceToolkit_Astrodynamics_Access_Generator__
 
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -15,10 +19,12 @@
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/Ephemeris.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Access/VisibilityCriterion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
 
@@ -32,8 +38,10 @@ namespace access
 using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::container::Pair;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::object::Interval;
 using ostk::mathematics::object::Matrix3d;
@@ -47,10 +55,12 @@ using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Angle;
+using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::Ephemeris;
 using ostk::astrodynamics::access::VisibilityCriterion;
 using ostk::astrodynamics::Trajectory;
 using ostk::astrodynamics::trajectory::State;
@@ -207,6 +217,37 @@ class AccessTarget
 class Generator
 {
    public:
+    /// @brief Counters and timers of the access computations run by a Generator, per stage.
+    ///
+    /// @details Stages are the sampling of the grid (observer and target states, frame transforms, visibility
+    /// criteria and state filters), the refinement of the crossings found on the grid, and the generation of the
+    /// accesses (time of closest approach and maximum elevation search). For trajectory targets, crossings are
+    /// refined by the temporal condition solver while sampling, so that their counters are collected with the samples
+    /// and the refinement duration remains zero. Stage durations are summed over threads: with more than one thread,
+    /// they can exceed the total duration, which is the wall-clock time of the computations.
+    struct Statistics
+    {
+        Size computationCount = 0;                       ///< Number of access computations
+        Size sampleCount = 0;                            ///< Number of (observer, grid instant) samples evaluated
+        Size trajectoryEvaluationCount = 0;              ///< Number of trajectory state evaluations, across all stages
+        Size ephemerisLookupCount = 0;                   ///< Number of observer positions read from an ephemeris
+        Size frameTransformCount = 0;                    ///< Number of frame transforms computed, across all stages
+        Size crossingCount = 0;                          ///< Number of crossings refined
+        Size rootSolverIterationCount = 0;               ///< Number of root solver iterations, across all crossings
+        Size closestApproachEvaluationCount = 0;         ///< Number of range evaluations by the closest approach search
+        Size accessCount = 0;                            ///< Number of accesses generated, before the access filter
+        Duration samplingDuration = Duration::Zero();    ///< Time spent sampling the grid
+        Duration refinementDuration = Duration::Zero();  ///< Time spent refining crossings
+        Duration generationDuration = Duration::Zero();  ///< Time spent generating accesses
+        Duration totalDuration = Duration::Zero();       ///< Wall-clock time of the computations
+
+        /// @brief Add the counters and timers of other statistics to these.
+        ///
+        /// @param someStatistics The statistics to add.
+        /// @return A reference to these statistics.
+        Statistics& operator+=(const Statistics& someStatistics);
+    };
+
     /// @brief Constructor.
     ///
     /// @code{.cpp}
@@ -287,6 +328,62 @@ class Generator
     /// @return The state filter function, or an empty function if none was set.
     std::function<bool(const State&, const State&)> getStateFilter() const;
 
+    /// @brief Get the batch state filter predicate.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     std::function<Array<bool>(const State&, const Array<State>&)> filter = generator.getBatchStateFilter();
+    /// @endcode
+    ///
+    /// @return The batch state filter function, or an empty function if none was set.
+    std::function<Array<bool>(const State&, const Array<State>&)> getBatchStateFilter() const;
+
+    /// @brief Get the number of threads used to compute accesses.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     Size threadCount = generator.getThreadCount();
+    /// @endcode
+    ///
+    /// @return The thread count.
+    Size getThreadCount() const;
+
+    /// @brief Get the horizon pre-screening bounds.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     const auto [maximumAltitude, maximumAngularRate] = generator.getHorizonPrescreening();
+    /// @endcode
+    ///
+    /// @return The maximum observer altitude and angular rate, both undefined if pre-screening is disabled.
+    Pair<Length, Derived> getHorizonPrescreening() const;
+
+    /// @brief Check whether statistics are collected.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     bool enabled = generator.isStatisticsEnabled();
+    /// @endcode
+    ///
+    /// @return True if statistics are collected, false otherwise.
+    bool isStatisticsEnabled() const;
+
+    /// @brief Get the statistics collected since they were enabled or last reset.
+    ///
+    /// @details The counters are those of the work actually performed, which depends on how it is split: with more
+    /// than one thread, frame transforms can be shared by several observers and evaluations repeated at the
+    /// boundaries of work items, so that they can differ from the counters of the same computation on one thread.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.setStatisticsEnabled(true);
+    ///     generator.computeAccesses( ... );
+    ///     Generator::Statistics statistics = generator.getStatistics();
+    /// @endcode
+    ///
+    /// @return The statistics, accumulated over all computations.
+    Statistics getStatistics() const;
+
     /// @brief Get a boolean condition function that evaluates visibility at a given instant.
     ///
     /// @details Returns a callable that, when invoked with an Instant, evaluates whether the
@@ -361,6 +458,145 @@ class Generator
         const bool& coarse = false
     ) const;
 
+    /// @brief Compute accesses between multiple access targets and multiple trajectories over a time interval.
+    ///
+    /// @details Equivalent to calling the multi-target overload once per trajectory, but for fixed targets the
+    /// sampling grid, the target positions and SEZ rotations, and the per-instant GCRF to body-fixed transforms are
+    /// computed once and shared across all trajectories. Returns a table indexed as [trajectory][target].
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     Array<Array<Array<Access>>> accessTable = generator.computeAccesses(
+    ///         interval, accessTargets, toTrajectories
+    ///     );
+    ///     const Array<Access>& accesses = accessTable[satelliteIndex][targetIndex];
+    /// @endcode
+    ///
+    /// @param anInterval The time interval over which to compute accesses.
+    /// @param someAccessTargets The array of access targets to evaluate visibility against.
+    /// @param someToTrajectories The trajectories of the observers (e.g. satellites of a constellation).
+    /// @param coarse If true, skips precise crossing refinement and returns coarse intervals only.
+    /// Defaults to false.
+    /// @return An array (one per trajectory, in the same order as someToTrajectories) of access arrays (one per
+    /// access target, in the same order as someAccessTargets).
+    Array<Array<Array<Access>>> computeAccesses(
+        const physics::time::Interval& anInterval,
+        const Array<AccessTarget>& someAccessTargets,
+        const Array<Trajectory>& someToTrajectories,
+        const bool& coarse = false
+    ) const;
+
+    /// @brief Compute accesses between multiple access targets and a tabulated observer over a time interval.
+    ///
+    /// @details Equivalent to the multi-target overload called with the ephemeris trajectory, except that for fixed
+    /// targets the observer position is read from the ephemeris at every grid instant it tabulates, rather than
+    /// evaluated and transformed again. Build the ephemeris once with generateEphemeris, and reuse it across batches
+    /// of targets. The ephemeris is read in place, neither it nor its trajectory is copied.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     const Ephemeris ephemeris = generator.generateEphemeris(interval, toTrajectory);
+    ///     Array<Array<Access>> allAccesses = generator.computeAccesses(
+    ///         interval, accessTargets, ephemeris
+    ///     );
+    /// @endcode
+    ///
+    /// @param anInterval The time interval over which to compute accesses.
+    /// @param someAccessTargets The array of access targets to evaluate visibility against.
+    /// @param aToEphemeris The ephemeris of the observer (e.g. satellite), in the central celestial object frame.
+    /// @param coarse If true, skips precise crossing refinement and returns coarse intervals only.
+    /// Defaults to false.
+    /// @return An array of access arrays, one per access target, in the same order as
+    /// someAccessTargets.
+    Array<Array<Access>> computeAccesses(
+        const physics::time::Interval& anInterval,
+        const Array<AccessTarget>& someAccessTargets,
+        const Ephemeris& aToEphemeris,
+        const bool& coarse = false
+    ) const;
+
+    /// @brief Compute accesses between multiple access targets and multiple tabulated observers over a time interval.
+    ///
+    /// @details Equivalent to the multi-trajectory overload called with the ephemeris trajectories, with observer
+    /// positions read from the ephemerides as in the single-ephemeris overload. Returns a table indexed as
+    /// [ephemeris][target].
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     Array<Array<Array<Access>>> accessTable = generator.computeAccesses(
+    ///         interval, accessTargets, toEphemerides
+    ///     );
+    /// @endcode
+    ///
+    /// @param anInterval The time interval over which to compute accesses.
+    /// @param someAccessTargets The array of access targets to evaluate visibility against.
+    /// @param someToEphemerides The ephemerides of the observers, in the central celestial object frame.
+    /// @param coarse If true, skips precise crossing refinement and returns coarse intervals only.
+    /// Defaults to false.
+    /// @return An array (one per ephemeris, in the same order as someToEphemerides) of access arrays (one per access
+    /// target, in the same order as someAccessTargets).
+    Array<Array<Array<Access>>> computeAccesses(
+        const physics::time::Interval& anInterval,
+        const Array<AccessTarget>& someAccessTargets,
+        const Array<Ephemeris>& someToEphemerides,
+        const bool& coarse = false
+    ) const;
+
+    /// @brief Generate the ephemeris of an observer on the sampling grid of an interval.
+    ///
+    /// @details The trajectory is tabulated at the instants sampled by computeAccesses (and streamAccesses) over
+    /// anInterval, in the central celestial object frame. It can be reused for any batch of targets, and for any
+    /// sub-interval starting at a grid instant. Grid instants it does not tabulate (e.g. after a change of step) fall
+    /// back to evaluating the trajectory.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     const Ephemeris ephemeris = generator.generateEphemeris(interval, toTrajectory);
+    /// @endcode
+    ///
+    /// @param anInterval The time interval over which to tabulate the trajectory.
+    /// @param aTrajectory The trajectory of the observer (e.g. satellite).
+    /// @return The ephemeris of the observer.
+    Ephemeris generateEphemeris(const physics::time::Interval& anInterval, const Trajectory& aTrajectory) const;
+
+    /// @brief Stream accesses between multiple fixed access targets and a trajectory over a time interval.
+    ///
+    /// @details The interval is scanned in consecutive windows of (about) aWindowDuration, rounded down to a whole
+    /// number of steps. Accesses still open at the end of a window are carried over to the next one, so the accesses
+    /// are the same as the ones returned by the multi-target overload. Each access is handed to anAccessCallback, along
+    /// with the index of its target, once the window in which it ends has been processed. Accesses of a given target
+    /// are streamed in chronological order. The callback is always invoked from the calling thread.
+    ///
+    /// Peak memory depends on the window duration and on the number of targets, but not on the interval duration,
+    /// which makes this suitable for long (e.g. yearly) studies over many targets.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.streamAccesses(
+    ///         interval,
+    ///         accessTargets,
+    ///         toTrajectory,
+    ///         [](const Index& aTargetIndex, const Access& anAccess) -> void { ... },
+    ///         Duration::Days(1.0)
+    ///     );
+    /// @endcode
+    ///
+    /// @param anInterval The time interval over which to compute accesses.
+    /// @param someAccessTargets The array of fixed access targets to evaluate visibility against.
+    /// @param aToTrajectory The trajectory of the observer (e.g. satellite).
+    /// @param anAccessCallback The function receiving the index of the target and each access.
+    /// @param aWindowDuration The duration of a scanning window. Defaults to one day.
+    /// @param coarse If true, skips precise crossing refinement and returns coarse intervals only.
+    /// Defaults to false.
+    void streamAccesses(
+        const physics::time::Interval& anInterval,
+        const Array<AccessTarget>& someAccessTargets,
+        const Trajectory& aToTrajectory,
+        const std::function<void(const Index&, const Access&)>& anAccessCallback,
+        const Duration& aWindowDuration = Duration::Days(1.0),
+        const bool& coarse = false
+    ) const;
+
     /// @brief Set the time step used when sampling the interval.
     ///
     /// @code{.cpp}
@@ -400,7 +636,8 @@ class Generator
     ///
     /// @details The filter is evaluated at each sample instant. If the predicate returns false for
     /// a given pair of from/to States, that sample is treated as non-visible regardless of the
-    /// geometric visibility criterion.
+    /// geometric visibility criterion. It is only evaluated for targets that satisfy their
+    /// visibility criterion at that instant. See also setBatchStateFilter.
     ///
     /// @code{.cpp}
     ///     Generator generator = { ... };
@@ -412,6 +649,91 @@ class Generator
     /// @param aStateFilter The new state filter function.
     void setStateFilter(const std::function<bool(const State&, const State&)>& aStateFilter);
 
+    /// @brief Set the batch state filter predicate.
+    ///
+    /// @details Batched counterpart of the state filter: at each sample instant, the filter receives the "to" State
+    /// and the "from" States of all targets that satisfy their visibility criterion at that instant, and returns
+    /// whether each of them is retained (one value per "from" State, in the same order). Samples that are not
+    /// retained are treated as non-visible. For fixed targets, the "from" States (in GCRF, at rest in the central
+    /// celestial object frame) are built from the precomputed target positions with a single frame transform per
+    /// instant, and the filter is not called at instants where no target is visible. For trajectory targets, the "to"
+    /// State differs from one instant to the next, so the filter receives the single "from" State of each instant
+    /// where the visibility criterion is satisfied. It can be combined with the state filter, in which case a sample
+    /// must pass both.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.setBatchStateFilter([](const State& toState, const Array<State>& fromStates) {
+    ///         return fromStates.map<bool>([&toState](const State& fromState) {
+    ///             return someCustomCheck(fromState, toState);
+    ///         });
+    ///     });
+    /// @endcode
+    ///
+    /// @param aBatchStateFilter The new batch state filter function.
+    void setBatchStateFilter(const std::function<Array<bool>(const State&, const Array<State>&)>& aBatchStateFilter);
+
+    /// @brief Set the number of threads used to compute accesses.
+    ///
+    /// @details With a thread count of 1 (the default), accesses are computed serially. With a larger count,
+    /// trajectory targets are distributed across threads, and for fixed targets the sampling grid is split into
+    /// contiguous time chunks scanned concurrently, followed by crossing refinement, each coarse access interval of
+    /// each target being refined as a separate work item. Results, and their order, match the serial path. The
+    /// observer trajectory is copied once per thread, so its model needs no internal synchronization; access and state
+    /// filters, however, are invoked concurrently and must be thread-safe.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.setThreadCount(std::thread::hardware_concurrency());
+    /// @endcode
+    ///
+    /// @param aThreadCount The new thread count, strictly positive.
+    void setThreadCount(const Size& aThreadCount);
+
+    /// @brief Set the horizon pre-screening bounds.
+    ///
+    /// @details When set, fixed targets with an elevation-based visibility criterion (AER interval, AER mask or
+    /// elevation interval) are pre-screened geometrically: the observer radius is bounded by the central body
+    /// equatorial radius plus aMaximumAltitude, which bounds the central angle from a target at which the observer
+    /// can rise above the target minimum elevation. As this angle changes no faster than aMaximumAngularRate, the grid
+    /// steps at which every target is guaranteed to remain out of view are skipped, without evaluating the observer
+    /// trajectory. Results are unchanged as long as the observer respects both bounds. The angular rate is that of
+    /// the observer position direction in the central body frame (e.g. the orbit mean motion at perigee plus the body
+    /// rotation rate). Line-of-sight targets are never pre-screened. Passing undefined bounds disables the pre-screen.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.setHorizonPrescreening(
+    ///         Length::Kilometers(600.0), Derived(0.0012, Derived::Unit::RadianPerSecond())
+    ///     );
+    /// @endcode
+    ///
+    /// @param aMaximumAltitude The maximum altitude of the observer above the central body equatorial radius.
+    /// @param aMaximumAngularRate The maximum angular rate of the observer, as seen from the central body center.
+    void setHorizonPrescreening(const Length& aMaximumAltitude, const Derived& aMaximumAngularRate);
+
+    /// @brief Enable or disable the collection of statistics.
+    ///
+    /// @details When enabled, every access computation adds its counters and timers (see Statistics) to those of the
+    /// Generator, which lets the step and tolerance be tuned on a given scenario. Counters are kept per thread and
+    /// merged once per computation, so that collection does not synchronize threads. Disabled by default.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.setStatisticsEnabled(true);
+    /// @endcode
+    ///
+    /// @param isEnabled True to collect statistics, false otherwise.
+    void setStatisticsEnabled(const bool& isEnabled);
+
+    /// @brief Reset the collected statistics.
+    ///
+    /// @code{.cpp}
+    ///     Generator generator = { ... };
+    ///     generator.resetStatistics();
+    /// @endcode
+    void resetStatistics();
+
     /// @brief Construct an undefined Generator.
     ///
     /// @code{.cpp}
@@ -422,6 +744,27 @@ class Generator
     static Generator Undefined();
 
    private:
+    /// @brief Statistics shared by concurrent computations, copied by value along with the Generator.
+    class StatisticsAccumulator
+    {
+       public:
+        StatisticsAccumulator() = default;
+
+        StatisticsAccumulator(const StatisticsAccumulator& anAccumulator);
+
+        StatisticsAccumulator& operator=(const StatisticsAccumulator& anAccumulator);
+
+        void add(const Statistics& someStatistics);
+
+        Statistics get() const;
+
+        void reset();
+
+       private:
+        mutable std::mutex mutex_;
+        Statistics statistics_;
+    };
+
     Environment environment_;
 
     Duration step_;
@@ -429,23 +772,51 @@ class Generator
 
     std::function<bool(const Access&)> accessFilter_;
     std::function<bool(const State&, const State&)> stateFilter_;
+    std::function<Array<bool>(const State&, const Array<State>&)> batchStateFilter_;
+
+    Size threadCount_;
+
+    Length prescreeningMaximumAltitude_;
+    Derived prescreeningMaximumAngularRate_;
+
+    bool isStatisticsEnabled_;
+    mutable StatisticsAccumulator statisticsAccumulator_;
+
+    std::function<bool(const Instant&)> buildConditionFunction(
+        const AccessTarget& anAccessTarget, const Trajectory& aToTrajectory, Statistics* aStatisticsPtr
+    ) const;
 
     Array<Access> computeAccessesForTrajectoryTarget(
-        const physics::time::Interval& anInterval, const AccessTarget& anAccessTarget, const Trajectory& aToTrajectory
+        const physics::time::Interval& anInterval,
+        const AccessTarget& anAccessTarget,
+        const Trajectory& aToTrajectory,
+        Statistics* aStatisticsPtr = nullptr
     ) const;
 
-    Array<Array<Access>> computeAccessesForFixedTargets(
+    Array<Array<Array<Access>>> computeAccessesForFixedTargets(
         const physics::time::Interval& anInterval,
         const Array<AccessTarget>& someAccessTargets,
-        const Trajectory& aToTrajectory,
+        const Array<const Trajectory*>& someToTrajectories,
+        const Array<const Ephemeris*>& someToEphemerides,
         const bool& coarse = false
     ) const;
 
+    void computeAccessesForFixedTargets(
+        const physics::time::Interval& anInterval,
+        const Array<AccessTarget>& someAccessTargets,
+        const Array<const Trajectory*>& someToTrajectories,
+        const Array<const Ephemeris*>& someToEphemerides,
+        const bool& coarse,
+        const Duration& aWindowDuration,
+        const std::function<void(const Index&, const Index&, const Array<Access>&)>& anAccessesCallback
+    ) const;
+
     Array<Access> generateAccessesFromIntervals(
         const Array<physics::time::Interval>& someIntervals,
         const physics::time::Interval& anInterval,
         const Trajectory& aFromTrajectory,
-        const Trajectory& aToTrajectory
+        const Trajectory& aToTrajectory,
+        Statistics* aStatisticsPtr = nullptr
     ) const;
 
     Array<physics::time::Interval> computePreciseCrossings(
@@ -454,7 +825,9 @@ class Generator
         const Vector3d& fromPositionCoordinate_ITRF,
         const Trajectory& aToTrajectory,
         const AccessTarget& anAccessTarget,
-        const Shared<const Celestial>& aCelestialSPtr
+        const Shared<const Celestial>& aCelestialSPtr,
+        const Instant& aPreviousAccessEnd,
+        Statistics* aStatisticsPtr = nullptr
     ) const;
 
     static Array<physics::time::Interval> ComputeIntervals(const VectorXi& inAccess, const Array<Instant>& instants);
@@ -465,7 +838,8 @@ class Generator
         const Trajectory& aFromTrajectory,
         const Trajectory& aToTrajectory,
         const Duration& aTolerance,
-        const Shared<const Celestial>& aCelestialSPtr
+        const Shared<const Celestial>& aCelestialSPtr,
+        Statistics* aStatisticsPtr = nullptr
     );
 
     static Instant FindTimeOfClosestApproach(
@@ -473,21 +847,24 @@ class Generator
         const Trajectory& aFromTrajectory,
         const Trajectory& aToTrajectory,
         const Duration& aTolerance,
-        const Shared<const Celestial>& aCelestialSPtr
+        const Shared<const Celestial>& aCelestialSPtr,
+        Statistics* aStatisticsPtr = nullptr
     );
 
     static Angle CalculateElevationAt(
         const Instant& anInstant,
         const Trajectory& aFromTrajectory,
         const Trajectory& aToTrajectory,
-        const Shared<const Celestial>& aCelestialSPtr
+        const Shared<const Celestial>& aCelestialSPtr,
+        Statistics* aStatisticsPtr = nullptr
     );
 
     static AER CalculateAer(
         const Instant& anInstant,
         const Position& aFromPosition,
         const Position& aToPosition,
-        const Shared<const Celestial>& aCelestialSPtr
+        const Shared<const Celestial>& aCelestialSPtr,
+        Statistics* aStatisticsPtr = nullptr
     );
 };
 
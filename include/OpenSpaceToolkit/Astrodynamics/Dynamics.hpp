@@ -7,14 +7,18 @@
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
@@ -29,15 +33,19 @@ namespace astrodynamics
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::Environment;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
@@ -66,6 +74,132 @@ class Dynamics
         Array<Pair<Index, Size>> readIndexes;
         Array<Pair<Index, Size>> writeIndexes;
         Size readStateSize;
+        Size writeStateSize;
+
+        /// Scratch buffers, preallocated so that evaluating the dynamical equations does not allocate. Each system of
+        /// equations holds its own copy of the contexts.
+        mutable VectorXd readState;
+        mutable VectorXd contribution;
+
+        /// Batch scratch buffers, one row per member, sized once by `GetBatchSystemOfEquations`
+        mutable MatrixXd readStateMatrix;
+        mutable MatrixXd contributionMatrix;
+
+        /// Jacobian scratch buffer, (write state size x read state size), sized once by
+        /// `GetVariationalSystemOfEquations`
+        mutable MatrixXd contributionJacobian;
+    };
+
+    /// @brief Frame transforms memoized at a single instant.
+    ///
+    /// @details One cache is shared by all the dynamics of a system of equations, so that a transform needed by
+    /// several of them (e.g. GCRF to ITRF for both central body gravity and drag) is computed once per evaluation.
+    /// Since the translation of a transform to a celestial frame is the ephemeris of that body, celestial ephemerides
+    /// are memoized along with it. Entries are keyed by frame pointer, and cleared whenever another instant is
+    /// requested.
+    class TransformCache
+    {
+       public:
+        /// @brief Constructor
+        TransformCache();
+
+        /// @brief Get the transform between two frames, computing it on first request.
+        ///
+        /// @code{.cpp}
+        ///     Dynamics::TransformCache transformCache;
+        ///     Transform transform = transformCache.getTransform(Frame::GCRF(), Frame::ITRF(), instant);
+        /// @endcode
+        ///
+        /// @param aFromFrameSPtr The frame to transform from
+        /// @param aToFrameSPtr The frame to transform to
+        /// @param anInstant An instant
+        /// @return The transform from the first frame to the second one, at the given instant
+        Transform getTransform(
+            const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+        );
+
+        /// @brief Get the number of memoized transforms.
+        ///
+        /// @return The number of memoized transforms
+        Size getSize() const;
+
+       private:
+        struct Entry
+        {
+            Shared<const Frame> fromFrameSPtr;
+            Shared<const Frame> toFrameSPtr;
+            Transform transform;
+        };
+
+        Instant instant_;
+        Array<Entry> entries_;
+    };
+
+    /// @brief Multi-rate evaluation of a dynamics, within a single system of equations.
+    ///
+    /// @details The contribution is split into a fast part (`computeFastContributionInPlace`), evaluated at every
+    /// call, and a slow part (the remainder of the contribution). Once two samples of the slow part are available, it
+    /// is only evaluated when the integration time is further than the current interval from its latest sample, and is
+    /// otherwise linearly interpolated, or extrapolated, from its two latest samples. At each new sample, the deviation
+    /// of the prediction from the evaluated slow part drives the interval, so that the interpolation error stays
+    /// around the tolerance, up to the maximum interval. Samples more than twice the maximum interval apart are never
+    /// interpolated between.
+    class MultiRateCache
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aMaximumInterval A maximum interval between two evaluations of the slow part
+        /// @param aTolerance A tolerance on the interpolation error of the slow part, in SI units of the contribution
+        /// @param aContributionSize The size of the contribution
+        MultiRateCache(const Duration& aMaximumInterval, const Real& aTolerance, const Size& aContributionSize);
+
+        /// @brief Compute the contribution of a dynamics, evaluating its slow part only when required.
+        ///
+        /// @param aDynamics A dynamics
+        /// @param anInstant An instant
+        /// @param aTime The integration time, in seconds, used to place the samples of the slow part
+        /// @param x The reduced state vector
+        /// @param aFrameSPtr The frame in which the state vector is expressed
+        /// @param aContribution The reduced derivative state vector to write to
+        /// @param aTransformCache A transform cache
+        void computeContribution(
+            const Dynamics& aDynamics,
+            const Instant& anInstant,
+            const double& aTime,
+            const Eigen::Ref<const VectorXd>& x,
+            const Shared<const Frame>& aFrameSPtr,
+            Eigen::Ref<VectorXd> aContribution,
+            TransformCache& aTransformCache
+        );
+
+        /// @brief Get the current interval between two evaluations of the slow part.
+        ///
+        /// @return The interval
+        Duration getInterval() const;
+
+        /// @brief Get the number of evaluations of the slow part.
+        ///
+        /// @return The number of evaluations
+        Size getEvaluationCount() const;
+
+       private:
+        double maximumInterval_;
+        double tolerance_;
+        double interval_;
+        Size evaluationCount_;
+        Size sampleCount_;
+
+        double previousTime_;
+        double latestTime_;
+        VectorXd previousSlowContribution_;
+        VectorXd latestSlowContribution_;
+
+        /// Scratch buffers
+        VectorXd fastContribution_;
+        VectorXd predictedSlowContribution_;
+
+        void predictSlowContribution(const double& aTime);
     };
 
     /// @brief Constructor
@@ -92,6 +226,47 @@ class Dynamics
     /// @return Name of Dynamics
     String getName() const;
 
+    /// @brief Check if multi-rate evaluation is enabled
+    ///
+    /// @return True if multi-rate evaluation is enabled
+    bool isMultiRateEvaluationEnabled() const;
+
+    /// @brief Get the maximum interval between two evaluations of the slow part of the contribution
+    ///
+    /// @return Maximum interval, or Duration::Undefined() if multi-rate evaluation is disabled
+    Duration getMultiRateMaximumInterval() const;
+
+    /// @brief Get the tolerance on the interpolation error of the slow part of the contribution
+    ///
+    /// @return Tolerance, or Real::Undefined() if multi-rate evaluation is disabled
+    Real getMultiRateTolerance() const;
+
+    /// @brief Set multi-rate evaluation, to evaluate an expensive and slowly varying contribution less often than at
+    /// every call of the system of equations.
+    ///
+    /// @details Only the fast part of the contribution (see `computeFastContributionInPlace`, e.g. the point mass term
+    /// of the central body gravity) is then evaluated at every call. The remainder is re-evaluated at an adaptive
+    /// interval, and interpolated in between (see `MultiRateCache`). This applies to state propagation, while batch
+    /// propagation and state transition matrix propagation keep evaluating the full contribution at every call. This
+    /// setting must not be changed while a propagation using this dynamics is running.
+    ///
+    /// @code{.cpp}
+    ///                  dynamics.setMultiRateEvaluation(Duration::Minutes(2.0), 1.0e-9);
+    /// @endcode
+    ///
+    /// @param aMaximumInterval Strictly positive maximum interval between two evaluations of the slow part
+    /// @param aTolerance Strictly positive tolerance on the interpolation error of the slow part, in SI units of the
+    /// contribution (e.g. m/s² for an acceleration)
+    void setMultiRateEvaluation(const Duration& aMaximumInterval, const Real& aTolerance);
+
+    /// @brief Disable multi-rate evaluation, the full contribution is then evaluated at every call. This setting must
+    /// not be changed while a propagation using this dynamics is running.
+    ///
+    /// @code{.cpp}
+    ///                  dynamics.disableMultiRateEvaluation();
+    /// @endcode
+    void disableMultiRateEvaluation();
+
     /// @brief Print dynamics
     ///
     /// @param anOutputStream An output stream
@@ -126,15 +301,202 @@ class Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const = 0;
 
+    /// @brief Compute the contribution to the state derivative, in place.
+    ///
+    /// @details Writes into a caller-provided buffer rather than returning a new vector, so that dynamics overriding
+    /// it can be evaluated without heap allocations. Frame transforms should be obtained from the given cache, which
+    /// is shared with the other dynamics evaluated at the same instant. The default implementation falls back on
+    /// `computeContribution`.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector to write to (this vector follows the structure
+    /// determined by the 'write' coordinate subsets), expressed in the given frame
+    /// @param aTransformCache A transform cache
+    virtual void computeContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const;
+
+    /// @brief Compute the fast part of the contribution to the state derivative, in place.
+    ///
+    /// @details Under multi-rate evaluation, the fast part is evaluated at every call of the system of equations,
+    /// while the remainder of the contribution is interpolated. The default implementation has no fast part.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector to write to (this vector follows the structure
+    /// determined by the 'write' coordinate subsets), expressed in the given frame
+    /// @param aTransformCache A transform cache
+    virtual void computeFastContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states.
+    ///
+    /// @details The batch is laid out as a structure of arrays: each row holds the reduced state of one member, so
+    /// that each column (one coordinate across all members) is contiguous in memory. The default implementation
+    /// evaluates `computeContribution` row by row; dynamics override it to evaluate the whole batch at once.
+    ///
+    /// @param anInstant An instant
+    /// @param aStateMatrix The reduced state matrix, one row per member (columns follow the structure determined by
+    /// the 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the states are expressed
+    ///
+    /// @return The reduced derivative state matrix, one row per member (columns follow the structure determined by
+    /// the 'write' coordinate subsets) expressed in the given frame
+    virtual MatrixXd computeContributions(
+        const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+    ) const;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states, in place.
+    ///
+    /// @details Writes into a caller-provided matrix, and obtains frame transforms from the given cache, as
+    /// `computeContributionInPlace` does for a single state. The default implementation falls back on
+    /// `computeContributions`.
+    ///
+    /// @param anInstant An instant
+    /// @param aStateMatrix The reduced state matrix, one row per member (columns follow the structure determined by
+    /// the 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the states are expressed
+    /// @param aContributionMatrix The reduced derivative state matrix to write to, one row per member (columns follow
+    /// the structure determined by the 'write' coordinate subsets), expressed in the given frame
+    /// @param aTransformCache A transform cache
+    virtual void computeContributionsInPlace(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix,
+        TransformCache& aTransformCache
+    ) const;
+
+    /// @brief Check if the dynamics provides the Jacobian of its contribution.
+    ///
+    /// @return True if `computeContributionJacobian` is implemented. Defaults to false.
+    virtual bool hasContributionJacobian() const;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, with respect to the reduced state.
+    ///
+    /// @details Used to propagate the state transition matrix along with the state. The default implementation
+    /// throws.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian matrix, of size (write state size x read state size), expressed in the given frame
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, in place.
+    ///
+    /// @details Writes into a caller-provided matrix, and obtains frame transforms from the given cache, as
+    /// `computeContributionInPlace` does for the contribution itself. The default implementation falls back on
+    /// `computeContributionJacobian`.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aJacobian The Jacobian matrix to write to, of size (write state size x read state size), expressed in
+    /// the given frame
+    /// @param aTransformCache A transform cache
+    virtual void computeContributionJacobianInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<MatrixXd> aJacobian,
+        TransformCache& aTransformCache
+    ) const;
+
     /// @brief Get system of equations wrapper
     ///
     /// @param aContextArray An array of Dynamics Information
     /// @param anInstant An instant
     /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    /// @param aProfileSPtr A profile recording the time spent in each dynamics, or nullptr (default)
     ///
     /// @return std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
     static NumericalSolver::SystemOfEquationsWrapper GetSystemOfEquations(
-        const Array<Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<NumericalSolver::Profile>& aProfileSPtr = nullptr
+    );
+
+    /// @brief Get system of equations wrapper on fixed size state vectors
+    ///
+    /// @details Evaluates the same equations as GetSystemOfEquations, on the fixed size state vectors of
+    /// NumericalSolver::integrateTime<N>. Instantiated for sizes 6, 7 and 8.
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param anInstant An instant
+    /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    /// @param aProfileSPtr A profile recording the time spent in each dynamics, or nullptr (default)
+    ///
+    /// @return std::function<void(const FixedSizeStateVector<N>&, FixedSizeStateVector<N>&, const double)>
+    template <Size N>
+    static NumericalSolver::FixedSizeSystemOfEquationsWrapper<N> GetFixedSizeSystemOfEquations(
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<NumericalSolver::Profile>& aProfileSPtr = nullptr
+    );
+
+    /// @brief Get batch system of equations wrapper
+    ///
+    /// @details The wrapped state vector holds a batch of states as a column-major (member count x state size)
+    /// matrix, i.e. coordinate `j` of member `i` is stored at index `j * aMemberCount + i`. All members are
+    /// integrated together, with a shared step.
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param aMemberCount The number of members in the batch
+    /// @param anInstant An instant
+    /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    /// @param aProfileSPtr A profile recording the time spent in each dynamics, or nullptr (default)
+    ///
+    /// @return std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+    static NumericalSolver::SystemOfEquationsWrapper GetBatchSystemOfEquations(
+        const Array<Context>& aContextArray,
+        const Size& aMemberCount,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<NumericalSolver::Profile>& aProfileSPtr = nullptr
+    );
+
+    /// @brief Get variational system of equations wrapper
+    ///
+    /// @details The wrapped state vector holds the state followed by the state transition matrix Φ, stored column-major
+    /// (i.e. coordinate `k` of the state is at index `k`, and Φ(i, j) is at index `aStateSize + j * aStateSize + i`).
+    /// The state transition matrix obeys dΦ/dt = A Φ, where A is assembled from the Jacobians of all the dynamics,
+    /// which must therefore provide one.
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param aStateSize The size of the state
+    /// @param anInstant An instant
+    /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    /// @param aProfileSPtr A profile recording the time spent in each dynamics, or nullptr (default)
+    ///
+    /// @return std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+    static NumericalSolver::SystemOfEquationsWrapper GetVariationalSystemOfEquations(
+        const Array<Context>& aContextArray,
+        const Size& aStateSize,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<NumericalSolver::Profile>& aProfileSPtr = nullptr
     );
 
     /// @brief Get a list of dynamics from the envrionment
@@ -146,22 +508,58 @@ class Dynamics
 
    private:
     const String name_;
+    Duration multiRateMaximumInterval_;
+    Real multiRateTolerance_;
 
+    template <typename StateVector>
     static void DynamicalEquations(
+        const StateVector& x,
+        StateVector& dxdt,
+        const double& t,
+        const Array<Context>& aContextArray,
+        const Array<Shared<NumericalSolver::Profile::Timer>>& aContributionTimerArray,
+        const Array<Shared<MultiRateCache>>& aMultiRateCacheArray,
+        TransformCache& aTransformCache,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+    static void BatchDynamicalEquations(
+        const NumericalSolver::StateVector& x,
+        NumericalSolver::StateVector& dxdt,
+        const double& t,
+        const Array<Context>& aContextArray,
+        const Array<Shared<NumericalSolver::Profile::Timer>>& aContributionTimerArray,
+        const Size& aMemberCount,
+        TransformCache& aTransformCache,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+    static void VariationalDynamicalEquations(
         const NumericalSolver::StateVector& x,
         NumericalSolver::StateVector& dxdt,
         const double& t,
         const Array<Context>& aContextArray,
+        const Array<Shared<NumericalSolver::Profile::Timer>>& aContributionTimerArray,
+        MatrixXd& aStateJacobian,
+        TransformCache& aTransformCache,
         const Instant& anInstant,
         const Shared<const Frame>& aFrameSPtr
     );
 
-    static VectorXd extractReadState(
-        const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, const Size readSize
+    static Array<Shared<NumericalSolver::Profile::Timer>> ContributionTimers(
+        const Array<Context>& aContextArray, const Shared<NumericalSolver::Profile>& aProfileSPtr
+    );
+
+    static Array<Shared<MultiRateCache>> MultiRateCaches(const Array<Context>& aContextArray);
+
+    static void extractReadState(
+        const Eigen::Ref<const VectorXd>& x, const Array<Pair<Index, Size>>& readInfo, VectorXd& aReadState
     );
 
     static void applyContribution(
-        NumericalSolver::StateVector& dxdt, const VectorXd& contribution, const Array<Pair<Index, Size>>& writeInfo
+        Eigen::Ref<VectorXd> dxdt, const VectorXd& contribution, const Array<Pair<Index, Size>>& writeInfo
     );
 };
 
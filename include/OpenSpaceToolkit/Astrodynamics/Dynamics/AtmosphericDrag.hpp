@@ -130,6 +130,111 @@ class AtmosphericDrag : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Compute the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     AtmosphericDrag atmosphericDrag = { ... } ;
+    ///     atmosphericDrag.computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aContribution The reduced derivative state vector to write to (follows the structure determined by the
+    /// write coordinate subsets), expressed in the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states.
+    ///
+    /// @code{.cpp}
+    ///     AtmosphericDrag atmosphericDrag = { ... } ;
+    ///     MatrixXd contributions = atmosphericDrag.computeContributions(anInstant, aStateMatrix, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @return The reduced derivative state matrix, one row per member, expressed in the given frame.
+    virtual MatrixXd computeContributions(
+        const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states, in place.
+    ///
+    /// @details The frame transform is obtained once per batch from the cache, the atmospheric density and the drag
+    /// acceleration are then evaluated member by member, without allocating.
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @param aContributionMatrix The reduced derivative state matrix to write to, one row per member, expressed in
+    /// the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionsInPlace(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Check if the dynamics provides the Jacobian of its contribution.
+    ///
+    /// @code{.cpp}
+    ///     AtmosphericDrag atmosphericDrag = { ... } ;
+    ///     bool hasJacobian = atmosphericDrag.hasContributionJacobian() ;
+    /// @endcode
+    ///
+    /// @return True.
+    virtual bool hasContributionJacobian() const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, with respect to the reduced state.
+    ///
+    /// @details The partials with respect to velocity, mass, surface area and drag coefficient are analytic. The
+    /// gradient of the atmospheric density with respect to position is computed by central differences.
+    ///
+    /// @code{.cpp}
+    ///     AtmosphericDrag atmosphericDrag = { ... } ;
+    ///     MatrixXd jacobian = atmosphericDrag.computeContributionJacobian(anInstant, x, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @return The Jacobian matrix, of size (write state size x read state size), expressed in the given frame.
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     AtmosphericDrag atmosphericDrag = { ... } ;
+    ///     MatrixXd jacobian(3, 9) ;
+    ///     Dynamics::TransformCache transformCache ;
+    ///     atmosphericDrag.computeContributionJacobianInPlace(anInstant, x, aFrameSPtr, jacobian, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aJacobian The Jacobian matrix to write to, of size (write state size x read state size).
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionJacobianInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<MatrixXd> aJacobian,
+        TransformCache& aTransformCache
+    ) const override;
+
     /// @brief Print the atmospheric drag dynamics.
     ///
     /// @code{.cpp}
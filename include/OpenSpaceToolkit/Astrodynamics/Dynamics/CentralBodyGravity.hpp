@@ -3,8 +3,12 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity__
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Model.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -17,11 +21,15 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::core::container::Array;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
+using ostk::core::type::Real;
 using ostk::core::type::String;
 
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Instant;
+using GravitationalModel = ostk::physics::environment::gravitational::Model;
 
 using ostk::astrodynamics::Dynamics;
 
@@ -89,6 +97,45 @@ class CentralBodyGravity : public Dynamics
     /// @return A shared pointer to the celestial object.
     Shared<const Celestial> getCelestial() const;
 
+    /// @brief Get the acceleration tolerance of the altitude-adaptive truncation of the gravitational model.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     Real tolerance = centralBodyGravity.getTruncationTolerance() ;
+    /// @endcode
+    ///
+    /// @return The tolerance, in m/s², or Real::Undefined() if the truncation is not adaptive.
+    Real getTruncationTolerance() const;
+
+    /// @brief Set the acceleration tolerance of the altitude-adaptive truncation of the gravitational model.
+    ///
+    /// @details The degree and order of the spherical harmonics expansion then follow the radius of each evaluated
+    /// position. The acceleration of the degree n terms decays as (R / r)^n: it is estimated with Kaula's rule, and
+    /// the terms above the effective degree are dropped as long as their sum stays within the tolerance. Truncated
+    /// models are loaded once, at a ladder of degrees (2, 3, 4, 6, 8, 12, 16, ...) up to the degree of the model,
+    /// and the effective degree is rounded up to the next one. Only Earth spherical harmonics models (EGM84, EGM96,
+    /// EGM2008) are supported. This setting must not be changed while a propagation using this dynamics is running.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { earthSPtr } ; // e.g. Earth::EGM2008(100, 100)
+    ///     centralBodyGravity.setTruncationTolerance(1.0e-9) ;
+    /// @endcode
+    ///
+    /// @param anAccelerationTolerance A strictly positive acceleration tolerance, in m/s². Use Real::Undefined() to
+    /// use the full model at every radius.
+    void setTruncationTolerance(const Real& anAccelerationTolerance);
+
+    /// @brief Get the effective degree of the gravitational model at a given radius.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     Integer degree = centralBodyGravity.getTruncationDegreeAt(42164000.0) ;
+    /// @endcode
+    ///
+    /// @param aRadius A distance to the center of the central body, in meters.
+    /// @return The effective degree, or Integer::Undefined() if the truncation is not adaptive.
+    Integer getTruncationDegreeAt(const Real& aRadius) const;
+
     /// @brief Get the coordinate subsets that the instance reads from.
     ///
     /// @code{.cpp}
@@ -125,6 +172,130 @@ class CentralBodyGravity : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Compute the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     centralBodyGravity.computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aContribution The reduced derivative state vector to write to (follows the structure determined by the
+    /// write coordinate subsets), expressed in the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Compute the fast part of the contribution to the state derivative, in place.
+    ///
+    /// @details The fast part is the point mass term of the gravitational model, so that under multi-rate evaluation
+    /// only the higher order terms are interpolated.
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aContribution The reduced derivative state vector to write to (follows the structure determined by the
+    /// write coordinate subsets), expressed in the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeFastContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     MatrixXd contributions = centralBodyGravity.computeContributions(anInstant, aStateMatrix, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @return The reduced derivative state matrix, one row per member, expressed in the given frame.
+    virtual MatrixXd computeContributions(
+        const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states, in place.
+    ///
+    /// @details The frame transform is obtained once per batch from the cache, and the gravitational field is then
+    /// evaluated member by member, without allocating.
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @param aContributionMatrix The reduced derivative state matrix to write to, one row per member, expressed in
+    /// the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionsInPlace(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Check if the dynamics provides the Jacobian of its contribution.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     bool hasJacobian = centralBodyGravity.hasContributionJacobian() ;
+    /// @endcode
+    ///
+    /// @return True.
+    virtual bool hasContributionJacobian() const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, with respect to the reduced state.
+    ///
+    /// @details The partials are those of the point-mass and J2 terms of the gravitational model, higher order terms
+    /// are neglected, which is accurate enough for the state transition matrix of most orbits.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     MatrixXd jacobian = centralBodyGravity.computeContributionJacobian(anInstant, x, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @return The Jacobian matrix, of size (write state size x read state size), expressed in the given frame.
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     CentralBodyGravity centralBodyGravity = { ... } ;
+    ///     MatrixXd jacobian(3, 3) ;
+    ///     Dynamics::TransformCache transformCache ;
+    ///     centralBodyGravity.computeContributionJacobianInPlace(anInstant, x, aFrameSPtr, jacobian, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aJacobian The Jacobian matrix to write to, of size (write state size x read state size).
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionJacobianInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<MatrixXd> aJacobian,
+        TransformCache& aTransformCache
+    ) const override;
+
     /// @brief Print the central body gravity dynamics.
     ///
     /// @code{.cpp}
@@ -137,7 +308,20 @@ class CentralBodyGravity : public Dynamics
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
    private:
+    struct TruncationLevel
+    {
+        Integer degree;
+        double minimumRadius;
+        Shared<const GravitationalModel> gravitationalModelSPtr;
+    };
+
     Shared<const Celestial> celestialObjectSPtr_;
+    Real truncationTolerance_;
+    Array<TruncationLevel> truncationLevels_;
+
+    const GravitationalModel& accessGravitationalModelAt(const double& aRadius) const;
+
+    Index getTruncationLevelIndexAt(const double& aRadius) const;
 };
 
 }  // namespace dynamics
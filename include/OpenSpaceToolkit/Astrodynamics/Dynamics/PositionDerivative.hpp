@@ -98,6 +98,83 @@ class PositionDerivative : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Compute the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     PositionDerivative positionDerivative = {} ;
+    ///     positionDerivative.computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aContribution The reduced derivative state vector to write to (follows the structure determined by the
+    /// write coordinate subsets), expressed in the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states.
+    ///
+    /// @code{.cpp}
+    ///     PositionDerivative positionDerivative = {} ;
+    ///     MatrixXd contributions = positionDerivative.computeContributions(anInstant, aStateMatrix, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @return The reduced derivative state matrix, one row per member, expressed in the given frame.
+    virtual MatrixXd computeContributions(
+        const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states, in place.
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @param aContributionMatrix The reduced derivative state matrix to write to, one row per member, expressed in
+    /// the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionsInPlace(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Check if the dynamics provides the Jacobian of its contribution.
+    ///
+    /// @code{.cpp}
+    ///     PositionDerivative positionDerivative = {} ;
+    ///     bool hasJacobian = positionDerivative.hasContributionJacobian() ;
+    /// @endcode
+    ///
+    /// @return True.
+    virtual bool hasContributionJacobian() const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, with respect to the reduced state.
+    ///
+    /// @code{.cpp}
+    ///     PositionDerivative positionDerivative = {} ;
+    ///     MatrixXd jacobian = positionDerivative.computeContributionJacobian(anInstant, x, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @return The Jacobian matrix, of size (write state size x read state size), expressed in the given frame.
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
     /// @brief Print the position derivative dynamics.
     ///
     /// @code{.cpp}
@@ -9,6 +9,7 @@
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity/ChebyshevEphemeris.hpp>
 
 namespace ostk
 {
@@ -24,6 +25,7 @@ using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::thirdbodygravity::ChebyshevEphemeris;
 
 /// @brief Third-body gravitational dynamics.
 ///
@@ -31,6 +33,9 @@ using ostk::astrodynamics::Dynamics;
 /// (i.e., a celestial object other than the central body). The acceleration is computed using the
 /// third-body perturbation formulation, which accounts for both the direct attraction of the third
 /// body on the spacecraft and the indirect effect from the attraction on the central body.
+///
+/// When constructed with a Chebyshev ephemeris, the position of a point-mass third body is interpolated from it at
+/// instants it covers (for states expressed in its frame), instead of being queried through the full ephemeris path.
 class ThirdBodyGravity : public Dynamics
 {
    public:
@@ -55,6 +60,21 @@ class ThirdBodyGravity : public Dynamics
     /// @param aName A name for the dynamics.
     ThirdBodyGravity(const Shared<const Celestial>& aCelestial, const String& aName);
 
+    /// @brief Constructor with a Chebyshev ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     Shared<const Celestial> moonSPtr = { ... } ;
+    ///     Shared<const ChebyshevEphemeris> ephemerisSPtr = std::make_shared<ChebyshevEphemeris>(moonSPtr, interval) ;
+    ///     ThirdBodyGravity thirdBodyGravity = { moonSPtr, ephemerisSPtr } ;
+    /// @endcode
+    ///
+    /// @param aCelestial A celestial object representing the third body, with a point-mass gravitational model.
+    /// @param anEphemerisSPtr A Chebyshev ephemeris of the same celestial object, which can be shared between
+    /// dynamics.
+    ThirdBodyGravity(
+        const Shared<const Celestial>& aCelestial, const Shared<const ChebyshevEphemeris>& anEphemerisSPtr
+    );
+
     /// @brief Destructor.
     virtual ~ThirdBodyGravity() override;
 
@@ -90,6 +110,16 @@ class ThirdBodyGravity : public Dynamics
     /// @return A shared pointer to the celestial object.
     Shared<const Celestial> getCelestial() const;
 
+    /// @brief Get the Chebyshev ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     ThirdBodyGravity thirdBodyGravity = { ... } ;
+    ///     Shared<const ChebyshevEphemeris> ephemerisSPtr = thirdBodyGravity.getEphemeris() ;
+    /// @endcode
+    ///
+    /// @return A shared pointer to the Chebyshev ephemeris, null if there is none.
+    Shared<const ChebyshevEphemeris> getEphemeris() const;
+
     /// @brief Get the coordinate subsets that the instance reads from.
     ///
     /// @code{.cpp}
@@ -126,6 +156,110 @@ class ThirdBodyGravity : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Compute the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     ThirdBodyGravity thirdBodyGravity = { ... } ;
+    ///     thirdBodyGravity.computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aContribution The reduced derivative state vector to write to (follows the structure determined by the
+    /// write coordinate subsets), expressed in the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<VectorXd> aContribution,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states.
+    ///
+    /// @code{.cpp}
+    ///     ThirdBodyGravity thirdBodyGravity = { ... } ;
+    ///     MatrixXd contributions = thirdBodyGravity.computeContributions(anInstant, aStateMatrix, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @return The reduced derivative state matrix, one row per member, expressed in the given frame.
+    virtual MatrixXd computeContributions(
+        const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the contributions to the state derivatives of a batch of states, in place.
+    ///
+    /// @details The third body correction and the frame transform are evaluated once per batch, the latter from the
+    /// cache, and the gravitational field is then evaluated member by member, without allocating.
+    ///
+    /// @param anInstant An instant.
+    /// @param aStateMatrix The reduced state matrix, one row per member.
+    /// @param aFrameSPtr The frame in which the states are expressed.
+    /// @param aContributionMatrix The reduced derivative state matrix to write to, one row per member, expressed in
+    /// the given frame.
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionsInPlace(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix,
+        TransformCache& aTransformCache
+    ) const override;
+
+    /// @brief Check if the dynamics provides the Jacobian of its contribution.
+    ///
+    /// @code{.cpp}
+    ///     ThirdBodyGravity thirdBodyGravity = { ... } ;
+    ///     bool hasJacobian = thirdBodyGravity.hasContributionJacobian() ;
+    /// @endcode
+    ///
+    /// @return True.
+    virtual bool hasContributionJacobian() const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, with respect to the reduced state.
+    ///
+    /// @details The third body is treated as a point mass. The third body correction does not depend on the state.
+    ///
+    /// @code{.cpp}
+    ///     ThirdBodyGravity thirdBodyGravity = { ... } ;
+    ///     MatrixXd jacobian = thirdBodyGravity.computeContributionJacobian(anInstant, x, aFrameSPtr) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @return The Jacobian matrix, of size (write state size x read state size), expressed in the given frame.
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, in place.
+    ///
+    /// @code{.cpp}
+    ///     ThirdBodyGravity thirdBodyGravity = { ... } ;
+    ///     MatrixXd jacobian(3, 3) ;
+    ///     Dynamics::TransformCache transformCache ;
+    ///     thirdBodyGravity.computeContributionJacobianInPlace(anInstant, x, aFrameSPtr, jacobian, transformCache) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @param x The reduced state vector (follows the structure determined by the read coordinate subsets).
+    /// @param aFrameSPtr The frame in which the state vector is expressed.
+    /// @param aJacobian The Jacobian matrix to write to, of size (write state size x read state size).
+    /// @param aTransformCache A transform cache, shared with the other dynamics evaluated at the same instant.
+    virtual void computeContributionJacobianInPlace(
+        const Instant& anInstant,
+        const Eigen::Ref<const VectorXd>& x,
+        const Shared<const Frame>& aFrameSPtr,
+        Eigen::Ref<MatrixXd> aJacobian,
+        TransformCache& aTransformCache
+    ) const override;
+
     /// @brief Print the third-body gravity dynamics.
     ///
     /// @code{.cpp}
@@ -139,6 +273,10 @@ class ThirdBodyGravity : public Dynamics
 
    private:
     Shared<const Celestial> celestialObjectSPtr_;
+    Shared<const ChebyshevEphemeris> ephemerisSPtr_;
+    double gravitationalParameterSI_;
+
+    bool ephemerisCovers(const Instant& anInstant, const Shared<const Frame>& aFrameSPtr) const;
 };
 
 }  // namespace dynamics
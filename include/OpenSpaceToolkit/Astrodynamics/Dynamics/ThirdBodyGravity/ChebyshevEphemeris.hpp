@@ -0,0 +1,158 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris__
+#define __OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace dynamics
+{
+namespace thirdbodygravity
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::unit::Length;
+
+/// @brief Celestial body position interpolated with piecewise Chebyshev polynomials.
+///
+/// @details Fits the position of a celestial body over an interval with Chebyshev polynomials of a fixed degree, one
+/// set per segment, in the style of SPK type 2 segments. Segments are bisected until the fit, checked between the
+/// interpolation nodes, is within the requested tolerance. Once built, positions are served by polynomial evaluation
+/// instead of the full ephemeris path. The same instance can be shared by all propagations covering its interval.
+class ChebyshevEphemeris
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     ChebyshevEphemeris ephemeris = {moonSPtr, Interval::Closed(startInstant, endInstant)};
+    /// @endcode
+    ///
+    /// @param aCelestialSPtr The celestial body.
+    /// @param anInterval The interval to cover.
+    /// @param aTolerance The maximum position error. Defaults to 1 meter.
+    /// @param aFrameSPtr The frame in which positions are expressed. Defaults to GCRF.
+    /// @param aDegree The degree of the polynomials. Defaults to 12.
+    ChebyshevEphemeris(
+        const Shared<const Celestial>& aCelestialSPtr,
+        const Interval& anInterval,
+        const Length& aTolerance = Length::Meters(1.0),
+        const Shared<const Frame>& aFrameSPtr = Frame::GCRF(),
+        const Size& aDegree = 12
+    );
+
+    /// @brief Check whether the ephemeris is defined.
+    ///
+    /// @code{.cpp}
+    ///     ChebyshevEphemeris ephemeris = { ... };
+    ///     bool defined = ephemeris.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the ephemeris is defined.
+    bool isDefined() const;
+
+    /// @brief Check whether the ephemeris covers an instant.
+    ///
+    /// @code{.cpp}
+    ///     ChebyshevEphemeris ephemeris = { ... };
+    ///     bool covered = ephemeris.contains(instant);
+    /// @endcode
+    ///
+    /// @param anInstant An instant.
+    /// @return True if the instant lies within the fitted interval.
+    bool contains(const Instant& anInstant) const;
+
+    /// @brief Access the celestial body.
+    ///
+    /// @return The celestial body.
+    const Shared<const Celestial>& accessCelestial() const;
+
+    /// @brief Access the fitted interval.
+    ///
+    /// @return The fitted interval.
+    const Interval& accessInterval() const;
+
+    /// @brief Access the frame in which positions are expressed.
+    ///
+    /// @return The frame in which positions are expressed.
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Get the tolerance.
+    ///
+    /// @return The maximum position error.
+    Length getTolerance() const;
+
+    /// @brief Get the degree of the polynomials.
+    ///
+    /// @return The degree of the polynomials.
+    Size getDegree() const;
+
+    /// @brief Get the number of segments.
+    ///
+    /// @return The number of segments the interval is split into.
+    Size getSegmentCount() const;
+
+    /// @brief Compute the position of the celestial body.
+    ///
+    /// @code{.cpp}
+    ///     ChebyshevEphemeris ephemeris = { ... };
+    ///     Vector3d positionCoordinates = ephemeris.computePositionAt(instant);
+    /// @endcode
+    ///
+    /// @param anInstant An instant, within the fitted interval.
+    /// @return The position coordinates [m], expressed in the ephemeris frame.
+    Vector3d computePositionAt(const Instant& anInstant) const;
+
+   private:
+    struct Segment
+    {
+        double startTime;  // s, from the interval start
+        double endTime;    // s, from the interval start
+        MatrixXd coefficients;
+    };
+
+    Shared<const Celestial> celestialSPtr_;
+    Interval interval_;
+    Length tolerance_;
+    Shared<const Frame> frameSPtr_;
+    Size degree_;
+    Array<Segment> segments_;
+
+    void fitSegment(const double& aStartTime, const double& anEndTime);
+
+    Vector3d samplePositionAt(const double& aTime) const;
+
+    static Vector3d EvaluateSegment(const Segment& aSegment, const double& aTime);
+};
+
+}  // namespace thirdbodygravity
+}  // namespace dynamics
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
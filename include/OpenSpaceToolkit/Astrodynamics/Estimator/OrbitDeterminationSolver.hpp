@@ -87,11 +87,16 @@ class OrbitDeterminationSolver
     /// @param aNumericalSolver Numerical solver, Defaults to NumericalSolver::Default()
     /// @param aSolver Least squares solver, Defaults to LeastSquaresSolver::Default()
     /// @param anEstimationFrameSPtr Estimation frame, Defaults to Frame::GCRF()
+    /// @param isStateTransitionMatrixPropagated If true, the sensitivity matrices are obtained by propagating the
+    /// state transition matrix along with the state (variational equations), rather than by finite differences. This
+    /// falls back on finite differences when some dynamics do not provide a Jacobian, or when the estimation frame
+    /// is not the integration frame of the propagator. Defaults to false.
     OrbitDeterminationSolver(
         const Environment& anEnvironment = DEFAULT_ENVIRONMENT,
         const NumericalSolver& aNumericalSolver = DEFAULT_NUMERICAL_SOLVER,
         const LeastSquaresSolver& aSolver = DEFAULT_LEAST_SQUARES_SOLVER,
-        const Shared<const Frame>& anEstimationFrameSPtr = DEFAULT_ESTIMATION_FRAME
+        const Shared<const Frame>& anEstimationFrameSPtr = DEFAULT_ESTIMATION_FRAME,
+        const bool& isStateTransitionMatrixPropagated = false
     );
 
     /// @brief Access environment
@@ -114,6 +119,11 @@ class OrbitDeterminationSolver
     /// @return Estimation frame
     const Shared<const Frame>& accessEstimationFrame() const;
 
+    /// @brief Check if the state transition matrix is propagated along with the state
+    ///
+    /// @return True if the state transition matrix is propagated
+    bool isStateTransitionMatrixPropagated() const;
+
     /// @brief Estimate state from observations
     ///
     /// @code{.cpp}
@@ -162,6 +172,7 @@ class OrbitDeterminationSolver
     Propagator propagator_;
     LeastSquaresSolver solver_;
     Shared<const Frame> estimationFrameSPtr_;
+    bool stateTransitionMatrixIsPropagated_;
 };
 
 }  // namespace estimator
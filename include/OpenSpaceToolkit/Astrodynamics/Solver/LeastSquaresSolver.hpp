@@ -59,6 +59,12 @@ class LeastSquaresSolver
    public:
     using ScaleFactorGenerator = std::function<VectorXd(const State&)>;
 
+    /// @brief Generate the states at an array of instants, along with their state transition matrices, i.e. the
+    /// partial derivatives of the coordinates of each generated state with respect to the coordinates of the given
+    /// state.
+    using StateTransitionMatrixGenerator =
+        std::function<Pair<Array<State>, Array<MatrixXd>>(const State&, const Array<Instant>&)>;
+
     /// @brief A single iteration step of the least squares solver.
     class Step
     {
@@ -188,6 +194,9 @@ class LeastSquaresSolver
     /// @param aStateGenerator Function to generate states
     /// @param anInitialGuessSigmas Dictionary of sigmas for initial guess
     /// @param anObservationSigmas Dictionary of sigmas for observations
+    /// @param aStateTransitionMatrixGenerator (optional) Function to generate states along with their state transition
+    /// matrices, in the frame of the given state. When provided, it is used instead of the state generator and of the
+    /// finite difference solver, saving the perturbed propagations at each iteration.
     ///
     /// @return Analysis
     Analysis solve(
@@ -195,7 +204,8 @@ class LeastSquaresSolver
         const Array<State>& anObservationStateArray,
         const std::function<Array<State>(const State&, const Array<Instant>&)>& aStateGenerator,
         const std::unordered_map<CoordinateSubset, VectorXd>& anInitialGuessSigmas = DEFAULT_INITIAL_GUESS_SIGMAS,
-        const std::unordered_map<CoordinateSubset, VectorXd>& anObservationSigmas = DEFAULT_OBSERVATION_SIGMAS
+        const std::unordered_map<CoordinateSubset, VectorXd>& anObservationSigmas = DEFAULT_OBSERVATION_SIGMAS,
+        const StateTransitionMatrixGenerator& aStateTransitionMatrixGenerator = nullptr
     ) const;
 
     /// @brief Calculate empirical covariance
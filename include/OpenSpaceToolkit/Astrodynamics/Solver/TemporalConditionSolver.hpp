@@ -117,6 +117,27 @@ class TemporalConditionSolver
     Array<Interval> solve(const Array<TemporalConditionSolver::Condition>& aConditionArray, const Interval& anInterval)
         const;
 
+    /// @brief Find the intervals over which all provided conditions are true, and report the cost of the search of
+    /// each switching instant.
+    ///
+    /// @code{.cpp}
+    ///     TemporalConditionSolver solver = { Duration::Minutes(1.0), Duration::Microseconds(1.0) } ;
+    ///     Array<TemporalConditionSolver::Condition> conditions = { ... } ;
+    ///     Size iterationCount = 0 ;
+    ///     Array<Interval> intervals = solver.solve(conditions, anInterval, [&iterationCount](const Size& aCount)
+    ///     { iterationCount += aCount ; }) ;
+    /// @endcode
+    ///
+    /// @param aConditionArray An array of temporal conditions.
+    /// @param anInterval A time interval within which to perform the search.
+    /// @param aSwitchingCallback A function called with the root solver iteration count of each switching instant.
+    /// @return An array of time intervals.
+    Array<Interval> solve(
+        const Array<TemporalConditionSolver::Condition>& aConditionArray,
+        const Interval& anInterval,
+        const std::function<void(const Size&)>& aSwitchingCallback
+    ) const;
+
    private:
     Duration timeStep_;
     Duration tolerance_;
@@ -125,7 +146,8 @@ class TemporalConditionSolver
     Instant findSwitchingInstant(
         const Instant& aPreviousInstant,
         const Instant& aNextInstant,
-        const Array<TemporalConditionSolver::Condition>& aConditionArray
+        const Array<TemporalConditionSolver::Condition>& aConditionArray,
+        Size& anIterationCount
     ) const;
 
     static bool EvaluateConditionAt(
@@ -6,10 +6,14 @@
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated/CheckpointStore.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Tabulated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
@@ -29,12 +33,16 @@ namespace model
 using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::mathematics::curvefitting::Interpolator;
 
 using ostk::astrodynamics::trajectory::orbit::Model;
+using ostk::astrodynamics::trajectory::orbit::model::propagated::CheckpointStore;
 using ostk::astrodynamics::trajectory::orbit::model::Tabulated;
 using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::State;
@@ -175,6 +183,50 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
     /// @param aStateArray A state array
     void setCachedStateArray(const Array<State>& aStateArray);
 
+    /// @brief Enable checkpointing
+    ///
+    /// @details State queries are then answered by interpolation within segments of the given duration, aligned on the
+    /// epoch. The first query in a segment propagates it, later ones reuse it. Outside of the cached state array,
+    /// segments are propagated from the checkpoint state on their bound on the side of the epoch, itself derived one
+    /// segment at a time from the cached states, so that results do not depend on the order of the queries. With
+    /// checkpointing enabled, calculateStateAt and calculateStatesAt may be called from multiple threads. Copies of
+    /// the model share the checkpoint store.
+    ///
+    /// @code{.cpp}
+    ///              propagated.enableCheckpointing(Duration::Minutes(10.0), 64000000);
+    /// @endcode
+    /// @param aSegmentDuration A segment duration
+    /// @param aMemoryBudget The approximate maximum memory used by the stored segments and checkpoints [bytes]
+    /// @param anEvictionPolicy A segment eviction policy. Defaults to least recently used.
+    void enableCheckpointing(
+        const Duration& aSegmentDuration,
+        const Size& aMemoryBudget,
+        const CheckpointStore::EvictionPolicy& anEvictionPolicy = CheckpointStore::EvictionPolicy::LeastRecentlyUsed
+    );
+
+    /// @brief Disable checkpointing, dropping the stored segments
+    ///
+    /// @code{.cpp}
+    ///              propagated.disableCheckpointing();
+    /// @endcode
+    void disableCheckpointing();
+
+    /// @brief Check if checkpointing is enabled
+    ///
+    /// @code{.cpp}
+    ///              bool enabled = propagated.isCheckpointingEnabled();
+    /// @endcode
+    /// @return True if checkpointing is enabled
+    bool isCheckpointingEnabled() const;
+
+    /// @brief Access the checkpoint store
+    ///
+    /// @code{.cpp}
+    ///              const CheckpointStore& checkpointStore = propagated.accessCheckpointStore();
+    /// @endcode
+    /// @return CheckpointStore&
+    const CheckpointStore& accessCheckpointStore() const;
+
     /// @brief Print propagated
     ///
     /// @param anOutputStream An output stream
@@ -204,8 +256,13 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
     Propagator propagator_;
     mutable Array<State> cachedStateArray_;
     Integer initialRevolutionNumber_;
+    Shared<CheckpointStore> checkpointStoreSPtr_;
 
     void sanitizeCachedArray() const;
+
+    Array<State> propagateStatesAt(const Propagator& aPropagator, const Array<Instant>& anInstantArray) const;
+
+    Array<State> propagateCheckpointNodesAt(const Array<Instant>& anInstantArray, const State& aBoundaryState) const;
 };
 
 }  // namespace model
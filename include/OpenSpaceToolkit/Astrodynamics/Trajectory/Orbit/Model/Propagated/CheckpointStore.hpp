@@ -0,0 +1,230 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore__
+
+#include <functional>
+#include <list>
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace model
+{
+namespace propagated
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::StateBuilder;
+
+/// @brief Store of propagated trajectory segments, answering state queries by interpolation.
+///
+/// @details Time is split into fixed-length segments aligned on an epoch. The first query falling in a segment
+/// propagates the states at the Chebyshev-Lobatto nodes of that segment; that query and all later ones in the same
+/// segment are then answered by barycentric interpolation of the node states. When the estimated interpolation error
+/// exceeds the tolerance, the segment is split into equal pieces, each with its own nodes, until it does not.
+///
+/// Each segment is propagated from the checkpoint state on its bound on the side of the epoch. Checkpoints are
+/// derived one segment at a time starting from the epoch, and are kept when segments are evicted, so that the
+/// interpolated states do not depend on the order of the queries.
+///
+/// Segments are looked up in O(log n). Once the memory used by the stored segments and checkpoints exceeds the
+/// budget, segments are evicted according to the eviction policy. All methods may be called concurrently;
+/// propagation happens outside of the internal lock.
+class CheckpointStore
+{
+   public:
+    /// @brief Segment eviction policy
+    enum class EvictionPolicy
+    {
+        LeastRecentlyUsed,  ///< Evict the segment that was queried the longest time ago
+        Farthest            ///< Evict the segment the farthest away from the segment being added
+    };
+
+    /// @brief Propagation function, returning the states at a sorted instant array. The second argument is the
+    /// checkpoint state to propagate from, on the segment bound on the side of the epoch, or an undefined state for
+    /// the two segments adjacent to the epoch.
+    typedef std::function<Array<State>(const Array<Instant>&, const State&)> PropagationFunction;
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              CheckpointStore checkpointStore = { anEpoch, Duration::Minutes(10.0), 64000000 };
+    /// @endcode
+    ///
+    /// @param anEpoch The instant on which segments are aligned
+    /// @param aSegmentDuration The duration of a segment
+    /// @param aMemoryBudget The approximate maximum memory used by the stored segments and checkpoints [bytes].
+    /// At least one segment is always kept, and checkpoints are never evicted.
+    /// @param anEvictionPolicy An eviction policy. Defaults to least recently used.
+    /// @param aDegree The degree of the interpolating polynomials. Defaults to 16.
+    /// @param aTolerance The interpolation error tolerance, relative to the largest magnitude of each coordinate
+    /// over a segment. Defaults to 1e-12.
+    CheckpointStore(
+        const Instant& anEpoch,
+        const Duration& aSegmentDuration,
+        const Size& aMemoryBudget,
+        const EvictionPolicy& anEvictionPolicy = EvictionPolicy::LeastRecentlyUsed,
+        const Size& aDegree = 16,
+        const Real& aTolerance = 1e-12
+    );
+
+    /// @brief Access the epoch on which segments are aligned
+    ///
+    /// @return The epoch
+    const Instant& accessEpoch() const;
+
+    /// @brief Get the duration of a segment
+    ///
+    /// @return The segment duration
+    Duration getSegmentDuration() const;
+
+    /// @brief Get the memory budget
+    ///
+    /// @return The memory budget [bytes]
+    Size getMemoryBudget() const;
+
+    /// @brief Get the eviction policy
+    ///
+    /// @return The eviction policy
+    EvictionPolicy getEvictionPolicy() const;
+
+    /// @brief Get the degree of the interpolating polynomials
+    ///
+    /// @return The degree
+    Size getDegree() const;
+
+    /// @brief Get the relative interpolation error tolerance
+    ///
+    /// @return The tolerance
+    Real getTolerance() const;
+
+    /// @brief Get the number of stored segments
+    ///
+    /// @return The number of stored segments
+    Size getSegmentCount() const;
+
+    /// @brief Get the memory used by the stored segments and checkpoints. Container overhead is not accounted for,
+    /// the value is approximate.
+    ///
+    /// @return The memory usage [bytes]
+    Size getMemoryUsage() const;
+
+    /// @brief Get the number of queries answered from a stored segment
+    ///
+    /// @return The hit count
+    Size getHitCount() const;
+
+    /// @brief Get the number of queries that required a propagation
+    ///
+    /// @return The miss count
+    Size getMissCount() const;
+
+    /// @brief Calculate the state at an instant, propagating the enclosing segment if it is not stored yet
+    ///
+    /// @code{.cpp}
+    ///              State state = checkpointStore.calculateStateAt(anInstant, aPropagationFunction);
+    /// @endcode
+    ///
+    /// @param anInstant An instant
+    /// @param aPropagationFunction A propagation function, called on a miss
+    /// @return The interpolated state
+    State calculateStateAt(const Instant& anInstant, const PropagationFunction& aPropagationFunction);
+
+    /// @brief Remove all stored segments and checkpoints, and reset the statistics
+    void clear();
+
+    /// @brief Get the string representation of an eviction policy
+    ///
+    /// @param anEvictionPolicy An eviction policy
+    /// @return The string representation
+    static String StringFromEvictionPolicy(const EvictionPolicy& anEvictionPolicy);
+
+   private:
+    struct Segment
+    {
+        MatrixXd nodeCoordinates;  // One column per node, adjacent pieces share their bound node
+        StateBuilder stateBuilder;
+        Size pieceCount;
+        std::list<Integer>::iterator recencyIt;
+        Size memoryUsage;
+    };
+
+    Instant epoch_;
+    Duration segmentDuration_;
+    Size memoryBudget_;
+    EvictionPolicy evictionPolicy_;
+    Size degree_;
+    Real tolerance_;
+
+    Map<Integer, Segment> segments_;
+    Map<Integer, State> checkpoints_;  // Keyed by segment bound index
+    std::list<Integer> recency_;       // Most recently used segment first
+    Size memoryUsage_;
+    Size hitCount_;
+    Size missCount_;
+
+    mutable std::mutex mutex_;
+
+    Integer getSegmentIndex(const Instant& anInstant) const;
+
+    Instant getSegmentStartInstant(const Integer& aSegmentIndex) const;
+
+    Array<Instant> getNodeInstants(const Integer& aSegmentIndex, const Size& aPieceCount) const;
+
+    State getCheckpoint(const Integer& aSegmentIndex, const PropagationFunction& aPropagationFunction);
+
+    Segment propagateSegment(
+        const Integer& aSegmentIndex, const State& aCheckpoint, const PropagationFunction& aPropagationFunction
+    ) const;
+
+    Real estimateError(const MatrixXd& aNodeCoordinates, const Size& aPieceCount) const;
+
+    State interpolate(const Segment& aSegment, const Integer& aSegmentIndex, const Instant& anInstant) const;
+
+    void store(const Integer& aSegmentIndex, Segment&& aSegment);
+
+    void evict(const Integer& aRetainedSegmentIndex);
+};
+
+}  // namespace propagated
+}  // namespace model
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
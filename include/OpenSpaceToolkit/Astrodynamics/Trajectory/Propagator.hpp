@@ -3,11 +3,16 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Propagator__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Propagator__
 
+#include <functional>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -19,6 +24,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
 
 namespace ostk
 {
@@ -28,10 +34,13 @@ namespace trajectory
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 
 using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
 
 using ostk::physics::Environment;
 using ostk::physics::time::Instant;
@@ -42,10 +51,19 @@ using ostk::astrodynamics::flight::Maneuver;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
+using ostk::astrodynamics::trajectory::StateBuilder;
 
 #define DEFAULT_MANEUVER_PROPAGATION_INTERPOLATION_TYPE Interpolator::Type::BarycentricRational
 
 /// @brief Define a propagator to be used for numerical propagation
+///
+/// @details Thread safety: the const methods of a single propagator can be called concurrently from any number of
+/// threads. The dynamics, coordinate broker and numerical solver settings are shared, read-only configuration, while
+/// each call propagates with its own copy of the numerical solver, discarded when the call returns. Observed states
+/// are handed back to the caller through the overloads taking an observed state array. Dynamics are therefore
+/// evaluated concurrently, through their const interface. The non-const
+/// methods (setDynamics, addDynamics, addManeuver, clearDynamics and assignment) must not run concurrently with any
+/// other call.
 class Propagator
 {
    public:
@@ -124,6 +142,12 @@ class Propagator
 
     /// @brief Access the numerical solver
     ///
+    /// @details This is the configured numerical solver. Each calculation integrates with its own copy of it, so that
+    /// the propagator can be used concurrently: the accessed solver is never integrated with and holds no observed
+    /// states, whichever calculation was performed. Use the calculateStateAt and calculateStateToCondition overloads
+    /// taking an observed state array to retrieve them. The reference remains valid until the propagator is assigned
+    /// to or destroyed.
+    ///
     /// @return The numerical solver
     const NumericalSolver& accessNumericalSolver() const;
 
@@ -179,6 +203,17 @@ class Propagator
     /// @return State
     State calculateStateAt(const State& aState, const Instant& anInstant) const;
 
+    /// @brief Calculate the state at an instant, given initial state, and retrieve the observed states
+    /// @code{.cpp}
+    ///              Array<State> observedStates = Array<State>::Empty();
+    ///              State state = propagator.calculateStateAt(aState, anInstant, observedStates);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstant An instant
+    /// @param anObservedStateArray The states observed by the numerical solver, in the integration frame
+    /// @return State
+    State calculateStateAt(const State& aState, const Instant& anInstant, Array<State>& anObservedStateArray) const;
+
     /// @brief Calculate the state subject to an Event Condition, given initial state and maximum end time
     /// @code{.cpp}
     ///              NumericalSolver::ConditionSolution state = propagator.calculateStateToCondition(aState, anInstant,
@@ -192,8 +227,29 @@ class Propagator
         const State& aState, const Instant& anInstant, const EventCondition& anEventCondition
     ) const;
 
+    /// @brief Calculate the state subject to an Event Condition, given initial state and maximum end time, and
+    /// retrieve the observed states
+    /// @code{.cpp}
+    ///              Array<State> observedStates = Array<State>::Empty();
+    ///              NumericalSolver::ConditionSolution state = propagator.calculateStateToCondition(aState, anInstant,
+    ///              anEventCondition, observedStates);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstant An instant
+    /// @param anEventCondition An event condition
+    /// @param anObservedStateArray The states observed by the numerical solver, in the integration frame
+    /// @return NumericalSolver::ConditionSolution
+    NumericalSolver::ConditionSolution calculateStateToCondition(
+        const State& aState,
+        const Instant& anInstant,
+        const EventCondition& anEventCondition,
+        Array<State>& anObservedStateArray
+    ) const;
+
     /// @brief Calculate the states at an array of instants, given an initial state
     /// @brief Can only be used with sorted instants array
+    /// @brief When the numerical solver has dense output enabled, the instants are interpolated from a single
+    /// integration pass, without restarting the stepper at each of them.
     ///
     /// @code{.cpp}
     ///              Array<State> states = propagator.calculateStatesAt(aState, anInstantArray);
@@ -202,6 +258,104 @@ class Propagator
     /// @return Array<State>
     Array<State> calculateStatesAt(const State& aState, const Array<Instant>& anInstantArray) const;
 
+    /// @brief Check if the state transition matrices can be propagated along with the states
+    /// @brief This requires all the dynamics to provide the Jacobian of their contribution.
+    ///
+    /// @code{.cpp}
+    ///              bool canCalculate = propagator.canCalculateStateTransitionMatrices();
+    /// @endcode
+    /// @return True if the state transition matrices can be propagated
+    bool canCalculateStateTransitionMatrices() const;
+
+    /// @brief Calculate the states and state transition matrices at an array of instants, given an initial state
+    /// @brief Can only be used with sorted instants array
+    /// @brief The state transition matrices Φ(t, t₀) = ∂x(t)/∂x(t₀) are propagated along with the states, by
+    /// integrating the variational equations dΦ/dt = A Φ, with A assembled from the Jacobians of the dynamics. They are
+    /// expressed in the integration frame, with coordinates ordered as in the coordinate broker.
+    ///
+    /// @code{.cpp}
+    ///              Pair<Array<State>, Array<MatrixXd>> statesAndStateTransitionMatrices =
+    ///                  propagator.calculateStatesAndStateTransitionMatricesAt(aState, anInstantArray);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstantArray An instant array
+    /// @return Pair<Array<State>, Array<MatrixXd>>, the states and the state transition matrices at the given instants
+    Pair<Array<State>, Array<MatrixXd>> calculateStatesAndStateTransitionMatricesAt(
+        const State& aState, const Array<Instant>& anInstantArray
+    ) const;
+
+    /// @brief Calculate the states of an ensemble at an instant, given the initial state of each member
+    /// @brief Members are propagated concurrently, each thread using its own copy of the numerical solver, while the
+    /// dynamics and coordinate broker are shared. Dynamics are therefore evaluated concurrently. Results match
+    /// calculateStateAt for each member, for any thread count.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = propagator.calculateEnsembleStateAt(aStateArray, anInstant);
+    /// @endcode
+    /// @param aStateArray An array of initial states, one per member
+    /// @param anInstant An instant
+    /// @param (optional) aThreadCount A thread count, 0 to use the hardware concurrency
+    /// @return Array<State>, one state per member
+    Array<State> calculateEnsembleStateAt(
+        const Array<State>& aStateArray, const Instant& anInstant, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Calculate the states of an ensemble at an array of instants, given the initial state of each member
+    /// @brief Can only be used with a sorted instants array. See calculateEnsembleStateAt.
+    ///
+    /// @code{.cpp}
+    ///              Array<Array<State>> states = propagator.calculateEnsembleStatesAt(aStateArray, anInstantArray);
+    /// @endcode
+    /// @param aStateArray An array of initial states, one per member
+    /// @param anInstantArray An instant array, shared by all members
+    /// @param (optional) aThreadCount A thread count, 0 to use the hardware concurrency
+    /// @return Array<Array<State>>, the states of each member at the given instants
+    Array<Array<State>> calculateEnsembleStatesAt(
+        const Array<State>& aStateArray, const Array<Instant>& anInstantArray, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Calculate the states of an ensemble at per-member arrays of instants, given the initial state of each
+    /// member
+    /// @brief Can only be used with sorted instants arrays. See calculateEnsembleStateAt.
+    ///
+    /// @code{.cpp}
+    ///              Array<Array<State>> states = propagator.calculateEnsembleStatesAt(aStateArray, anInstantArrays);
+    /// @endcode
+    /// @param aStateArray An array of initial states, one per member
+    /// @param anInstantArrays An array of instant arrays, one per member
+    /// @param (optional) aThreadCount A thread count, 0 to use the hardware concurrency
+    /// @return Array<Array<State>>, the states of each member at its instants
+    Array<Array<State>> calculateEnsembleStatesAt(
+        const Array<State>& aStateArray, const Array<Array<Instant>>& anInstantArrays, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Calculate the states of a batch at an instant, given the initial state of each member
+    /// @brief All members must share the same initial instant. They are integrated together as a structure of arrays
+    /// (one row per member), with a shared step, and each dynamics evaluates its contribution for the whole batch at
+    /// once. With an adaptive stepper, the shared step is driven by the least accurate member, so results agree with
+    /// calculateStateAt within the integration tolerances.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = propagator.calculateBatchStateAt(aStateArray, anInstant);
+    /// @endcode
+    /// @param aStateArray An array of initial states, one per member
+    /// @param anInstant An instant
+    /// @return Array<State>, one state per member
+    Array<State> calculateBatchStateAt(const Array<State>& aStateArray, const Instant& anInstant) const;
+
+    /// @brief Calculate the states of a batch at an array of instants, given the initial state of each member
+    /// @brief Can only be used with a sorted instants array. See calculateBatchStateAt.
+    ///
+    /// @code{.cpp}
+    ///              Array<Array<State>> states = propagator.calculateBatchStatesAt(aStateArray, anInstantArray);
+    /// @endcode
+    /// @param aStateArray An array of initial states, one per member
+    /// @param anInstantArray An instant array, shared by all members
+    /// @return Array<Array<State>>, the states of each member at the given instants
+    Array<Array<State>> calculateBatchStatesAt(
+        const Array<State>& aStateArray, const Array<Instant>& anInstantArray
+    ) const;
+
     /// @brief Print propagator
     ///
     /// @param anOutputStream An output stream
@@ -236,9 +390,29 @@ class Propagator
    private:
     Shared<CoordinateBroker> coordinatesBrokerSPtr_ = std::make_shared<CoordinateBroker>();
     Array<Dynamics::Context> dynamicsContexts_ = Array<Dynamics::Context>::Empty();
-    mutable NumericalSolver numericalSolver_;
+    NumericalSolver numericalSolver_;
 
     void validateDynamicsSet() const;
+
+    State propagateStateAt(
+        const State& aState,
+        const Instant& anInstant,
+        const StateBuilder& aSolverStateBuilder,
+        NumericalSolver& aNumericalSolver
+    ) const;
+
+    Array<State> propagateStatesAt(
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        const StateBuilder& aSolverStateBuilder,
+        NumericalSolver& aNumericalSolver
+    ) const;
+
+    void propagateEnsemble(
+        const Size& aMemberCount,
+        const Size& aThreadCount,
+        const std::function<void(const Index&, const StateBuilder&, NumericalSolver&)>& aMemberFunction
+    ) const;
 };
 
 }  // namespace trajectory
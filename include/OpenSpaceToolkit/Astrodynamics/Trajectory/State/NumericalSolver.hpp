@@ -3,11 +3,20 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_StateNumericalSolver__
 #define __OpenSpaceToolkit_Astrodynamics_StateNumericalSolver__
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
@@ -24,7 +33,11 @@ namespace state
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::RootSolver;
@@ -36,6 +49,15 @@ using MathNumericalSolver = ostk::mathematics::solver::NumericalSolver;
 class NumericalSolver : public MathNumericalSolver
 {
    public:
+    /// @brief State vector of a size known at compile time, whose arithmetic does not allocate.
+    template <Size N>
+    using FixedSizeStateVector = Eigen::Matrix<double, N, 1>;
+
+    /// @brief System of equations on fixed size state vectors.
+    template <Size N>
+    using FixedSizeSystemOfEquationsWrapper =
+        std::function<void(const FixedSizeStateVector<N>&, FixedSizeStateVector<N>&, const double)>;
+
     /// @brief Structure to hold the condition solution.
     struct ConditionSolution
     {
@@ -45,6 +67,142 @@ class NumericalSolver : public MathNumericalSolver
         bool rootSolverHasConverged;  ///< Whether the root solver has converged.
     };
 
+    /// @brief Opt-in record of the cost of the solves performed by a numerical solver and its copies.
+    ///
+    /// @details Records the number of evaluations of the system of equations, the accepted and rejected steps, the
+    /// accepted step sizes and the wall time of the solves, along with the wall time spent in each named contribution
+    /// to the system of equations (e.g. each dynamics of a propagator). Accepted steps are recorded in every mode,
+    /// with the rejected ones counted where the stepper exposes them: dense output and integration to a single
+    /// instant hide them. Integrating to several instants with logging or an Adams-Bashforth-Moulton stepper is
+    /// delegated to the mathematics library, which does not expose its steps, so none are recorded then. Recording is
+    /// thread safe, so that a profile can be shared by solvers running concurrently.
+    ///
+    /// @code{.cpp}
+    ///     Shared<NumericalSolver::Profile> profileSPtr = std::make_shared<NumericalSolver::Profile>();
+    ///     numericalSolver.setProfile(profileSPtr);
+    ///     ...
+    ///     profileSPtr->getEvaluationCount();
+    /// @endcode
+    class Profile
+    {
+       public:
+        /// @brief Accumulator of the wall time spent in a named contribution to the system of equations.
+        class Timer
+        {
+           public:
+            /// @brief Constructor
+            Timer();
+
+            /// @brief Add a duration
+            ///
+            /// @param aDuration A duration
+            void add(const std::chrono::nanoseconds& aDuration);
+
+            /// @brief Get the accumulated duration
+            ///
+            /// @return Accumulated duration
+            Duration getDuration() const;
+
+            /// @brief Reset the accumulated duration
+            void reset();
+
+           private:
+            std::atomic<std::int64_t> nanosecondCount_;
+        };
+
+        /// @brief Record of a single solve.
+        struct Record
+        {
+            Size evaluationCount = 0;                                              ///< Evaluation count.
+            Size acceptedStepCount = 0;                                            ///< Accepted step count.
+            Size rejectedStepCount = 0;                                            ///< Rejected step count.
+            Array<Real> stepSizes = Array<Real>::Empty();                          ///< Accepted step sizes [s].
+            std::chrono::nanoseconds evaluationDuration = std::chrono::nanoseconds::zero();  ///< Evaluation time.
+            std::chrono::nanoseconds duration = std::chrono::nanoseconds::zero();            ///< Solve time.
+        };
+
+        /// @brief Constructor
+        ///
+        /// @code{.cpp}
+        ///     NumericalSolver::Profile profile;
+        /// @endcode
+        Profile();
+
+        /// @brief Output stream operator
+        ///
+        /// @param anOutputStream An output stream
+        /// @param aProfile A profile
+        /// @return A reference to output stream
+        friend std::ostream& operator<<(std::ostream& anOutputStream, const Profile& aProfile);
+
+        /// @brief Get the number of recorded solves
+        ///
+        /// @return Solve count
+        Size getSolveCount() const;
+
+        /// @brief Get the number of evaluations of the system of equations
+        ///
+        /// @return Evaluation count
+        Size getEvaluationCount() const;
+
+        /// @brief Get the number of accepted steps
+        ///
+        /// @return Accepted step count
+        Size getAcceptedStepCount() const;
+
+        /// @brief Get the number of rejected steps
+        ///
+        /// @return Rejected step count
+        Size getRejectedStepCount() const;
+
+        /// @brief Get the signed sizes of the accepted steps, in seconds, in the order they were taken
+        ///
+        /// @return Step sizes
+        Array<Real> getStepSizes() const;
+
+        /// @brief Get the wall time spent in the solves
+        ///
+        /// @return Solve duration
+        Duration getDuration() const;
+
+        /// @brief Get the wall time spent evaluating the system of equations
+        ///
+        /// @return Evaluation duration
+        Duration getEvaluationDuration() const;
+
+        /// @brief Get the wall time spent in each named contribution to the system of equations, in the order the
+        /// contributions were first recorded
+        ///
+        /// @return Contribution names and durations
+        Array<Pair<String, Duration>> getContributionDurations() const;
+
+        /// @brief Access the timer of a named contribution to the system of equations, creating it on first request
+        ///
+        /// @param aName A contribution name
+        /// @return Contribution timer
+        Shared<Timer> accessContributionTimer(const String& aName);
+
+        /// @brief Add the record of a solve
+        ///
+        /// @param aRecord A solve record
+        void add(const Record& aRecord);
+
+        /// @brief Reset the profile, keeping the contribution timers
+        void reset();
+
+        /// @brief Print the profile
+        ///
+        /// @param anOutputStream An output stream
+        /// @param displayDecorator If true, display decorator
+        void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+       private:
+        mutable std::mutex mutex_;
+        Size solveCount_;
+        Record total_;
+        Array<Pair<String, Shared<Timer>>> contributionTimers_;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -110,8 +268,83 @@ class NumericalSolver : public MathNumericalSolver
     ///                     limit.
     void setMaxStepSize(const Real& aMaxStepSize);
 
+    /// @brief Check whether dense output is enabled
+    ///
+    /// @return True if dense output is enabled
+    bool isDenseOutputEnabled() const;
+
+    /// @brief Enable or disable dense output when integrating to an array of instants.
+    ///
+    /// @details With dense output, the stepper takes its natural (error controlled) steps and the requested instants
+    ///          are interpolated with its continuous extension, so that the number of steps does not depend on the
+    ///          output cadence. Only supported with the RungeKuttaDopri5 and BulirschStoer steppers.
+    ///
+    /// @param isEnabled True to enable dense output
+    void setDenseOutputEnabled(const bool& isEnabled);
+
+    /// @brief Check whether Gauss-Jackson integration is enabled
+    ///
+    /// @return True if Gauss-Jackson integration is enabled
+    bool isGaussJacksonEnabled() const;
+
+    /// @brief Enable or disable Gauss-Jackson integration.
+    ///
+    /// @details The 8th order Gauss-Jackson summed multistep method integrates with a fixed step equal to the solver
+    ///          time step, evaluating the system of equations twice per step (predict, evaluate, correct, evaluate).
+    ///          The first coordinates are expected to be positions followed by their velocities (as laid out by the
+    ///          Cartesian position and velocity subsets), positions being integrated from the second sums of the
+    ///          accelerations and every other coordinate with the summed Adams method. When this layout is not
+    ///          detected, all coordinates are integrated with the summed Adams method. The method is started, and
+    ///          instants that do not fall on the fixed step grid are reached, with a Runge-Kutta-Fehlberg 7(8)
+    ///          stepper using the solver tolerances. Cannot be combined with dense output.
+    ///
+    /// @param isEnabled True to enable Gauss-Jackson integration
+    void setGaussJacksonEnabled(const bool& isEnabled);
+
+    /// @brief Get the Sundman transformation exponent
+    ///
+    /// @return Sundman transformation exponent, or Real::Undefined() if the transformation is disabled
+    Real getSundmanExponent() const;
+
+    /// @brief Set the exponent of the Sundman time transformation, to efficiently integrate highly eccentric orbits.
+    ///
+    /// @details The system of equations is integrated, along with the time, in the regularized independent variable
+    ///          s defined by dt/ds = (r / r0)^α, where r is the norm of the first three coordinates (the position, as
+    ///          laid out by the Cartesian position subset), r0 its initial value and α the exponent. An exponent of 1
+    ///          makes s proportional to the eccentric anomaly of a Keplerian orbit, and an exponent of 1.5 to the
+    ///          intermediate anomaly, so that steps shorten around periapsis and lengthen around apoapsis. The solver
+    ///          stepper takes its steps in s, and instants between steps (requested instants, end times and event
+    ///          refinement) are reached by integrating in time from the last step before them. Not supported with
+    ///          Adams-Bashforth-Moulton steppers, and cannot be combined with dense output or Gauss-Jackson
+    ///          integration.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setSundmanExponent(1.5);
+    /// @endcode
+    ///
+    /// @param aSundmanExponent Strictly positive exponent. Use Real::Undefined() to disable the transformation.
+    void setSundmanExponent(const Real& aSundmanExponent);
+
+    /// @brief Get the profile recording the solves
+    ///
+    /// @return Profile, or nullptr if profiling is disabled
+    Shared<Profile> getProfile() const;
+
+    /// @brief Set the profile recording the solves. Copies of the solver (e.g. the ones held by a propagator or a
+    ///        segment) record into the same profile.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setProfile(std::make_shared<NumericalSolver::Profile>());
+    /// @endcode
+    ///
+    /// @param aProfileSPtr A profile, or nullptr to disable profiling
+    void setProfile(const Shared<Profile>& aProfileSPtr);
+
     /// @brief Perform numerical integration for a given array of time instants.
     ///
+    /// @details When dense output is enabled, states at the given instants are interpolated between steps rather
+    /// than stepped to.
+    ///
     /// @param aState Initial state for integration.
     /// @param aTimeArray Array of time instants.
     /// @param aSystemOfEquations System of equations to integrate.
@@ -130,6 +363,62 @@ class NumericalSolver : public MathNumericalSolver
         const State& aState, const Instant& anInstant, const SystemOfEquationsWrapper& aSystemOfEquations
     );
 
+    /// @brief Perform numerical integration of a state of fixed size for a given array of time instants.
+    ///
+    /// @details The stepper then works on fixed size state vectors, which avoids the allocations and dynamic size
+    /// loops of the generic path. Instantiated for sizes 6, 7 and 8 (e.g. cartesian position and velocity, followed by
+    /// mass and surface). Dense output, Gauss-Jackson and Sundman integration, Adams-Bashforth-Moulton steppers and
+    /// logging are not specialized, and go through the generic path.
+    ///
+    /// @code{.cpp}
+    ///     Array<State> states = numericalSolver.integrateTime<6>(state, instants, systemOfEquations);
+    /// @endcode
+    ///
+    /// @param aState Initial state for integration, of size N.
+    /// @param aTimeArray Array of time instants.
+    /// @param aSystemOfEquations System of equations to integrate.
+    /// @return Array of states for each time instant.
+    template <Size N>
+    Array<State> integrateTime(
+        const State& aState,
+        const Array<Instant>& aTimeArray,
+        const FixedSizeSystemOfEquationsWrapper<N>& aSystemOfEquations
+    );
+
+    /// @brief Perform numerical integration of a state of fixed size from a start time to an end time.
+    ///
+    /// @details See the array overload for the modes that are specialized.
+    ///
+    /// @code{.cpp}
+    ///     State state = numericalSolver.integrateTime<6>(state, instant, systemOfEquations);
+    /// @endcode
+    ///
+    /// @param aState Initial state for integration, of size N.
+    /// @param anInstant Time to integrate to.
+    /// @param aSystemOfEquations System of equations to integrate.
+    /// @return Final state after integration.
+    template <Size N>
+    State integrateTime(
+        const State& aState, const Instant& anInstant, const FixedSizeSystemOfEquationsWrapper<N>& aSystemOfEquations
+    );
+
+    /// @brief Perform numerical integration of a batch state vector for a given array of time instants.
+    ///
+    /// @details The batch state vector holds the coordinates of several members (as laid out by the system of
+    /// equations) and is integrated as a whole, so that all members share the same steps.
+    ///
+    /// @param aBatchStateVector Initial batch state vector.
+    /// @param aStartInstant Instant of the initial batch state vector.
+    /// @param aTimeArray Array of time instants.
+    /// @param aSystemOfEquations System of equations to integrate.
+    /// @return Array of batch state vectors for each time instant.
+    Array<StateVector> integrateBatchTime(
+        const StateVector& aBatchStateVector,
+        const Instant& aStartInstant,
+        const Array<Instant>& aTimeArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
     /// @brief Perform numerical integration from a start time until either a condition or an end time
     /// is reached.
     ///
@@ -246,6 +535,11 @@ class NumericalSolver : public MathNumericalSolver
     Array<State> observedStates_;
     std::function<void(const State&)> stateLogger_;
     Real maxStepSize_ = Real::Undefined();
+    bool denseOutputEnabled_ = false;
+    bool gaussJacksonEnabled_ = false;
+    Real sundmanExponent_ = Real::Undefined();
+    Shared<Profile> profileSPtr_ = nullptr;
+    Profile::Record profileRecord_;
 
     /// @brief Constructor
     ///
@@ -274,6 +568,85 @@ class NumericalSolver : public MathNumericalSolver
     /// @param aState The state to observe
     void observeState(const State& aState);
 
+    /// @brief Wrap a system of equations so that its evaluations are recorded, when profiling
+    ///
+    /// @param aSystemOfEquations The system of equations
+    /// @return The recorded system of equations, or the given one when not profiling
+    template <typename SystemOfEquations>
+    SystemOfEquations profileSystemOfEquations(const SystemOfEquations& aSystemOfEquations);
+
+    /// @brief Whether the current mode and stepper are specialized for fixed size state vectors
+    ///
+    /// @return True if fixed size integration is specialized
+    bool fixedSizeIntegrationIsSpecialized() const;
+
+    /// @brief Record an accepted step, when profiling
+    ///
+    /// @param aStepSize The signed step size, in seconds
+    /// @param aRejectedStepCount The number of steps rejected before it
+    void profileStep(const double& aStepSize, const Size& aRejectedStepCount);
+
+    /// @brief Integrate to an array of durations with the stepper of the solver.
+    ///
+    /// @details Forward and backward durations are integrated separately, each in chronological order, from the
+    /// same initial state. With logging enabled or an Adams-Bashforth-Moulton stepper, the integration is delegated
+    /// to the mathematics library, which does not expose its steps.
+    ///
+    /// @param aStateVector The initial state vector
+    /// @param aDurationArray The durations (in seconds) to integrate to, in any order
+    /// @param aSystemOfEquations The system of equations to integrate
+    /// @return The state vectors at each duration, in the order of the durations
+    Array<StateVector> integrateDurationWithStepper(
+        const StateVector& aStateVector,
+        const Array<Real>& aDurationArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief Integrate to an array of durations with a dense-output stepper.
+    ///
+    /// @details Forward and backward durations are integrated separately, each in chronological order, from the
+    /// same initial state.
+    ///
+    /// @param aStateVector The initial state vector
+    /// @param aDurationArray The durations (in seconds) to integrate to, in any order
+    /// @param aSystemOfEquations The system of equations to integrate
+    /// @return The state vectors at each duration, in the order of the durations
+    Array<StateVector> integrateDurationWithDenseOutput(
+        const StateVector& aStateVector,
+        const Array<Real>& aDurationArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief Integrate to an array of durations with the Gauss-Jackson method.
+    ///
+    /// @details Forward and backward durations are integrated separately, each in chronological order, from the
+    /// same initial state.
+    ///
+    /// @param aStateVector The initial state vector
+    /// @param aDurationArray The durations (in seconds) to integrate to, in any order
+    /// @param aSystemOfEquations The system of equations to integrate
+    /// @return The state vectors at each duration, in the order of the durations
+    Array<StateVector> integrateDurationWithGaussJackson(
+        const StateVector& aStateVector,
+        const Array<Real>& aDurationArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief Integrate to an array of durations in the Sundman regularized independent variable.
+    ///
+    /// @details Forward and backward durations are integrated separately, each in chronological order, from the
+    /// same initial state.
+    ///
+    /// @param aStateVector The initial state vector
+    /// @param aDurationArray The durations (in seconds) to integrate to, in any order
+    /// @param aSystemOfEquations The system of equations to integrate
+    /// @return The state vectors at each duration, in the order of the durations
+    Array<StateVector> integrateDurationWithSundmanTransformation(
+        const StateVector& aStateVector,
+        const Array<Real>& aDurationArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
     /// @brief Integrate with controlled stepper using the unified dense-output refinement.
     ///
     /// @param aState The initial state for integration
@@ -0,0 +1,34 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Utility_FastAtan2__
+#define __OpenSpaceToolkit_Astrodynamics_Utility_FastAtan2__
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace utility
+{
+
+/// @brief Element-wise atan2, written with branch-free array operations so that it vectorizes.
+///
+/// @details The octant is reduced to a ratio in [0, 1], then to [-0.2, 0.66] using atan(t) = pi/4 + atan((t - 1) /
+/// (t + 1)), where a rational minimax approximation (Cephes) is accurate to a few ulps. Signed zeros and infinities
+/// are handled as by std::atan2.
+///
+/// @code{.cpp}
+///     Eigen::ArrayXd angles_rad = FastAtan2(someY, someX);
+/// @endcode
+///
+/// @param y The ordinates
+/// @param x The abscissas, with as many elements as y
+/// @return The angles [rad], in [-pi, pi]
+Eigen::ArrayXd FastAtan2(const Eigen::ArrayXd& y, const Eigen::ArrayXd& x);
+
+}  // namespace utility
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
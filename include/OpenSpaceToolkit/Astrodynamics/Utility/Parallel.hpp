@@ -0,0 +1,43 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Utility_Parallel__
+#define __OpenSpaceToolkit_Astrodynamics_Utility_Parallel__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief Invoke aFunction for every index in [0, aCount) using up to aThreadCount threads.
+///
+/// @details Indices are handed out dynamically, so uneven workloads balance across threads. aFunction receives the
+/// item index and the index of the worker running it (in [0, min(aCount, aThreadCount))), which lets callers keep
+/// per-worker state. The calling thread acts as worker 0. If any invocation throws, remaining items are skipped and
+/// the first captured exception is rethrown once all workers have joined.
+///
+/// @code{.cpp}
+///     ParallelFor(states.getSize(), 4, [&](const Index& anIndex, const Index& aWorkerIndex) { ... });
+/// @endcode
+///
+/// @param aCount The number of items
+/// @param aThreadCount The maximum number of threads, including the calling one
+/// @param aFunction The function to invoke, with the item index and the worker index
+void ParallelFor(
+    const Size& aCount, const Size& aThreadCount, const std::function<void(const Index&, const Index&)>& aFunction
+);
+
+}  // namespace utility
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
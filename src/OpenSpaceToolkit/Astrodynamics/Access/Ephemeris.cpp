@@ -0,0 +1,110 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/Ephemeris.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::type::Index;
+
+using ostk::astrodynamics::trajectory::State;
+
+Ephemeris::Ephemeris(
+    const Trajectory& aTrajectory, const Array<Instant>& someInstants, const Shared<const Frame>& aFrameSPtr
+)
+    : trajectory_(aTrajectory),
+      instants_(someInstants),
+      positionCoordinates_(MatrixXd::Zero(3, someInstants.getSize())),
+      frameSPtr_(aFrameSPtr)
+{
+    if (!this->isDefined())
+    {
+        return;
+    }
+
+    for (Index i = 1; i < instants_.getSize(); ++i)
+    {
+        if (!(instants_[i - 1] < instants_[i]))
+        {
+            throw ostk::core::error::RuntimeError("Ephemeris instants must be in strictly ascending order.");
+        }
+    }
+
+    // evaluate the trajectory in a single call, which lets propagated models integrate the whole grid in one go
+    const Array<State> states = trajectory_.getStatesAt(instants_);
+
+    for (Index i = 0; i < instants_.getSize(); ++i)
+    {
+        positionCoordinates_.col(i) = states[i].getPosition().inFrame(frameSPtr_, instants_[i]).getCoordinates();
+    }
+}
+
+bool Ephemeris::isDefined() const
+{
+    return trajectory_.isDefined() && (frameSPtr_ != nullptr) && frameSPtr_->isDefined();
+}
+
+const Trajectory& Ephemeris::accessTrajectory() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return trajectory_;
+}
+
+const Array<Instant>& Ephemeris::accessInstants() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return instants_;
+}
+
+const MatrixXd& Ephemeris::accessPositionCoordinates() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return positionCoordinates_;
+}
+
+const Shared<const Frame>& Ephemeris::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return frameSPtr_;
+}
+
+Size Ephemeris::getSize() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return instants_.getSize();
+}
+
+Ephemeris Ephemeris::Undefined()
+{
+    return {Trajectory::Undefined(), Array<Instant>::Empty(), Frame::Undefined()};
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,64 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cstddef>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/FlattenedAzimuthElevationMasks.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+FlattenedAzimuthElevationMasks::FlattenedAzimuthElevationMasks(const Array<VisibilityCriterion::AERMask>& someAERMasks)
+{
+    offsets_.reserve(someAERMasks.getSize() + 1);
+    offsets_.push_back(0);
+
+    for (const VisibilityCriterion::AERMask& aerMask : someAERMasks)
+    {
+        for (const auto& [azimuth_rad, elevation_rad] : aerMask.azimuthElevationMask)
+        {
+            azimuths_rad_.push_back(azimuth_rad);
+            elevations_rad_.push_back(elevation_rad);
+        }
+
+        offsets_.push_back(azimuths_rad_.size());
+        ranges_.push_back(aerMask.range);
+    }
+}
+
+Size FlattenedAzimuthElevationMasks::getTargetCount() const
+{
+    return ranges_.size();
+}
+
+bool FlattenedAzimuthElevationMasks::isSatisfied(
+    const Index& aTargetIndex, const double& anAzimuth_rad, const double& anElevation_rad, const double& aRange_m
+) const
+{
+    const double* azimuthsBegin = azimuths_rad_.data() + offsets_[aTargetIndex];
+    const double* azimuthsEnd = azimuths_rad_.data() + offsets_[aTargetIndex + 1];
+
+    const std::ptrdiff_t breakpointCount = azimuthsEnd - azimuthsBegin;
+    const std::ptrdiff_t lowIndex = std::clamp<std::ptrdiff_t>(
+        std::upper_bound(azimuthsBegin, azimuthsEnd, anAzimuth_rad) - azimuthsBegin - 1, 0, breakpointCount - 2
+    );
+
+    const double* elevations = elevations_rad_.data() + offsets_[aTargetIndex];
+
+    const double lowToUpAzimuth = azimuthsBegin[lowIndex + 1] - azimuthsBegin[lowIndex];
+    const double lowToUpElevation = elevations[lowIndex + 1] - elevations[lowIndex];
+
+    const double lowToPointAzimuth = anAzimuth_rad - azimuthsBegin[lowIndex];
+    const double lowToPointElevation = anElevation_rad - elevations[lowIndex];
+
+    return ((lowToUpAzimuth * lowToPointElevation - lowToUpElevation * lowToPointAzimuth) >= 0.0) &&
+           ranges_[aTargetIndex].contains(aRange_m);
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,7 +1,11 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <mutex>
 #include <nlopt.hpp>
+#include <optional>
 
 #include <OpenSpaceToolkit/Core/Container/Triple.hpp>
 
@@ -9,11 +13,15 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Access/FlattenedAzimuthElevationMasks.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Solver/TemporalConditionSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utility/FastAtan2.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utility/Parallel.hpp>
 
 using ostk::core::container::Map;
 using ostk::core::container::Triple;
@@ -21,6 +29,7 @@ using ostk::core::type::Real;
 
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::object::Segment;
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::MatrixXi;
 using ostk::mathematics::object::Vector2d;
@@ -28,14 +37,19 @@ using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 using ostk::mathematics::object::VectorXi;
 using ArrayXb = Eigen::Array<bool, Eigen::Dynamic, 1>;
+using ArrayXd = Eigen::ArrayXd;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::Velocity;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::Object;
 using ostk::physics::environment::object::celestial::Earth;
 
 using ostk::astrodynamics::RootSolver;
 using ostk::astrodynamics::solver::TemporalConditionSolver;
+using ostk::astrodynamics::utility::FastAtan2;
+using ostk::astrodynamics::utility::ParallelFor;
 
 namespace ostk
 {
@@ -44,6 +58,324 @@ namespace astrodynamics
 namespace access
 {
 
+namespace
+{
+
+/// @brief Return the wall-clock time elapsed since aStartTime.
+Duration ElapsedSince(const std::chrono::steady_clock::time_point& aStartTime)
+{
+    return Duration::Nanoseconds(static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - aStartTime).count()
+    ));
+}
+
+/// @brief Get the state of a trajectory at an instant, counting the evaluation when statistics are collected.
+State GetStateAt(const Trajectory& aTrajectory, const Instant& anInstant, Generator::Statistics* aStatisticsPtr)
+{
+    if (aStatisticsPtr != nullptr)
+    {
+        aStatisticsPtr->trajectoryEvaluationCount += 1;
+    }
+
+    return aTrajectory.getStateAt(anInstant);
+}
+
+/// @brief Express a position in a frame, counting the transform when statistics are collected.
+Position GetPositionInFrame(
+    const Position& aPosition,
+    const Shared<const Frame>& aFrameSPtr,
+    const Instant& anInstant,
+    Generator::Statistics* aStatisticsPtr
+)
+{
+    if (aStatisticsPtr != nullptr)
+    {
+        aStatisticsPtr->frameTransformCount += 1;
+    }
+
+    return aPosition.inFrame(aFrameSPtr, anInstant);
+}
+
+/// @brief Get the position coordinates of a trajectory in a frame, counting the evaluation and the transform when
+/// statistics are collected.
+Vector3d GetPositionCoordinatesInFrame(
+    const Trajectory& aTrajectory,
+    const Shared<const Frame>& aFrameSPtr,
+    const Instant& anInstant,
+    Generator::Statistics* aStatisticsPtr
+)
+{
+    const State state = GetStateAt(aTrajectory, anInstant, aStatisticsPtr);
+
+    return GetPositionInFrame(state.getPosition(), aFrameSPtr, anInstant, aStatisticsPtr).getCoordinates();
+}
+
+/// @brief Copy a trajectory once per worker.
+///
+/// @details Trajectory models may cache state while being evaluated (e.g. propagated or multi-TLE models), so a
+/// trajectory shared between workers is copied (deep-cloning its model) instead of being evaluated concurrently.
+/// Returns an empty array when a single worker is used, in which case the original trajectory should be used.
+Array<Trajectory> CopyTrajectoryPerWorker(const Trajectory& aTrajectory, const Size& aWorkerCount)
+{
+    if (aWorkerCount <= 1)
+    {
+        return Array<Trajectory>::Empty();
+    }
+
+    return Array<Trajectory>(aWorkerCount, aTrajectory);
+}
+
+/// @brief Invoke a batch state filter, and check that it returns one value per "from" state.
+Array<bool> ApplyBatchStateFilter(
+    const std::function<Array<bool>(const State&, const Array<State>&)>& aBatchStateFilter,
+    const State& aToState,
+    const Array<State>& someFromStates
+)
+{
+    const Array<bool> isRetained = aBatchStateFilter(aToState, someFromStates);
+
+    if (isRetained.getSize() != someFromStates.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Batch state filter returned [{}] values for [{}] states.", isRetained.getSize(), someFromStates.getSize()
+        );
+    }
+
+    return isRetained;
+}
+
+/// @brief Coarse access interval of a (trajectory, fixed target) pair, refined as a separate work item.
+struct CoarseAccess
+{
+    Index trajectoryIndex;
+    Index targetIndex;
+    physics::time::Interval interval;  /// Coarse access interval
+    Instant previousAccessEnd;         /// End of the previous coarse access of the pair, if any
+};
+
+/// @brief Find the index of an instant in an array of instants sorted in ascending order.
+///
+/// @details Grid instants are looked up in ascending order, so the hint (the index following the previous match)
+/// usually matches right away. A binary search is used otherwise.
+std::optional<Index> FindInstantIndex(
+    const Array<Instant>& someInstants, const Instant& anInstant, const Index& aHintIndex
+)
+{
+    if ((aHintIndex < someInstants.getSize()) && (someInstants[aHintIndex] == anInstant))
+    {
+        return aHintIndex;
+    }
+
+    const auto instantIterator = std::lower_bound(someInstants.begin(), someInstants.end(), anInstant);
+
+    if ((instantIterator != someInstants.end()) && ((*instantIterator) == anInstant))
+    {
+        return static_cast<Index>(std::distance(someInstants.begin(), instantIterator));
+    }
+
+    return std::nullopt;
+}
+
+/// @brief Fixed target geometry laid out as structure-of-arrays.
+///
+/// @details Every component is stored in its own contiguous buffer holding one entry per target, so that the
+/// per-instant visibility kernels reduce to element-wise array expressions which Eigen vectorizes.
+struct FixedTargetBuffers
+{
+    std::array<ArrayXd, 3> position_ITRF;  /// Target position coordinates [m]
+    std::array<ArrayXd, 9> R_SEZ_ITRF;     /// Row-major entries of the ITRF to SEZ rotation
+    std::array<ArrayXd, 3> zenith_ITRF;    /// Geocentric zenith direction
+};
+
+/// @brief Line-of-sight vectors from every target to the observer, expressed in each target SEZ frame.
+struct SEZVectors
+{
+    ArrayXd south;
+    ArrayXd east;
+    ArrayXd zenith;
+};
+
+FixedTargetBuffers BuildFixedTargetBuffers(
+    const MatrixXd& somePositionCoordinates_ITRF, const Array<Matrix3d>& someSEZRotations
+)
+{
+    const Eigen::Index targetCount = somePositionCoordinates_ITRF.cols();
+
+    FixedTargetBuffers buffers;
+
+    const MatrixXd zenithDirections_ITRF = somePositionCoordinates_ITRF.colwise().normalized();
+
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        buffers.position_ITRF[k] = somePositionCoordinates_ITRF.row(k).transpose().array();
+        buffers.zenith_ITRF[k] = zenithDirections_ITRF.row(k).transpose().array();
+    }
+
+    for (Eigen::Index k = 0; k < 9; ++k)
+    {
+        buffers.R_SEZ_ITRF[k].resize(targetCount);
+
+        for (Eigen::Index i = 0; i < targetCount; ++i)
+        {
+            buffers.R_SEZ_ITRF[k](i) = someSEZRotations[i](k / 3, k % 3);
+        }
+    }
+
+    return buffers;
+}
+
+SEZVectors ComputeSEZVectors(const FixedTargetBuffers& someBuffers, const Vector3d& aToPositionCoordinates_ITRF)
+{
+    const ArrayXd dx = aToPositionCoordinates_ITRF(0) - someBuffers.position_ITRF[0];
+    const ArrayXd dy = aToPositionCoordinates_ITRF(1) - someBuffers.position_ITRF[1];
+    const ArrayXd dz = aToPositionCoordinates_ITRF(2) - someBuffers.position_ITRF[2];
+
+    const std::array<ArrayXd, 9>& R = someBuffers.R_SEZ_ITRF;
+
+    return {
+        R[0] * dx + R[1] * dy + R[2] * dz,
+        R[3] * dx + R[4] * dy + R[5] * dz,
+        R[6] * dx + R[7] * dy + R[8] * dz,
+    };
+}
+
+/// @brief Azimuth [rad] in [0, 2pi) of SEZ vectors.
+ArrayXd ComputeAzimuths(const SEZVectors& someSEZVectors)
+{
+    const ArrayXd azimuths_rad = FastAtan2(someSEZVectors.east, -someSEZVectors.south);
+
+    return (azimuths_rad < 0.0).select(azimuths_rad + 2.0 * M_PI, azimuths_rad);
+}
+
+/// @brief Line of sight occulted by the ellipsoids of the celestial objects of an environment.
+///
+/// @details Stands in for VisibilityCriterion::LineOfSight when its environment only holds celestial objects. A
+/// segment is occulted when it enters the interior of an ellipsoid (up to a few millimeters for Earth-sized bodies),
+/// which is checked in closed form (closest point of the segment in the frame where the ellipsoid is the unit sphere)
+/// for whole arrays of points at once. Evaluation
+/// does not update any state, unlike the criterion environment, so a single instance can be shared between threads.
+class EllipsoidLineOfSight
+{
+   public:
+    /// @brief Build from a line-of-sight criterion. Returns an empty optional if its environment holds objects which
+    /// are not celestial objects, or celestial objects without a defined shape.
+    static std::optional<EllipsoidLineOfSight> FromLineOfSight(const VisibilityCriterion::LineOfSight& aLineOfSight)
+    {
+        const Environment& environment = aLineOfSight.environment;
+
+        EllipsoidLineOfSight ellipsoidLineOfSight;
+
+        // same frame convention as VisibilityCriterion::LineOfSight::isSatisfied
+        ellipsoidLineOfSight.frameSPtr_ = environment.hasCentralCelestialObject()
+                                            ? environment.accessCentralCelestialObject()->accessFrame()
+                                            : Frame::ITRF();
+
+        for (const auto& objectSPtr : environment.accessObjects())
+        {
+            const Shared<const Celestial> celestialSPtr = std::dynamic_pointer_cast<const Celestial>(objectSPtr);
+
+            if ((celestialSPtr == nullptr) || (!celestialSPtr->getEquatorialRadius().isDefined()) ||
+                (!celestialSPtr->getFlattening().isDefined()))
+            {
+                return std::nullopt;
+            }
+
+            const double equatorialRadius_m = celestialSPtr->getEquatorialRadius().inMeters();
+            const double polarRadius_m = equatorialRadius_m * (1.0 - celestialSPtr->getFlattening());
+
+            ellipsoidLineOfSight.occulters_.push_back({
+                celestialSPtr,
+                Vector3d(1.0 / equatorialRadius_m, 1.0 / equatorialRadius_m, 1.0 / polarRadius_m),
+            });
+        }
+
+        return ellipsoidLineOfSight;
+    }
+
+    /// @brief Visibility between every point of someFromPositionCoordinates (structure-of-arrays) and a single point.
+    ArrayXb isSatisfied(
+        const Instant& anInstant,
+        const std::array<ArrayXd, 3>& someFromPositionCoordinates,
+        const Vector3d& aToPositionCoordinates
+    ) const
+    {
+        ArrayXb isVisible = ArrayXb::Constant(someFromPositionCoordinates[0].rows(), true);
+
+        for (const Occulter& occulter : this->occulters_)
+        {
+            // affine map to the occulter frame, scaled so that its ellipsoid is the unit sphere
+            const Transform transform =
+                this->frameSPtr_->getTransformTo(occulter.celestialSPtr->accessFrame(), anInstant);
+
+            Matrix3d scaledRotation;
+            for (Eigen::Index k = 0; k < 3; ++k)
+            {
+                scaledRotation.col(k) = occulter.inverseRadii.cwiseProduct(transform.applyToVector(Vector3d::Unit(k)));
+            }
+
+            const Vector3d scaledTranslation =
+                occulter.inverseRadii.cwiseProduct(transform.applyToPosition(Vector3d::Zero()));
+
+            const Vector3d to = scaledRotation * aToPositionCoordinates + scaledTranslation;
+
+            std::array<ArrayXd, 3> from;
+            std::array<ArrayXd, 3> direction;
+
+            for (Eigen::Index k = 0; k < 3; ++k)
+            {
+                from[k] = scaledRotation(k, 0) * someFromPositionCoordinates[0] +
+                          scaledRotation(k, 1) * someFromPositionCoordinates[1] +
+                          scaledRotation(k, 2) * someFromPositionCoordinates[2] + scaledTranslation(k);
+                direction[k] = to(k) - from[k];
+            }
+
+            // closest point of the segment to the ellipsoid center
+            const ArrayXd directionSquaredNorm =
+                direction[0].square() + direction[1].square() + direction[2].square();
+            const ArrayXd projection = -(from[0] * direction[0] + from[1] * direction[1] + from[2] * direction[2]);
+
+            const ArrayXd parameter =
+                (directionSquaredNorm > 0.0).select((projection / directionSquaredNorm).max(0.0).min(1.0), 0.0);
+
+            const ArrayXd closestSquaredNorm = (from[0] + parameter * direction[0]).square() +
+                                               (from[1] + parameter * direction[1]).square() +
+                                               (from[2] + parameter * direction[2]).square();
+
+            // the tolerance keeps points lying on the surface (e.g. ground stations at zero altitude) from occulting
+            // themselves because of round-off
+            isVisible = isVisible && (closestSquaredNorm >= (1.0 - 1.0e-9));
+        }
+
+        return isVisible;
+    }
+
+    /// @brief Visibility between two points.
+    bool isSatisfied(
+        const Instant& anInstant, const Vector3d& aFromPositionCoordinates, const Vector3d& aToPositionCoordinates
+    ) const
+    {
+        const std::array<ArrayXd, 3> fromPositionCoordinates = {
+            ArrayXd::Constant(1, aFromPositionCoordinates(0)),
+            ArrayXd::Constant(1, aFromPositionCoordinates(1)),
+            ArrayXd::Constant(1, aFromPositionCoordinates(2)),
+        };
+
+        return this->isSatisfied(anInstant, fromPositionCoordinates, aToPositionCoordinates)(0);
+    }
+
+   private:
+    struct Occulter
+    {
+        Shared<const Celestial> celestialSPtr;
+        Vector3d inverseRadii;  /// Inverse of the ellipsoid semi-axes [1/m]
+    };
+
+    Shared<const Frame> frameSPtr_;
+    std::vector<Occulter> occulters_;
+};
+
+}  // namespace
+
 const AccessTarget::Type& AccessTarget::accessType() const
 {
     return type_;
@@ -148,6 +480,67 @@ AccessTarget::AccessTarget(
 {
 }
 
+Generator::Statistics& Generator::Statistics::operator+=(const Generator::Statistics& someStatistics)
+{
+    computationCount += someStatistics.computationCount;
+    sampleCount += someStatistics.sampleCount;
+    trajectoryEvaluationCount += someStatistics.trajectoryEvaluationCount;
+    ephemerisLookupCount += someStatistics.ephemerisLookupCount;
+    frameTransformCount += someStatistics.frameTransformCount;
+    crossingCount += someStatistics.crossingCount;
+    rootSolverIterationCount += someStatistics.rootSolverIterationCount;
+    closestApproachEvaluationCount += someStatistics.closestApproachEvaluationCount;
+    accessCount += someStatistics.accessCount;
+    samplingDuration = samplingDuration + someStatistics.samplingDuration;
+    refinementDuration = refinementDuration + someStatistics.refinementDuration;
+    generationDuration = generationDuration + someStatistics.generationDuration;
+    totalDuration = totalDuration + someStatistics.totalDuration;
+
+    return *this;
+}
+
+Generator::StatisticsAccumulator::StatisticsAccumulator(const Generator::StatisticsAccumulator& anAccumulator)
+    : statistics_(anAccumulator.get())
+{
+}
+
+Generator::StatisticsAccumulator& Generator::StatisticsAccumulator::operator=(
+    const Generator::StatisticsAccumulator& anAccumulator
+)
+{
+    if (this != &anAccumulator)
+    {
+        const Statistics statistics = anAccumulator.get();
+
+        const std::lock_guard<std::mutex> lock {mutex_};
+
+        statistics_ = statistics;
+    }
+
+    return *this;
+}
+
+void Generator::StatisticsAccumulator::add(const Generator::Statistics& someStatistics)
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    statistics_ += someStatistics;
+}
+
+Generator::Statistics Generator::StatisticsAccumulator::get() const
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    return statistics_;
+}
+
+void Generator::StatisticsAccumulator::reset()
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    statistics_ = Statistics();
+}
+
 Generator::Generator(
     const Environment& anEnvironment,
     const Duration& aStep,
@@ -159,7 +552,13 @@ Generator::Generator(
       step_(aStep),
       tolerance_(aTolerance),
       accessFilter_(anAccessFilter),
-      stateFilter_(aStateFilter)
+      stateFilter_(aStateFilter),
+      batchStateFilter_({}),
+      threadCount_(1),
+      prescreeningMaximumAltitude_(Length::Undefined()),
+      prescreeningMaximumAngularRate_(Derived::Undefined()),
+      isStatisticsEnabled_(false),
+      statisticsAccumulator_()
 {
     if (anEnvironment.isDefined() && !anEnvironment.hasCentralCelestialObject())
     {
@@ -219,9 +618,66 @@ std::function<bool(const State&, const State&)> Generator::getStateFilter() cons
     return this->stateFilter_;
 }
 
+std::function<Array<bool>(const State&, const Array<State>&)> Generator::getBatchStateFilter() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->batchStateFilter_;
+}
+
+Size Generator::getThreadCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->threadCount_;
+}
+
+Pair<Length, Derived> Generator::getHorizonPrescreening() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return {this->prescreeningMaximumAltitude_, this->prescreeningMaximumAngularRate_};
+}
+
+bool Generator::isStatisticsEnabled() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->isStatisticsEnabled_;
+}
+
+Generator::Statistics Generator::getStatistics() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->statisticsAccumulator_.get();
+}
+
 std::function<bool(const Instant&)> Generator::getConditionFunction(
     const AccessTarget& anAccessTarget, const Trajectory& aToTrajectory
 ) const
+{
+    return this->buildConditionFunction(anAccessTarget, aToTrajectory, nullptr);
+}
+
+std::function<bool(const Instant&)> Generator::buildConditionFunction(
+    const AccessTarget& anAccessTarget, const Trajectory& aToTrajectory, Statistics* aStatisticsPtr
+) const
 {
     if (!aToTrajectory.isDefined())
     {
@@ -238,25 +694,38 @@ std::function<bool(const Instant&)> Generator::getConditionFunction(
                                                     ? this->environment_.accessCentralCelestialObject()
                                                     : this->environment_.accessCelestialObjectWithName("Earth");
     const std::function<bool(const State&, const State&)> stateFilter = this->stateFilter_;
-
-    return [&anAccessTarget, &aToTrajectory, celestialSPtr, stateFilter](const Instant& anInstant) -> bool
+    const std::function<Array<bool>(const State&, const Array<State>&)> batchStateFilter = this->batchStateFilter_;
+
+    // Line of sight between two trajectories (e.g. inter-satellite links) is evaluated in closed form when possible,
+    // rather than by copying and updating the criterion environment at every evaluation.
+    const std::optional<EllipsoidLineOfSight> ellipsoidLineOfSight =
+        anAccessTarget.accessVisibilityCriterion().is<VisibilityCriterion::LineOfSight>()
+            ? EllipsoidLineOfSight::FromLineOfSight(
+                  anAccessTarget.accessVisibilityCriterion().as<VisibilityCriterion::LineOfSight>().value()
+              )
+            : std::nullopt;
+
+    const auto isVisible = [&anAccessTarget, celestialSPtr, ellipsoidLineOfSight, aStatisticsPtr](
+                               const Instant& anInstant, const State& fromState, const State& toState
+                           ) -> bool
     {
-        const State fromState = anAccessTarget.accessTrajectory().getStateAt(anInstant);
-        const State toState = aToTrajectory.getStateAt(anInstant);
-
-        if (stateFilter && (!stateFilter(fromState, toState)))
-        {
-            return false;
-        }
-
         const Position fromPosition = fromState.getPosition();
         const Position toPosition = toState.getPosition();
 
-        const Position fromPosition_ITRF = fromPosition.inFrame(celestialSPtr->accessFrame(), anInstant);
-        const Position toPosition_ITRF = toPosition.inFrame(celestialSPtr->accessFrame(), anInstant);
+        const Position fromPosition_ITRF =
+            GetPositionInFrame(fromPosition, celestialSPtr->accessFrame(), anInstant, aStatisticsPtr);
+        const Position toPosition_ITRF =
+            GetPositionInFrame(toPosition, celestialSPtr->accessFrame(), anInstant, aStatisticsPtr);
 
         const VisibilityCriterion& visibilityCriterion = anAccessTarget.accessVisibilityCriterion();
 
+        if (ellipsoidLineOfSight.has_value())
+        {
+            return ellipsoidLineOfSight->isSatisfied(
+                anInstant, fromPosition_ITRF.accessCoordinates(), toPosition_ITRF.accessCoordinates()
+            );
+        }
+
         if (visibilityCriterion.is<VisibilityCriterion::LineOfSight>())
         {
             return visibilityCriterion.as<VisibilityCriterion::LineOfSight>().value().isSatisfied(
@@ -264,7 +733,7 @@ std::function<bool(const Instant&)> Generator::getConditionFunction(
             );
         }
 
-        const AER aer = Generator::CalculateAer(anInstant, fromPosition, toPosition, celestialSPtr);
+        const AER aer = Generator::CalculateAer(anInstant, fromPosition, toPosition, celestialSPtr, aStatisticsPtr);
 
         if (visibilityCriterion.is<VisibilityCriterion::AERMask>())
         {
@@ -285,6 +754,34 @@ std::function<bool(const Instant&)> Generator::getConditionFunction(
 
         return false;
     };
+
+    // As for fixed targets, the state filters only apply once the visibility criterion is satisfied. The "to" state
+    // differs from one instant to the next, so the batch state filter receives the single "from" state of each
+    // accepted instant.
+    return [&anAccessTarget, &aToTrajectory, isVisible, stateFilter, batchStateFilter, aStatisticsPtr](
+               const Instant& anInstant
+           ) -> bool
+    {
+        const State fromState = GetStateAt(anAccessTarget.accessTrajectory(), anInstant, aStatisticsPtr);
+        const State toState = GetStateAt(aToTrajectory, anInstant, aStatisticsPtr);
+
+        if (!isVisible(anInstant, fromState, toState))
+        {
+            return false;
+        }
+
+        if (stateFilter && (!stateFilter(fromState, toState)))
+        {
+            return false;
+        }
+
+        if (batchStateFilter && (!ApplyBatchStateFilter(batchStateFilter, toState, {fromState})[0]))
+        {
+            return false;
+        }
+
+        return true;
+    };
 }
 
 Array<Access> Generator::computeAccesses(
@@ -311,12 +808,32 @@ Array<Access> Generator::computeAccesses(
             throw ostk::core::error::RuntimeError("Coarse mode is not supported for trajectory targets.");
         }
 
-        return this->computeAccessesForTrajectoryTarget(anInterval, anAccessTarget, aToTrajectory);
+        const auto startTime = std::chrono::steady_clock::now();
+
+        Statistics statistics;
+
+        const Array<Access> accesses = this->computeAccessesForTrajectoryTarget(
+            anInterval, anAccessTarget, aToTrajectory, this->isStatisticsEnabled_ ? &statistics : nullptr
+        );
+
+        if (this->isStatisticsEnabled_)
+        {
+            statistics.computationCount = 1;
+            statistics.totalDuration = ElapsedSince(startTime);
+
+            this->statisticsAccumulator_.add(statistics);
+        }
+
+        return accesses;
     }
 
     return this->computeAccessesForFixedTargets(
-        anInterval, Array<AccessTarget> {anAccessTarget}, aToTrajectory, coarse
-    )[0];
+        anInterval,
+        Array<AccessTarget> {anAccessTarget},
+        Array<const Trajectory*> {&aToTrajectory},
+        Array<const Ephemeris*>::Empty(),
+        coarse
+    )[0][0];
 }
 
 Array<Array<Access>> Generator::computeAccesses(
@@ -355,12 +872,48 @@ Array<Array<Access>> Generator::computeAccesses(
             throw ostk::core::error::RuntimeError("Coarse mode is not supported for trajectory targets.");
         }
 
-        Array<Array<Access>> accessesPerTarget;
-        accessesPerTarget.reserve(someAccessTargets.getSize());
+        const Size targetCount = someAccessTargets.getSize();
+        const Size workerCount = std::min(this->threadCount_, targetCount);
+
+        const Array<Trajectory> toTrajectories = CopyTrajectoryPerWorker(aToTrajectory, workerCount);
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        Array<Array<Access>> accessesPerTarget = Array<Array<Access>>(targetCount, Array<Access>::Empty());
+        Array<Statistics> statisticsPerTarget =
+            Array<Statistics>(this->isStatisticsEnabled_ ? targetCount : 0, Statistics());
+
+        // Each target is processed by exactly one worker, so only the shared "to" trajectory needs per-worker copies.
+        ParallelFor(
+            targetCount,
+            workerCount,
+            [&](const Index& aTargetIndex, const Index& aWorkerIndex) -> void
+            {
+                const Trajectory& toTrajectory =
+                    toTrajectories.isEmpty() ? aToTrajectory : toTrajectories[aWorkerIndex];
+
+                accessesPerTarget[aTargetIndex] = this->computeAccessesForTrajectoryTarget(
+                    anInterval,
+                    someAccessTargets[aTargetIndex],
+                    toTrajectory,
+                    statisticsPerTarget.isEmpty() ? nullptr : &statisticsPerTarget[aTargetIndex]
+                );
+            }
+        );
 
-        for (const auto& accessTarget : someAccessTargets)
+        if (this->isStatisticsEnabled_)
         {
-            accessesPerTarget.add(this->computeAccessesForTrajectoryTarget(anInterval, accessTarget, aToTrajectory));
+            Statistics statistics;
+
+            for (const Statistics& targetStatistics : statisticsPerTarget)
+            {
+                statistics += targetStatistics;
+            }
+
+            statistics.computationCount = 1;
+            statistics.totalDuration = ElapsedSince(startTime);
+
+            this->statisticsAccumulator_.add(statistics);
         }
 
         return accessesPerTarget;
@@ -375,7 +928,13 @@ Array<Array<Access>> Generator::computeAccesses(
             }
         ))
     {
-        return this->computeAccessesForFixedTargets(anInterval, someAccessTargets, aToTrajectory, coarse);
+        return this->computeAccessesForFixedTargets(
+            anInterval,
+            someAccessTargets,
+            Array<const Trajectory*> {&aToTrajectory},
+            Array<const Ephemeris*>::Empty(),
+            coarse
+        )[0];
     }
 
     throw ostk::core::error::RuntimeError("All targets must be of same type.");
@@ -383,9 +942,269 @@ Array<Array<Access>> Generator::computeAccesses(
     return {};
 }
 
-void Generator::setStep(const Duration& aStep)
+Array<Array<Array<Access>>> Generator::computeAccesses(
+    const physics::time::Interval& anInterval,
+    const Array<AccessTarget>& someAccessTargets,
+    const Array<Trajectory>& someToTrajectories,
+    const bool& coarse
+) const
 {
-    if (!aStep.isDefined())
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (someAccessTargets.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Access targets");
+    }
+
+    if (someToTrajectories.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("To Trajectories");
+    }
+
+    for (const Trajectory& toTrajectory : someToTrajectories)
+    {
+        if (!toTrajectory.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("To Trajectory");
+        }
+    }
+
+    if (std::all_of(
+            someAccessTargets.begin(),
+            someAccessTargets.end(),
+            [](const auto& accessTarget)
+            {
+                return accessTarget.accessType() == AccessTarget::Type::Fixed;
+            }
+        ))
+    {
+        const Array<const Trajectory*> toTrajectoryPtrs = someToTrajectories.map<const Trajectory*>(
+            [](const Trajectory& aTrajectory) -> const Trajectory*
+            {
+                return &aTrajectory;
+            }
+        );
+
+        return this->computeAccessesForFixedTargets(
+            anInterval, someAccessTargets, toTrajectoryPtrs, Array<const Ephemeris*>::Empty(), coarse
+        );
+    }
+
+    // Trajectory targets do not share any per-instant computation, fall back to one batch per trajectory.
+    return someToTrajectories.map<Array<Array<Access>>>(
+        [&anInterval, &someAccessTargets, &coarse, this](const Trajectory& aToTrajectory) -> Array<Array<Access>>
+        {
+            return this->computeAccesses(anInterval, someAccessTargets, aToTrajectory, coarse);
+        }
+    );
+}
+
+Array<Array<Access>> Generator::computeAccesses(
+    const physics::time::Interval& anInterval,
+    const Array<AccessTarget>& someAccessTargets,
+    const Ephemeris& aToEphemeris,
+    const bool& coarse
+) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (someAccessTargets.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Access targets");
+    }
+
+    if (!aToEphemeris.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("To Ephemeris");
+    }
+
+    if (std::all_of(
+            someAccessTargets.begin(),
+            someAccessTargets.end(),
+            [](const auto& accessTarget)
+            {
+                return accessTarget.accessType() == AccessTarget::Type::Fixed;
+            }
+        ))
+    {
+        return this->computeAccessesForFixedTargets(
+            anInterval,
+            someAccessTargets,
+            Array<const Trajectory*> {&aToEphemeris.accessTrajectory()},
+            Array<const Ephemeris*> {&aToEphemeris},
+            coarse
+        )[0];
+    }
+
+    // Trajectory targets are not sampled on a grid, the tabulated positions are of no use.
+    return this->computeAccesses(anInterval, someAccessTargets, aToEphemeris.accessTrajectory(), coarse);
+}
+
+Array<Array<Array<Access>>> Generator::computeAccesses(
+    const physics::time::Interval& anInterval,
+    const Array<AccessTarget>& someAccessTargets,
+    const Array<Ephemeris>& someToEphemerides,
+    const bool& coarse
+) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (someAccessTargets.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Access targets");
+    }
+
+    if (someToEphemerides.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("To Ephemerides");
+    }
+
+    for (const Ephemeris& toEphemeris : someToEphemerides)
+    {
+        if (!toEphemeris.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("To Ephemeris");
+        }
+    }
+
+    if (std::all_of(
+            someAccessTargets.begin(),
+            someAccessTargets.end(),
+            [](const auto& accessTarget)
+            {
+                return accessTarget.accessType() == AccessTarget::Type::Fixed;
+            }
+        ))
+    {
+        const Array<const Trajectory*> toTrajectoryPtrs = someToEphemerides.map<const Trajectory*>(
+            [](const Ephemeris& anEphemeris) -> const Trajectory*
+            {
+                return &anEphemeris.accessTrajectory();
+            }
+        );
+
+        const Array<const Ephemeris*> toEphemerisPtrs = someToEphemerides.map<const Ephemeris*>(
+            [](const Ephemeris& anEphemeris) -> const Ephemeris*
+            {
+                return &anEphemeris;
+            }
+        );
+
+        return this->computeAccessesForFixedTargets(
+            anInterval, someAccessTargets, toTrajectoryPtrs, toEphemerisPtrs, coarse
+        );
+    }
+
+    return someToEphemerides.map<Array<Array<Access>>>(
+        [&anInterval, &someAccessTargets, &coarse, this](const Ephemeris& aToEphemeris) -> Array<Array<Access>>
+        {
+            return this->computeAccesses(anInterval, someAccessTargets, aToEphemeris.accessTrajectory(), coarse);
+        }
+    );
+}
+
+Ephemeris Generator::generateEphemeris(const physics::time::Interval& anInterval, const Trajectory& aTrajectory) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!aTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Trajectory");
+    }
+
+    const Shared<const Celestial> celestialSPtr = this->environment_.hasCentralCelestialObject()
+                                                    ? this->environment_.accessCentralCelestialObject()
+                                                    : this->environment_.accessCelestialObjectWithName("Earth");
+
+    return {aTrajectory, anInterval.generateGrid(this->step_), celestialSPtr->accessFrame()};
+}
+
+void Generator::streamAccesses(
+    const physics::time::Interval& anInterval,
+    const Array<AccessTarget>& someAccessTargets,
+    const Trajectory& aToTrajectory,
+    const std::function<void(const Index&, const Access&)>& anAccessCallback,
+    const Duration& aWindowDuration,
+    const bool& coarse
+) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (someAccessTargets.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Access targets");
+    }
+
+    if (!aToTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("To Trajectory");
+    }
+
+    if (!anAccessCallback)
+    {
+        throw ostk::core::error::runtime::Undefined("Access callback");
+    }
+
+    if (!aWindowDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Window duration");
+    }
+
+    if (aWindowDuration < this->step_)
+    {
+        throw ostk::core::error::RuntimeError("Window duration must be greater than or equal to the step.");
+    }
+
+    if (!std::all_of(
+            someAccessTargets.begin(),
+            someAccessTargets.end(),
+            [](const auto& accessTarget)
+            {
+                return accessTarget.accessType() == AccessTarget::Type::Fixed;
+            }
+        ))
+    {
+        throw ostk::core::error::RuntimeError("Streaming is only supported for fixed targets.");
+    }
+
+    this->computeAccessesForFixedTargets(
+        anInterval,
+        someAccessTargets,
+        Array<const Trajectory*> {&aToTrajectory},
+        Array<const Ephemeris*>::Empty(),
+        coarse,
+        aWindowDuration,
+        [&anAccessCallback](const Index& aTrajectoryIndex, const Index& aTargetIndex, const Array<Access>& someAccesses)
+            -> void
+        {
+            (void)aTrajectoryIndex;
+
+            for (const Access& access : someAccesses)
+            {
+                anAccessCallback(aTargetIndex, access);
+            }
+        }
+    );
+}
+
+void Generator::setStep(const Duration& aStep)
+{
+    if (!aStep.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Step");
     }
@@ -413,362 +1232,1106 @@ void Generator::setStateFilter(const std::function<bool(const State&, const Stat
     this->stateFilter_ = aStateFilter;
 }
 
+void Generator::setBatchStateFilter(
+    const std::function<Array<bool>(const State&, const Array<State>&)>& aBatchStateFilter
+)
+{
+    this->batchStateFilter_ = aBatchStateFilter;
+}
+
+void Generator::setThreadCount(const Size& aThreadCount)
+{
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::RuntimeError("Thread count must be greater than zero.");
+    }
+
+    this->threadCount_ = aThreadCount;
+}
+
+void Generator::setHorizonPrescreening(const Length& aMaximumAltitude, const Derived& aMaximumAngularRate)
+{
+    if (!aMaximumAltitude.isDefined() || !aMaximumAngularRate.isDefined())
+    {
+        this->prescreeningMaximumAltitude_ = Length::Undefined();
+        this->prescreeningMaximumAngularRate_ = Derived::Undefined();
+
+        return;
+    }
+
+    if (aMaximumAngularRate.in(Derived::Unit::RadianPerSecond()) <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Maximum angular rate must be greater than zero.");
+    }
+
+    this->prescreeningMaximumAltitude_ = aMaximumAltitude;
+    this->prescreeningMaximumAngularRate_ = aMaximumAngularRate;
+}
+
+void Generator::setStatisticsEnabled(const bool& isEnabled)
+{
+    this->isStatisticsEnabled_ = isEnabled;
+}
+
+void Generator::resetStatistics()
+{
+    this->statisticsAccumulator_.reset();
+}
+
 Generator Generator::Undefined()
 {
     return {Environment::Undefined(), Duration::Undefined(), Duration::Undefined()};
 }
 
-Array<Access> Generator::computeAccessesForTrajectoryTarget(
-    const physics::time::Interval& anInterval, const AccessTarget& anAccessTarget, const Trajectory& aToTrajectory
-) const
-{
-    const TemporalConditionSolver temporalConditionSolver = {this->step_, this->tolerance_};
+Array<Access> Generator::computeAccessesForTrajectoryTarget(
+    const physics::time::Interval& anInterval,
+    const AccessTarget& anAccessTarget,
+    const Trajectory& aToTrajectory,
+    Statistics* aStatisticsPtr
+) const
+{
+    const TemporalConditionSolver temporalConditionSolver = {this->step_, this->tolerance_};
+
+    const std::function<bool(const Instant&)> conditionFunction =
+        this->buildConditionFunction(anAccessTarget, aToTrajectory, aStatisticsPtr);
+
+    // The crossings are refined by the temporal condition solver while sampling
+    const auto recordCrossing = [aStatisticsPtr](const Size& anIterationCount) -> void
+    {
+        if (aStatisticsPtr != nullptr)
+        {
+            aStatisticsPtr->crossingCount += 1;
+            aStatisticsPtr->rootSolverIterationCount += anIterationCount;
+        }
+    };
+
+    const auto samplingStartTime = std::chrono::steady_clock::now();
+
+    const Array<physics::time::Interval> accessIntervals = temporalConditionSolver.solve(
+        Array<TemporalConditionSolver::Condition> {conditionFunction}, anInterval, recordCrossing
+    );
+
+    if (aStatisticsPtr != nullptr)
+    {
+        aStatisticsPtr->sampleCount += anInterval.generateGrid(this->step_).getSize();
+        aStatisticsPtr->samplingDuration = aStatisticsPtr->samplingDuration + ElapsedSince(samplingStartTime);
+    }
+
+    const Trajectory& fromTrajectory = anAccessTarget.accessTrajectory();
+
+    return generateAccessesFromIntervals(accessIntervals, anInterval, fromTrajectory, aToTrajectory, aStatisticsPtr);
+}
+
+Array<Array<Array<Access>>> Generator::computeAccessesForFixedTargets(
+    const physics::time::Interval& anInterval,
+    const Array<AccessTarget>& someAccessTargets,
+    const Array<const Trajectory*>& someToTrajectories,
+    const Array<const Ephemeris*>& someToEphemerides,
+    const bool& coarse
+) const
+{
+    Array<Array<Array<Access>>> accesses = Array<Array<Array<Access>>>(
+        someToTrajectories.getSize(), Array<Array<Access>>(someAccessTargets.getSize(), Array<Access>::Empty())
+    );
+
+    this->computeAccessesForFixedTargets(
+        anInterval,
+        someAccessTargets,
+        someToTrajectories,
+        someToEphemerides,
+        coarse,
+        Duration::Undefined(),
+        [&accesses](const Index& aTrajectoryIndex, const Index& aTargetIndex, const Array<Access>& someAccesses) -> void
+        {
+            accesses[aTrajectoryIndex][aTargetIndex] = someAccesses;
+        }
+    );
+
+    return accesses;
+}
+
+void Generator::computeAccessesForFixedTargets(
+    const physics::time::Interval& anInterval,
+    const Array<AccessTarget>& someAccessTargets,
+    const Array<const Trajectory*>& someToTrajectories,
+    const Array<const Ephemeris*>& someToEphemerides,
+    const bool& coarse,
+    const Duration& aWindowDuration,
+    const std::function<void(const Index&, const Index&, const Array<Access>&)>& anAccessesCallback
+) const
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    const Shared<const Celestial> celestialSPtr = this->environment_.hasCentralCelestialObject()
+                                                    ? this->environment_.accessCentralCelestialObject()
+                                                    : this->environment_.accessCelestialObjectWithName("Earth");
+
+    // gather ITRF positions and SEZ rotations of all access targets into structure-of-arrays buffers
+
+    const Index targetCount = someAccessTargets.getSize();
+
+    const Shared<const Celestial> earthSPtr = this->environment_.accessCelestialObjectWithName("Earth");
+
+    MatrixXd fromPositionCoordinates_ITRF = MatrixXd::Zero(3, targetCount);
+    Array<Matrix3d> SEZRotations = Array<Matrix3d>::Empty();
+    SEZRotations.reserve(targetCount);
+
+    for (Index i = 0; i < targetCount; ++i)
+    {
+        fromPositionCoordinates_ITRF.col(i) = someAccessTargets[i].getPosition(celestialSPtr).getCoordinates();
+        SEZRotations.add(someAccessTargets[i].computeR_SEZ_ECEF(earthSPtr));
+    }
+
+    const FixedTargetBuffers targetBuffers = BuildFixedTargetBuffers(fromPositionCoordinates_ITRF, SEZRotations);
+
+    const bool allAccessTargetsHaveMasks = std::all_of(
+        someAccessTargets.begin(),
+        someAccessTargets.end(),
+        [](const auto& accessTarget)
+        {
+            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::AERMask>();
+        }
+    );
+    const bool allAccessTargetsHaveAERIntervals = std::all_of(
+        someAccessTargets.begin(),
+        someAccessTargets.end(),
+        [](const auto& accessTarget)
+        {
+            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::AERInterval>();
+        }
+    );
+    const bool allAccessTargetsHaveLineOfSight = std::all_of(
+        someAccessTargets.begin(),
+        someAccessTargets.end(),
+        [](const auto& accessTarget)
+        {
+            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::LineOfSight>();
+        }
+    );
+    const bool allAccessTargetsHaveElevationIntervals = std::all_of(
+        someAccessTargets.begin(),
+        someAccessTargets.end(),
+        [](const auto& accessTarget)
+        {
+            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::ElevationInterval>();
+        }
+    );
+
+    std::function<ArrayXb(const MatrixXd&, const Vector3d&, const Instant&)> visibilityCriterionFilter;
+
+    // Elevation bounds are compared through their sine (monotonic over [-pi/2, pi/2]), which avoids evaluating asin
+    // for every target at every instant.
+
+    if (allAccessTargetsHaveAERIntervals)
+    {
+        // create stacked arrays of azimuth, sine of elevation, and range bounds for all access targets
+        ArrayXd azimuthLowerBounds_rad(targetCount);
+        ArrayXd azimuthUpperBounds_rad(targetCount);
+        ArrayXd elevationLowerBounds_sin(targetCount);
+        ArrayXd elevationUpperBounds_sin(targetCount);
+        ArrayXd rangeLowerBounds_m(targetCount);
+        ArrayXd rangeUpperBounds_m(targetCount);
+
+        for (Index i = 0; i < targetCount; ++i)
+        {
+            const VisibilityCriterion::AERInterval visibilityCriterion =
+                someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::AERInterval>().value();
+
+            azimuthLowerBounds_rad(i) = visibilityCriterion.azimuth.accessLowerBound();
+            azimuthUpperBounds_rad(i) = visibilityCriterion.azimuth.accessUpperBound();
+            elevationLowerBounds_sin(i) = std::sin(visibilityCriterion.elevation.accessLowerBound());
+            elevationUpperBounds_sin(i) = std::sin(visibilityCriterion.elevation.accessUpperBound());
+            rangeLowerBounds_m(i) = visibilityCriterion.range.accessLowerBound();
+            rangeUpperBounds_m(i) = visibilityCriterion.range.accessUpperBound();
+        }
+
+        visibilityCriterionFilter = [azimuthLowerBounds_rad,
+                                     azimuthUpperBounds_rad,
+                                     elevationLowerBounds_sin,
+                                     elevationUpperBounds_sin,
+                                     rangeLowerBounds_m,
+                                     rangeUpperBounds_m,
+                                     &targetBuffers](
+                                        const MatrixXd& aFromPositionCoordinates_ITRF,
+                                        const Vector3d& aToPositionCoordinates_ITRF,
+                                        const Instant& anInstant
+                                    )
+        {
+            (void)anInstant;
+            (void)aFromPositionCoordinates_ITRF;
+
+            const SEZVectors dx_SEZ = ComputeSEZVectors(targetBuffers, aToPositionCoordinates_ITRF);
+
+            const ArrayXd ranges_m =
+                (dx_SEZ.south.square() + dx_SEZ.east.square() + dx_SEZ.zenith.square()).sqrt();
+            const ArrayXd elevations_sin = dx_SEZ.zenith / ranges_m;
+            const ArrayXd azimuths_rad = ComputeAzimuths(dx_SEZ);
+
+            return (azimuths_rad > azimuthLowerBounds_rad && azimuths_rad < azimuthUpperBounds_rad &&
+                    elevations_sin > elevationLowerBounds_sin && elevations_sin < elevationUpperBounds_sin &&
+                    ranges_m > rangeLowerBounds_m && ranges_m < rangeUpperBounds_m)
+                .eval();
+        };
+    }
+    else if (allAccessTargetsHaveMasks)
+    {
+        const FlattenedAzimuthElevationMasks masks = someAccessTargets.map<VisibilityCriterion::AERMask>(
+            [](const AccessTarget& anAccessTarget) -> VisibilityCriterion::AERMask
+            {
+                return anAccessTarget.accessVisibilityCriterion().as<VisibilityCriterion::AERMask>().value();
+            }
+        );
+
+        visibilityCriterionFilter = [masks, &targetBuffers](
+                                        const MatrixXd& aFromPositionCoordinates_ITRF,
+                                        const Vector3d& aToPositionCoordinates_ITRF,
+                                        const Instant& anInstant
+                                    )
+        {
+            (void)anInstant;
+            (void)aFromPositionCoordinates_ITRF;
+
+            const SEZVectors dx_SEZ = ComputeSEZVectors(targetBuffers, aToPositionCoordinates_ITRF);
+
+            const ArrayXd horizontalRanges_m = (dx_SEZ.south.square() + dx_SEZ.east.square()).sqrt();
+            const ArrayXd ranges_m = (horizontalRanges_m.square() + dx_SEZ.zenith.square()).sqrt();
+            const ArrayXd elevations_rad = FastAtan2(dx_SEZ.zenith, horizontalRanges_m);
+            const ArrayXd azimuths_rad = ComputeAzimuths(dx_SEZ);
+
+            // the piecewise-linear mask lookup is the only per-target scalar step left
+            ArrayXb mask(azimuths_rad.rows());
+            for (Eigen::Index i = 0; i < mask.rows(); ++i)
+            {
+                mask(i) = masks.isSatisfied(i, azimuths_rad(i), elevations_rad(i), ranges_m(i));
+            }
+
+            return mask;
+        };
+    }
+    else if (allAccessTargetsHaveLineOfSight)
+    {
+        const VisibilityCriterion::LineOfSight firstVisibilityCriterion =
+            someAccessTargets[0].accessVisibilityCriterion().as<VisibilityCriterion::LineOfSight>().value();
+
+        const bool allAccessTargetsShareLineOfSight = std::all_of(
+            someAccessTargets.begin(),
+            someAccessTargets.end(),
+            [&firstVisibilityCriterion](const auto& accessTarget)
+            {
+                return accessTarget.accessVisibilityCriterion().template as<VisibilityCriterion::LineOfSight>().value(
+                       ) == firstVisibilityCriterion;
+            }
+        );
+
+        const std::optional<EllipsoidLineOfSight> sharedEllipsoidLineOfSight =
+            allAccessTargetsShareLineOfSight ? EllipsoidLineOfSight::FromLineOfSight(firstVisibilityCriterion)
+                                             : std::nullopt;
+
+        if (sharedEllipsoidLineOfSight.has_value())
+        {
+            // evaluate all targets at once
+            visibilityCriterionFilter = [ellipsoidLineOfSight = sharedEllipsoidLineOfSight.value(), &targetBuffers](
+                                            const MatrixXd& aFromPositionCoordinates_ITRF,
+                                            const Vector3d& aToPositionCoordinates_ITRF,
+                                            const Instant& anInstant
+                                        )
+            {
+                (void)aFromPositionCoordinates_ITRF;
+
+                return ellipsoidLineOfSight.isSatisfied(
+                    anInstant, targetBuffers.position_ITRF, aToPositionCoordinates_ITRF
+                );
+            };
+        }
+        else
+        {
+            const Array<std::optional<EllipsoidLineOfSight>> ellipsoidLineOfSights =
+                someAccessTargets.map<std::optional<EllipsoidLineOfSight>>(
+                    [](const AccessTarget& anAccessTarget) -> std::optional<EllipsoidLineOfSight>
+                    {
+                        return EllipsoidLineOfSight::FromLineOfSight(
+                            anAccessTarget.accessVisibilityCriterion().as<VisibilityCriterion::LineOfSight>().value()
+                        );
+                    }
+                );
+
+            visibilityCriterionFilter = [&someAccessTargets, ellipsoidLineOfSights](
+                                            const MatrixXd& aFromPositionCoordinates_ITRF,
+                                            const Vector3d& aToPositionCoordinates_ITRF,
+                                            const Instant& anInstant
+                                        )
+            {
+                ArrayXb mask(aFromPositionCoordinates_ITRF.cols());
+
+                for (Eigen::Index i = 0; i < mask.rows(); ++i)
+                {
+                    const Vector3d& fromPositionCoordinate_ITRF = aFromPositionCoordinates_ITRF.col(i);
+
+                    if (ellipsoidLineOfSights[i].has_value())
+                    {
+                        mask(i) = ellipsoidLineOfSights[i]->isSatisfied(
+                            anInstant, fromPositionCoordinate_ITRF, aToPositionCoordinates_ITRF
+                        );
+
+                        continue;
+                    }
+
+                    const VisibilityCriterion::LineOfSight visibilityCriterion =
+                        someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::LineOfSight>().value();
+
+                    mask(i) = visibilityCriterion.isSatisfied(
+                        anInstant, fromPositionCoordinate_ITRF, aToPositionCoordinates_ITRF
+                    );
+                }
+
+                return mask;
+            };
+        }
+    }
+    else if (allAccessTargetsHaveElevationIntervals)
+    {
+        // create stacked arrays of sine of elevation bounds for all ground targets
+        ArrayXd elevationLowerBounds_sin(targetCount);
+        ArrayXd elevationUpperBounds_sin(targetCount);
+
+        for (Index i = 0; i < targetCount; ++i)
+        {
+            const VisibilityCriterion::ElevationInterval visibilityCriterion =
+                someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::ElevationInterval>().value();
+
+            elevationLowerBounds_sin(i) = std::sin(visibilityCriterion.elevation.accessLowerBound());
+            elevationUpperBounds_sin(i) = std::sin(visibilityCriterion.elevation.accessUpperBound());
+        }
+
+        visibilityCriterionFilter = [elevationLowerBounds_sin, elevationUpperBounds_sin, &targetBuffers](
+                                        const MatrixXd& aFromPositionCoordinates_ITRF,
+                                        const Vector3d& aToPositionCoordinates_ITRF,
+                                        const Instant& anInstant
+                                    )
+        {
+            (void)anInstant;
+            (void)aFromPositionCoordinates_ITRF;
+
+            const ArrayXd dx = aToPositionCoordinates_ITRF(0) - targetBuffers.position_ITRF[0];
+            const ArrayXd dy = aToPositionCoordinates_ITRF(1) - targetBuffers.position_ITRF[1];
+            const ArrayXd dz = aToPositionCoordinates_ITRF(2) - targetBuffers.position_ITRF[2];
+
+            // sine of the geocentric elevation
+            const ArrayXd elevations_sin =
+                (dx * targetBuffers.zenith_ITRF[0] + dy * targetBuffers.zenith_ITRF[1] +
+                 dz * targetBuffers.zenith_ITRF[2]) /
+                (dx.square() + dy.square() + dz.square()).sqrt();
+
+            return (elevations_sin > elevationLowerBounds_sin && elevations_sin < elevationUpperBounds_sin).eval();
+        };
+    }
+    else
+    {
+        throw ostk::core::error::RuntimeError("All access targets must have the same type of Visibility Criteria.");
+    }
+
+    // Horizon pre-screening: with the observer radius bounded by r_max, a target at radius R with a minimum geocentric
+    // elevation e_min can only see the observer while their central angle is below
+    // theta_max = acos(R / r_max * cos(e_min)) - e_min. The minimum elevation is lowered by a margin covering the
+    // geodetic (SEZ) versus geocentric zenith deflection.
+
+    const bool isPrescreeningEnabled = this->prescreeningMaximumAltitude_.isDefined() &&
+                                       this->prescreeningMaximumAngularRate_.isDefined() &&
+                                       !allAccessTargetsHaveLineOfSight;
+
+    double prescreeningMaximumRadius_m = 0.0;
+    double prescreeningMaximumAngularRate_radps = 0.0;
+
+    MatrixXd fromPositionDirections_ITRF = MatrixXd::Zero(3, 0);
+    VectorXd maximumCentralAngles_rad = VectorXd::Zero(0);
+
+    if (isPrescreeningEnabled)
+    {
+        static const double elevationMargin_rad = 1.0 * M_PI / 180.0;
+
+        prescreeningMaximumRadius_m =
+            celestialSPtr->getEquatorialRadius().inMeters() + this->prescreeningMaximumAltitude_.inMeters();
+        prescreeningMaximumAngularRate_radps =
+            this->prescreeningMaximumAngularRate_.in(Derived::Unit::RadianPerSecond());
+
+        fromPositionDirections_ITRF = fromPositionCoordinates_ITRF.colwise().normalized();
+        maximumCentralAngles_rad = VectorXd::Zero(targetCount);
+
+        for (Index i = 0; i < targetCount; ++i)
+        {
+            const VisibilityCriterion& visibilityCriterion = someAccessTargets[i].accessVisibilityCriterion();
+
+            double minimumElevation_rad = -M_PI / 2.0;
+
+            if (visibilityCriterion.is<VisibilityCriterion::ElevationInterval>())
+            {
+                minimumElevation_rad = visibilityCriterion.as<VisibilityCriterion::ElevationInterval>()
+                                           .value()
+                                           .elevation.accessLowerBound();
+            }
+            else if (visibilityCriterion.is<VisibilityCriterion::AERInterval>())
+            {
+                minimumElevation_rad =
+                    visibilityCriterion.as<VisibilityCriterion::AERInterval>().value().elevation.accessLowerBound();
+            }
+            else if (visibilityCriterion.is<VisibilityCriterion::AERMask>())
+            {
+                minimumElevation_rad = M_PI / 2.0;
+
+                for (const auto& azimuthElevationPair :
+                     visibilityCriterion.as<VisibilityCriterion::AERMask>().value().azimuthElevationMask)
+                {
+                    minimumElevation_rad = std::min(minimumElevation_rad, double(azimuthElevationPair.second));
+                }
+            }
+
+            minimumElevation_rad -= elevationMargin_rad;
+
+            const double cosineBound = fromPositionCoordinates_ITRF.col(i).norm() / prescreeningMaximumRadius_m *
+                                       std::cos(minimumElevation_rad);
+
+            maximumCentralAngles_rad(i) = ((minimumElevation_rad <= -M_PI / 2.0) || (cosineBound >= 1.0))
+                                            ? M_PI
+                                            : std::acos(cosineBound) - minimumElevation_rad;
+        }
+    }
+
+    // Return the earliest instant at which any target may see an observer at the given (body-fixed) position, or an
+    // undefined instant if a target may already see it. Central angles change no faster than the observer angular rate.
+    const auto computeEarliestVisibilityInstant = [&](const Vector3d& aToPositionCoordinates_ITRF,
+                                                      const Instant& anInstant) -> Instant
+    {
+        const double toRadius_m = aToPositionCoordinates_ITRF.norm();
+
+        if (toRadius_m > prescreeningMaximumRadius_m)
+        {
+            return Instant::Undefined();
+        }
+
+        const VectorXd centralAngles_rad =
+            (fromPositionDirections_ITRF.transpose() * (aToPositionCoordinates_ITRF / toRadius_m))
+                .array()
+                .min(1.0)
+                .max(-1.0)
+                .acos()
+                .matrix();
+
+        const double minimumMargin_rad = (centralAngles_rad - maximumCentralAngles_rad).minCoeff();
 
-    const Array<physics::time::Interval> accessIntervals =
-        temporalConditionSolver.solve(this->getConditionFunction(anAccessTarget, aToTrajectory), anInterval);
+        if (minimumMargin_rad <= 0.0)
+        {
+            return Instant::Undefined();
+        }
 
-    const Trajectory& fromTrajectory = anAccessTarget.accessTrajectory();
+        return anInstant + Duration::Seconds(minimumMargin_rad / prescreeningMaximumAngularRate_radps);
+    };
 
-    return generateAccessesFromIntervals(accessIntervals, anInterval, fromTrajectory, aToTrajectory);
-}
+    const Size trajectoryCount = someToTrajectories.getSize();
 
-Array<Array<Access>> Generator::computeAccessesForFixedTargets(
-    const physics::time::Interval& anInterval,
-    const Array<AccessTarget>& someAccessTargets,
-    const Trajectory& aToTrajectory,
-    const bool& coarse
-) const
-{
-    const Shared<const Celestial> celestialSPtr = this->environment_.hasCentralCelestialObject()
-                                                    ? this->environment_.accessCentralCelestialObject()
-                                                    : this->environment_.accessCelestialObjectWithName("Earth");
+    // Without a window duration, the whole grid is generated and scanned at once. Otherwise, the grid is generated one
+    // window (a whole number of steps) at a time, so that memory does not grow with the analysis interval duration.
+    const bool isWindowed = aWindowDuration.isDefined();
 
-    // create a stacked matrix of SEZ rotations for all access targets
+    const Size windowStepCount =
+        isWindowed ? std::max<Size>(1, static_cast<Size>(aWindowDuration.inSeconds() / this->step_.inSeconds())) : 0;
 
-    const Index targetCount = someAccessTargets.getSize();
-    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> SEZRotations(3, 3 * targetCount);
+    Array<Instant> instants = isWindowed ? Array<Instant>::Empty() : anInterval.generateGrid(this->step_);
 
-    const Shared<const Celestial> earthSPtr = this->environment_.accessCelestialObjectWithName("Earth");
+    const Size maximumInstantCount = isWindowed ? (windowStepCount + 1) : instants.getSize();
 
-    for (Index i = 0; i < targetCount; ++i)
+    // Bind the state filters once, rather than copying the std::function (and re-running isDefined()) on every step.
+    const std::function<bool(const State&, const State&)>& stateFilter = this->stateFilter_;
+    const std::function<Array<bool>(const State&, const Array<State>&)>& batchStateFilter = this->batchStateFilter_;
+
+    const Shared<const Frame>& accessFrameSPtr = celestialSPtr->accessFrame();
+    const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    for (const Ephemeris* toEphemerisPtr : someToEphemerides)
     {
-        SEZRotations.block<3, 3>(0, 3 * i) = someAccessTargets[i].computeR_SEZ_ECEF(earthSPtr);
+        if ((*toEphemerisPtr->accessFrame()) != (*accessFrameSPtr))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Ephemeris frame [{}] differs from the central celestial object frame [{}].",
+                toEphemerisPtr->accessFrame()->getName(),
+                accessFrameSPtr->getName()
+            );
+        }
     }
 
-    // create a stacked matrix of ITRF positions for all access targets
+    const Size workerCount =
+        std::min(this->threadCount_, std::max(maximumInstantCount, trajectoryCount * targetCount));
 
-    MatrixXd fromPositionCoordinates_ITRF = MatrixXd::Zero(3, targetCount);
+    // Statistics are kept per worker, and merged once all windows are processed.
+    Array<Statistics> statisticsPerWorker =
+        Array<Statistics>(this->isStatisticsEnabled_ ? workerCount : 0, Statistics());
 
-    for (Index i = 0; i < targetCount; ++i)
+    const auto accessStatistics = [&statisticsPerWorker](const Index& aWorkerIndex) -> Statistics*
     {
-        fromPositionCoordinates_ITRF.col(i) = someAccessTargets[i].getPosition(celestialSPtr).getCoordinates();
-    }
+        return statisticsPerWorker.isEmpty() ? nullptr : &statisticsPerWorker[aWorkerIndex];
+    };
 
-    const bool allAccessTargetsHaveMasks = std::all_of(
-        someAccessTargets.begin(),
-        someAccessTargets.end(),
-        [](const auto& accessTarget)
-        {
-            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::AERMask>();
-        }
-    );
-    const bool allAccessTargetsHaveAERIntervals = std::all_of(
-        someAccessTargets.begin(),
-        someAccessTargets.end(),
-        [](const auto& accessTarget)
-        {
-            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::AERInterval>();
-        }
-    );
-    const bool allAccessTargetsHaveLineOfSight = std::all_of(
-        someAccessTargets.begin(),
-        someAccessTargets.end(),
-        [](const auto& accessTarget)
+    // When several trajectories share the grid, compute the GCRF to body-fixed transform once per instant, rather than
+    // once per trajectory and instant.
+    Array<Transform> transforms_ITRF_GCRF = Array<Transform>::Empty();
+
+    const auto computePositionCoordinates_ITRF = [&transforms_ITRF_GCRF, &accessFrameSPtr, &gcrfSPtr](
+                                                     const State& aState,
+                                                     const Index& anInstantIndex,
+                                                     Statistics* aStatisticsPtr
+                                                 ) -> Vector3d
+    {
+        if ((!transforms_ITRF_GCRF.isEmpty()) && ((*aState.accessFrame()) == (*gcrfSPtr)))
         {
-            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::LineOfSight>();
+            return transforms_ITRF_GCRF[anInstantIndex].applyToPosition(aState.getPosition().accessCoordinates());
         }
-    );
-    const bool allAccessTargetsHaveElevationIntervals = std::all_of(
-        someAccessTargets.begin(),
-        someAccessTargets.end(),
-        [](const auto& accessTarget)
+
+        if (aStatisticsPtr != nullptr)
         {
-            return accessTarget.accessVisibilityCriterion().template is<VisibilityCriterion::ElevationInterval>();
+            aStatisticsPtr->frameTransformCount += 1;
         }
-    );
 
-    const auto computeAer = [&SEZRotations, &fromPositionCoordinates_ITRF](const Vector3d& aToPositionCoordinates_ITRF
-                            ) -> Triple<VectorXd, VectorXd, VectorXd>
+        // transform only the position, not the whole state
+        return aState.getPosition().inFrame(accessFrameSPtr, aState.accessInstant()).getCoordinates();
+    };
+
+    // Trajectory models may cache state while being evaluated, so a given trajectory must never be evaluated by two
+    // workers at once. With at least as many trajectories as workers, each work item owns a trajectory (and all of its
+    // targets). Otherwise, trajectories are copied per worker, and the grid (then the targets) of each trajectory is
+    // split into several work items, so that a single trajectory can still use every worker.
+    const bool isSplitPerTrajectory = trajectoryCount < workerCount;
+
+    const Array<Array<Trajectory>> toTrajectoriesPerWorker =
+        isSplitPerTrajectory ? Array<Array<Trajectory>>(
+                                   workerCount,
+                                   someToTrajectories.map<Trajectory>(
+                                       [](const Trajectory* aTrajectoryPtr) -> Trajectory
+                                       {
+                                           return *aTrajectoryPtr;
+                                       }
+                                   )
+                               )
+                             : Array<Array<Trajectory>>::Empty();
+
+    const auto accessToTrajectory = [&toTrajectoriesPerWorker, &someToTrajectories](
+                                        const Index& aTrajectoryIndex, const Index& aWorkerIndex
+                                    ) -> const Trajectory&
+    {
+        return toTrajectoriesPerWorker.isEmpty() ? *someToTrajectories[aTrajectoryIndex]
+                                                 : toTrajectoriesPerWorker[aWorkerIndex][aTrajectoryIndex];
+    };
+
+    // Fill rows [aStartIndex, anEndIndex) of the in-access matrix of a trajectory.
+    const auto scan = [&](const Trajectory& aToTrajectory,
+                          const Index& aTrajectoryIndex,
+                          const Index& aStartIndex,
+                          const Index& anEndIndex,
+                          MatrixXi& anInAccessPerTarget,
+                          Statistics* aStatisticsPtr) -> void
     {
-        const MatrixXd dx = (-fromPositionCoordinates_ITRF).colwise() + aToPositionCoordinates_ITRF;
+        const auto scanStartTime = std::chrono::steady_clock::now();
+
+        const Ephemeris* toEphemerisPtr =
+            someToEphemerides.isEmpty() ? nullptr : someToEphemerides[aTrajectoryIndex];
 
-        // Not worth optimizing using eigen operations, it's slower for lower N values.
-        MatrixXd dx_SEZ = MatrixXd::Zero(3, dx.cols());
-        for (Eigen::Index i = 0; i < dx.cols(); ++i)
+        Index ephemerisHintIndex = 0;
+
+        for (Index index = aStartIndex; index < anEndIndex; ++index)
         {
-            dx_SEZ.col(i) = SEZRotations.block<3, 3>(0, 3 * i) * dx.col(i);
-        }
+            const Instant& instant = instants[index];
 
-        // calculate azimuth, elevation, and range
-        const VectorXd range_m = dx_SEZ.colwise().norm();
-        const VectorXd elevation_rad = (dx_SEZ.row(2).transpose().array() / range_m.array()).asin();
-        VectorXd azimuth_rad = dx_SEZ.row(0).array().binaryExpr(
-            dx_SEZ.row(1).array(),
-            [](double x, double y)
+            if (aStatisticsPtr != nullptr)
             {
-                return std::atan2(y, -x);
+                aStatisticsPtr->sampleCount += 1;
             }
-        );
 
-        azimuth_rad = azimuth_rad.unaryExpr(
-            [](double x)
+            // The observer state is only needed when the ephemeris does not tabulate this instant, or by the state
+            // filter.
+            std::optional<State> toTrajectoryState;
+
+            const std::optional<Index> ephemerisIndex =
+                (toEphemerisPtr != nullptr)
+                    ? FindInstantIndex(toEphemerisPtr->accessInstants(), instant, ephemerisHintIndex)
+                    : std::nullopt;
+
+            // calculate target to satellite vector in ITRF
+            Vector3d toPositionCoordinates_ITRF;
+
+            if (ephemerisIndex.has_value())
             {
-                return x < 0.0 ? x + 2.0 * M_PI : x;
+                toPositionCoordinates_ITRF = toEphemerisPtr->accessPositionCoordinates().col(ephemerisIndex.value());
+                ephemerisHintIndex = ephemerisIndex.value() + 1;
+
+                if (aStatisticsPtr != nullptr)
+                {
+                    aStatisticsPtr->ephemerisLookupCount += 1;
+                }
             }
-        );
+            else
+            {
+                toTrajectoryState.emplace(aToTrajectory.getStateAt(instant));
+                toPositionCoordinates_ITRF =
+                    computePositionCoordinates_ITRF(toTrajectoryState.value(), index, aStatisticsPtr);
 
-        return {azimuth_rad, elevation_rad, range_m};
-    };
+                if (aStatisticsPtr != nullptr)
+                {
+                    aStatisticsPtr->trajectoryEvaluationCount += 1;
+                }
+            }
 
-    const auto computeElevations = [&fromPositionCoordinates_ITRF](const Vector3d& aToPositionCoordinates_ITRF
-                                   ) -> VectorXd
-    {
-        const MatrixXd dx = (-fromPositionCoordinates_ITRF).colwise() + aToPositionCoordinates_ITRF;
-        const MatrixXd fromPositionDirection_ITRF = fromPositionCoordinates_ITRF.colwise().normalized();
+            if (isPrescreeningEnabled)
+            {
+                const Instant earliestVisibilityInstant =
+                    computeEarliestVisibilityInstant(toPositionCoordinates_ITRF, instant);
 
-        // columnwise dot product of dx and fromPositionDirection_ITRF
-        const VectorXd dx_Z =
-            (dx.cwiseProduct(fromPositionDirection_ITRF)).colwise().sum().array() / dx.colwise().norm().array();
+                // No target sees the observer before this instant: leave the corresponding rows out of access.
+                if (earliestVisibilityInstant.isDefined())
+                {
+                    while (((index + 1) < anEndIndex) && (instants[index + 1] < earliestVisibilityInstant))
+                    {
+                        ++index;
+                    }
 
-        return dx_Z.array().asin();
-    };
+                    continue;
+                }
+            }
 
-    std::function<ArrayXb(const MatrixXd&, const Vector3d&, const Instant&)> visibilityCriterionFilter;
+            // check if satellite is in access
+            auto inAccess =
+                visibilityCriterionFilter(fromPositionCoordinates_ITRF, toPositionCoordinates_ITRF, instant);
 
-    if (allAccessTargetsHaveAERIntervals)
-    {
-        // create a stacked matrix of azimuth, elevation, and range bounds for all access targets
-        MatrixXd aerLowerBounds = MatrixXd::Zero(targetCount, 3);
-        MatrixXd aerUpperBounds = MatrixXd::Zero(targetCount, 3);
+            // State filters only apply to the targets that satisfy their visibility criterion, and the observer state
+            // is only evaluated if there is any.
+            if ((stateFilter || batchStateFilter) && inAccess.any())
+            {
+                if (!toTrajectoryState.has_value())
+                {
+                    toTrajectoryState.emplace(aToTrajectory.getStateAt(instant));
 
-        for (Index i = 0; i < targetCount; ++i)
-        {
-            const VisibilityCriterion::AERInterval visibilityCriterion =
-                someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::AERInterval>().value();
+                    if (aStatisticsPtr != nullptr)
+                    {
+                        aStatisticsPtr->trajectoryEvaluationCount += 1;
+                    }
+                }
 
-            aerLowerBounds(i, 0) = visibilityCriterion.azimuth.accessLowerBound();
-            aerLowerBounds(i, 1) = visibilityCriterion.elevation.accessLowerBound();
-            aerLowerBounds(i, 2) = visibilityCriterion.range.accessLowerBound();
+                if (stateFilter)
+                {
+                    for (Index i = 0; i < targetCount; ++i)
+                    {
+                        if (inAccess(i))
+                        {
+                            const State fromState = someAccessTargets[i].accessTrajectory().getStateAt(instant);
+
+                            if (aStatisticsPtr != nullptr)
+                            {
+                                aStatisticsPtr->trajectoryEvaluationCount += 1;
+                            }
+
+                            inAccess(i) = stateFilter(fromState, toTrajectoryState.value());
+                        }
+                    }
+                }
+
+                if (batchStateFilter)
+                {
+                    // Fixed targets are at rest in the body-fixed frame: build their (GCRF) states from the precomputed
+                    // positions, with a single frame transform for all of them.
+                    const Transform transform_GCRF_ITRF = accessFrameSPtr->getTransformTo(gcrfSPtr, instant);
+
+                    if (aStatisticsPtr != nullptr)
+                    {
+                        aStatisticsPtr->frameTransformCount += 1;
+                    }
+
+                    Array<Index> candidateIndices = Array<Index>::Empty();
+                    Array<State> fromStates = Array<State>::Empty();
+
+                    for (Index i = 0; i < targetCount; ++i)
+                    {
+                        if (inAccess(i))
+                        {
+                            const Vector3d fromPositionCoordinate_ITRF = fromPositionCoordinates_ITRF.col(i);
+
+                            candidateIndices.add(i);
+                            fromStates.add(State(
+                                instant,
+                                Position::Meters(
+                                    transform_GCRF_ITRF.applyToPosition(fromPositionCoordinate_ITRF), gcrfSPtr
+                                ),
+                                Velocity::MetersPerSecond(
+                                    transform_GCRF_ITRF.applyToVelocity(fromPositionCoordinate_ITRF, Vector3d::Zero()),
+                                    gcrfSPtr
+                                )
+                            ));
+                        }
+                    }
+
+                    if (!fromStates.isEmpty())
+                    {
+                        const Array<bool> isRetained =
+                            ApplyBatchStateFilter(batchStateFilter, toTrajectoryState.value(), fromStates);
+
+                        for (Index j = 0; j < candidateIndices.getSize(); ++j)
+                        {
+                            inAccess(candidateIndices[j]) = isRetained[j];
+                        }
+                    }
+                }
+            }
 
-            aerUpperBounds(i, 0) = visibilityCriterion.azimuth.accessUpperBound();
-            aerUpperBounds(i, 1) = visibilityCriterion.elevation.accessUpperBound();
-            aerUpperBounds(i, 2) = visibilityCriterion.range.accessUpperBound();
+            anInAccessPerTarget.row(index) = inAccess.cast<int>().transpose();
         }
 
-        visibilityCriterionFilter = [aerLowerBounds, aerUpperBounds, &computeAer](
-                                        const MatrixXd& aFromPositionCoordinates_ITRF,
-                                        const Vector3d& aToPositionCoordinates_ITRF,
-                                        const Instant& anInstant
-                                    )
+        if (aStatisticsPtr != nullptr)
         {
-            (void)anInstant;
-            (void)aFromPositionCoordinates_ITRF;
-
-            const auto [azimuths, elevations, ranges] = computeAer(aToPositionCoordinates_ITRF);
+            aStatisticsPtr->samplingDuration = aStatisticsPtr->samplingDuration + ElapsedSince(scanStartTime);
+        }
+    };
 
-            return (azimuths.array() > aerLowerBounds.col(0).array() &&
-                    azimuths.array() < aerUpperBounds.col(0).array() &&
-                    elevations.array() > aerLowerBounds.col(1).array() &&
-                    elevations.array() < aerUpperBounds.col(1).array() &&
-                    ranges.array() > aerLowerBounds.col(2).array() && ranges.array() < aerUpperBounds.col(2).array())
-                .eval();
-        };
-    }
-    else if (allAccessTargetsHaveMasks)
+    // Coarse access state carried from one window to the next, per trajectory and target: the start of an access still
+    // open at the end of the previous window, and the end of the last completed access (which bounds the search for
+    // the next start crossing).
+    Array<Array<Instant>> openAccessStarts =
+        Array<Array<Instant>>(trajectoryCount, Array<Instant>(targetCount, Instant::Undefined()));
+    Array<Array<Instant>> previousAccessEnds =
+        Array<Array<Instant>>(trajectoryCount, Array<Instant>(targetCount, Instant::Undefined()));
+
+    Instant nextWindowStartInstant = anInterval.getStart();
+    Instant previousWindowEndInstant = Instant::Undefined();
+    bool isLastWindow = !isWindowed;
+
+    // Turn the in-access column of a target into the coarse intervals of the accesses completed within the current
+    // window. Also output the end of the last access completed in previous windows, which bounds the search for the
+    // first start crossing.
+    const auto collectAccessIntervals = [&](const MatrixXi& anInAccessPerTarget,
+                                            const Index& aTrajectoryIndex,
+                                            const Index& aTargetIndex,
+                                            Instant& aPreviousAccessEnd) -> Array<physics::time::Interval>
     {
-        visibilityCriterionFilter = [&someAccessTargets, &computeAer](
-                                        const MatrixXd& aFromPositionCoordinates_ITRF,
-                                        const Vector3d& aToPositionCoordinates_ITRF,
-                                        const Instant& anInstant
-                                    )
-        {
-            (void)anInstant;
-            (void)aFromPositionCoordinates_ITRF;
+        Instant& openAccessStart = openAccessStarts[aTrajectoryIndex][aTargetIndex];
+        Instant& previousAccessEnd = previousAccessEnds[aTrajectoryIndex][aTargetIndex];
 
-            const auto [azimuths_rad, elevations_rad, ranges_m] = computeAer(aToPositionCoordinates_ITRF);
+        Array<physics::time::Interval> accessIntervals =
+            ComputeIntervals(anInAccessPerTarget.col(aTargetIndex), instants);
 
-            ArrayXb mask(azimuths_rad.rows());
-            for (Eigen::Index i = 0; i < mask.rows(); ++i)
+        // merge with (or close) the access left open by the previous window
+        if (openAccessStart.isDefined())
+        {
+            if (anInAccessPerTarget(0, aTargetIndex) == 1)
             {
-                const VisibilityCriterion::AERMask visibilityCriterion =
-                    someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::AERMask>().value();
+                accessIntervals[0] = physics::time::Interval::Closed(openAccessStart, accessIntervals[0].getEnd());
+            }
+            else
+            {
+                accessIntervals.insert(
+                    accessIntervals.begin(), physics::time::Interval::Closed(openAccessStart, previousWindowEndInstant)
+                );
+            }
 
-                const double& azimuth_rad = azimuths_rad(i);
-                const double& elevation_rad = elevations_rad(i);
-                const double& range_m = ranges_m(i);
+            openAccessStart = Instant::Undefined();
+        }
 
-                mask(i) = visibilityCriterion.isSatisfied(azimuth_rad, elevation_rad, range_m);
-            }
+        // hold back the access still open at the end of this window
+        if ((!isLastWindow) && (anInAccessPerTarget(anInAccessPerTarget.rows() - 1, aTargetIndex) == 1))
+        {
+            openAccessStart = accessIntervals.accessLast().getStart();
+            accessIntervals.pop_back();
+        }
 
-            return mask;
-        };
-    }
-    else if (allAccessTargetsHaveLineOfSight)
+        aPreviousAccessEnd = previousAccessEnd;
+
+        if (!accessIntervals.isEmpty())
+        {
+            previousAccessEnd = accessIntervals.accessLast().getEnd();
+        }
+
+        return accessIntervals;
+    };
+
+    // Refine the coarse intervals of a target (unless in coarse mode), and generate the corresponding accesses.
+    const auto generateAccesses = [&](const Trajectory& aToTrajectory,
+                                      const Array<physics::time::Interval>& someAccessIntervals,
+                                      const Instant& aPreviousAccessEnd,
+                                      const Index& aTargetIndex,
+                                      Statistics* aStatisticsPtr) -> Array<Access>
     {
-        visibilityCriterionFilter = [&someAccessTargets](
-                                        const MatrixXd& aFromPositionCoordinates_ITRF,
-                                        const Vector3d& aToPositionCoordinates_ITRF,
-                                        const Instant& anInstant
-                                    )
+        if (someAccessIntervals.isEmpty())
         {
-            ArrayXb mask(aFromPositionCoordinates_ITRF.cols());
+            return Array<Access>::Empty();
+        }
 
-            for (Eigen::Index i = 0; i < mask.rows(); ++i)
+        const Array<physics::time::Interval> accessIntervals =
+            coarse ? someAccessIntervals
+                   : this->computePreciseCrossings(
+                         someAccessIntervals,
+                         anInterval,
+                         fromPositionCoordinates_ITRF.col(aTargetIndex),
+                         aToTrajectory,
+                         someAccessTargets[aTargetIndex],
+                         celestialSPtr,
+                         aPreviousAccessEnd,
+                         aStatisticsPtr
+                     );
+
+        const Trajectory& fromTrajectory = someAccessTargets[aTargetIndex].accessTrajectory();
+
+        return this->generateAccessesFromIntervals(
+            accessIntervals, anInterval, fromTrajectory, aToTrajectory, aStatisticsPtr
+        );
+    };
+
+    do
+    {
+        if (isWindowed)
+        {
+            // generate the grid of the next window, continuing from the first instant not covered by the previous one
+            instants = Array<Instant>::Empty();
+            instants.reserve(windowStepCount + 1);
+
+            Instant instant = nextWindowStartInstant;
+
+            while ((instants.getSize() < windowStepCount) && (instant < anInterval.getEnd()))
             {
-                const VisibilityCriterion::LineOfSight visibilityCriterion =
-                    someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::LineOfSight>().value();
+                instants.add(instant);
+                instant = instant + this->step_;
+            }
 
-                const Vector3d& fromPositionCoordinate_ITRF = aFromPositionCoordinates_ITRF.col(i);
+            isLastWindow = !(instant < anInterval.getEnd());
 
-                mask(i) = visibilityCriterion.isSatisfied(
-                    anInstant, fromPositionCoordinate_ITRF, aToPositionCoordinates_ITRF
-                );
+            if (isLastWindow)
+            {
+                instants.add(anInterval.getEnd());
             }
 
-            return mask;
-        };
-    }
-    else if (allAccessTargetsHaveElevationIntervals)
-    {
-        // create a stacked matrix of azimuth, elevation, and range bounds for all ground targets
-        VectorXd elevationLowerBounds = VectorXd::Zero(targetCount);
-        VectorXd elevationUpperBounds = VectorXd::Zero(targetCount);
+            nextWindowStartInstant = instant;
+        }
 
-        for (Index i = 0; i < targetCount; ++i)
+        const Size instantCount = instants.getSize();
+
+        // ephemerides already hold body-fixed positions
+        if ((trajectoryCount > 1) && someToEphemerides.isEmpty())
         {
-            const VisibilityCriterion::ElevationInterval visibilityCriterion =
-                someAccessTargets[i].accessVisibilityCriterion().as<VisibilityCriterion::ElevationInterval>().value();
+            transforms_ITRF_GCRF = Array<Transform>(instantCount, Transform::Undefined());
 
-            elevationLowerBounds(i) = visibilityCriterion.elevation.accessLowerBound();
-            elevationUpperBounds(i) = visibilityCriterion.elevation.accessUpperBound();
+            const Size chunkCount = std::min(instantCount, 4 * workerCount);
+
+            ParallelFor(
+                chunkCount,
+                workerCount,
+                [&](const Index& aChunkIndex, const Index& aWorkerIndex) -> void
+                {
+                    const auto chunkStartTime = std::chrono::steady_clock::now();
+
+                    const Index startIndex = (aChunkIndex * instantCount) / chunkCount;
+                    const Index endIndex = ((aChunkIndex + 1) * instantCount) / chunkCount;
+
+                    for (Index index = startIndex; index < endIndex; ++index)
+                    {
+                        transforms_ITRF_GCRF[index] = gcrfSPtr->getTransformTo(accessFrameSPtr, instants[index]);
+                    }
+
+                    if (Statistics* statisticsPtr = accessStatistics(aWorkerIndex))
+                    {
+                        statisticsPtr->frameTransformCount += endIndex - startIndex;
+                        statisticsPtr->samplingDuration =
+                            statisticsPtr->samplingDuration + ElapsedSince(chunkStartTime);
+                    }
+                }
+            );
         }
 
-        visibilityCriterionFilter = [elevationLowerBounds, elevationUpperBounds, &computeElevations](
-                                        const MatrixXd& aFromPositionCoordinates_ITRF,
-                                        const Vector3d& aToPositionCoordinates_ITRF,
-                                        const Instant& anInstant
-                                    )
+        Array<Array<Array<Access>>> accesses = Array<Array<Array<Access>>>(
+            trajectoryCount, Array<Array<Access>>(targetCount, Array<Access>::Empty())
+        );
+
+        if (!isSplitPerTrajectory)
         {
-            (void)anInstant;
-            (void)aFromPositionCoordinates_ITRF;
+            ParallelFor(
+                trajectoryCount,
+                workerCount,
+                [&](const Index& aTrajectoryIndex, const Index& aWorkerIndex) -> void
+                {
+                    const Trajectory& toTrajectory = *someToTrajectories[aTrajectoryIndex];
 
-            const VectorXd elevations = computeElevations(aToPositionCoordinates_ITRF);
+                    Statistics* statisticsPtr = accessStatistics(aWorkerIndex);
 
-            return (elevations.array() > elevationLowerBounds.array() &&
-                    elevations.array() < elevationUpperBounds.array())
-                .eval();
-        };
-    }
-    else
-    {
-        throw ostk::core::error::RuntimeError("All access targets must have the same type of Visibility Criteria.");
-    }
+                    MatrixXi inAccessPerTarget = MatrixXi::Zero(instantCount, targetCount);
 
-    const Array<Instant> instants = anInterval.generateGrid(this->step_);
+                    scan(toTrajectory, aTrajectoryIndex, 0, instantCount, inAccessPerTarget, statisticsPtr);
 
-    MatrixXi inAccessPerTarget = MatrixXi::Zero(instants.getSize(), targetCount);
+                    for (Index targetIndex = 0; targetIndex < targetCount; ++targetIndex)
+                    {
+                        Instant previousAccessEnd = Instant::Undefined();
 
-    // Bind the state filter once, rather than copying the std::function (and re-running isDefined()) on every step.
-    const std::function<bool(const State&, const State&)>& stateFilter = this->stateFilter_;
+                        const Array<physics::time::Interval> accessIntervals = collectAccessIntervals(
+                            inAccessPerTarget, aTrajectoryIndex, targetIndex, previousAccessEnd
+                        );
 
-    for (Index index = 0; index < instants.getSize(); ++index)
-    {
-        const Instant& instant = instants[index];
+                        accesses[aTrajectoryIndex][targetIndex] = generateAccesses(
+                            toTrajectory, accessIntervals, previousAccessEnd, targetIndex, statisticsPtr
+                        );
+                    }
+                }
+            );
+        }
+        else
+        {
+            Array<MatrixXi> inAccessPerTargetPerTrajectory =
+                Array<MatrixXi>(trajectoryCount, MatrixXi::Zero(instantCount, targetCount));
 
-        const State toTrajectoryState = aToTrajectory.getStateAt(instant);
+            // Split the grid into contiguous chunks (a few per worker, to balance load). Each chunk writes to its own
+            // rows of the in-access matrices, so the result does not depend on the scheduling.
+            const Size chunkCount = std::min(instantCount, 4 * workerCount);
 
-        // calculate target to satellite vector in ITRF (transform only the position, not the whole state)
-        const Vector3d toPositionCoordinates_ITRF =
-            toTrajectoryState.getPosition().inFrame(celestialSPtr->accessFrame(), instant).getCoordinates();
+            ParallelFor(
+                trajectoryCount * chunkCount,
+                workerCount,
+                [&](const Index& anItemIndex, const Index& aWorkerIndex) -> void
+                {
+                    const Index trajectoryIndex = anItemIndex / chunkCount;
+                    const Index chunkIndex = anItemIndex % chunkCount;
+
+                    scan(
+                        accessToTrajectory(trajectoryIndex, aWorkerIndex),
+                        trajectoryIndex,
+                        (chunkIndex * instantCount) / chunkCount,
+                        ((chunkIndex + 1) * instantCount) / chunkCount,
+                        inAccessPerTargetPerTrajectory[trajectoryIndex],
+                        accessStatistics(aWorkerIndex)
+                    );
+                }
+            );
 
-        // check if satellite is in access
-        auto inAccess = visibilityCriterionFilter(fromPositionCoordinates_ITRF, toPositionCoordinates_ITRF, instant);
+            // Refining crossings and generating accesses dominates for dense target networks. Each coarse interval is a
+            // separate work item, so that targets with many accesses do not hold up the others. Items write to their
+            // own slot, and are gathered in order, so the output does not depend on the scheduling.
+            Array<CoarseAccess> coarseAccesses = Array<CoarseAccess>::Empty();
 
-        if (stateFilter)
-        {
-            for (Index i = 0; i < targetCount; ++i)
+            for (Index trajectoryIndex = 0; trajectoryIndex < trajectoryCount; ++trajectoryIndex)
             {
-                const State fromState = someAccessTargets[i].accessTrajectory().getStateAt(instant);
+                for (Index targetIndex = 0; targetIndex < targetCount; ++targetIndex)
+                {
+                    Instant previousAccessEnd = Instant::Undefined();
+
+                    const Array<physics::time::Interval> accessIntervals = collectAccessIntervals(
+                        inAccessPerTargetPerTrajectory[trajectoryIndex], trajectoryIndex, targetIndex, previousAccessEnd
+                    );
+
+                    for (Index i = 0; i < accessIntervals.getSize(); ++i)
+                    {
+                        coarseAccesses.add(CoarseAccess {
+                            trajectoryIndex,
+                            targetIndex,
+                            accessIntervals[i],
+                            (i == 0) ? previousAccessEnd : accessIntervals[i - 1].getEnd(),
+                        });
+                    }
+                }
+            }
+
+            Array<Array<Access>> accessesPerCoarseAccess =
+                Array<Array<Access>>(coarseAccesses.getSize(), Array<Access>::Empty());
+
+            ParallelFor(
+                coarseAccesses.getSize(),
+                workerCount,
+                [&](const Index& anItemIndex, const Index& aWorkerIndex) -> void
+                {
+                    const CoarseAccess& coarseAccess = coarseAccesses[anItemIndex];
+
+                    accessesPerCoarseAccess[anItemIndex] = generateAccesses(
+                        accessToTrajectory(coarseAccess.trajectoryIndex, aWorkerIndex),
+                        {coarseAccess.interval},
+                        coarseAccess.previousAccessEnd,
+                        coarseAccess.targetIndex,
+                        accessStatistics(aWorkerIndex)
+                    );
+                }
+            );
 
-                inAccess(i) = inAccess(i) && stateFilter(fromState, toTrajectoryState);
+            for (Index i = 0; i < coarseAccesses.getSize(); ++i)
+            {
+                for (const Access& access : accessesPerCoarseAccess[i])
+                {
+                    accesses[coarseAccesses[i].trajectoryIndex][coarseAccesses[i].targetIndex].add(access);
+                }
             }
         }
 
-        inAccessPerTarget.row(index) = inAccess.cast<int>().transpose();
-    }
+        // hand over the accesses from the calling thread, in a deterministic order
+        for (Index trajectoryIndex = 0; trajectoryIndex < trajectoryCount; ++trajectoryIndex)
+        {
+            for (Index targetIndex = 0; targetIndex < targetCount; ++targetIndex)
+            {
+                anAccessesCallback(trajectoryIndex, targetIndex, accesses[trajectoryIndex][targetIndex]);
+            }
+        }
 
-    Array<Array<physics::time::Interval>> accessIntervalsPerTarget =
-        Array<Array<physics::time::Interval>>(targetCount, Array<physics::time::Interval>::Empty());
+        previousWindowEndInstant = instants.accessLast();
 
-    for (Index i = 0; i < targetCount; ++i)
-    {
-        accessIntervalsPerTarget[i] = ComputeIntervals(inAccessPerTarget.col(i), instants);
-    }
+    } while (!isLastWindow);
 
-    if (!coarse)
+    if (this->isStatisticsEnabled_)
     {
-        for (Index i = 0; i < accessIntervalsPerTarget.getSize(); ++i)
+        Statistics statistics;
+
+        for (const Statistics& workerStatistics : statisticsPerWorker)
         {
-            accessIntervalsPerTarget[i] = this->computePreciseCrossings(
-                accessIntervalsPerTarget[i],
-                anInterval,
-                fromPositionCoordinates_ITRF.col(i),
-                aToTrajectory,
-                someAccessTargets[i],
-                celestialSPtr
-            );
+            statistics += workerStatistics;
         }
-    }
 
-    Array<Array<Access>> accesses = Array<Array<Access>>(targetCount, Array<Access>::Empty());
-    for (Index i = 0; i < accessIntervalsPerTarget.getSize(); ++i)
-    {
-        const Trajectory& fromTrajectory = someAccessTargets[i].accessTrajectory();
-        accesses[i] =
-            this->generateAccessesFromIntervals(accessIntervalsPerTarget[i], anInterval, fromTrajectory, aToTrajectory);
-    }
+        statistics.computationCount = 1;
+        statistics.totalDuration = ElapsedSince(startTime);
 
-    return accesses;
+        this->statisticsAccumulator_.add(statistics);
+    }
 }
 
 Array<Access> Generator::generateAccessesFromIntervals(
     const Array<physics::time::Interval>& someIntervals,
     const physics::time::Interval& anInterval,
     const Trajectory& aFromTrajectory,
-    const Trajectory& aToTrajectory
+    const Trajectory& aToTrajectory,
+    Statistics* aStatisticsPtr
 ) const
 {
+    const auto startTime = std::chrono::steady_clock::now();
+
     const Shared<const Celestial> celestialSPtr = this->environment_.hasCentralCelestialObject()
                                                     ? this->environment_.accessCentralCelestialObject()
                                                     : this->environment_.accessCelestialObjectWithName("Earth");
 
-    return someIntervals
-        .map<Access>(
-            [&anInterval, &aFromTrajectory, &aToTrajectory, &celestialSPtr, this](
-                const physics::time::Interval& anAccessInterval
-            ) -> Access
-            {
-                return Generator::GenerateAccess(
-                    anAccessInterval, anInterval, aFromTrajectory, aToTrajectory, this->tolerance_, celestialSPtr
-                );
-            }
-        )
-        .getWhere(
-            [this](const Access& anAccess) -> bool
-            {
-                return this->accessFilter_ ? this->accessFilter_(anAccess) : true;
-            }
-        );
+    const Array<Access> accesses =
+        someIntervals
+            .map<Access>(
+                [&anInterval, &aFromTrajectory, &aToTrajectory, &celestialSPtr, aStatisticsPtr, this](
+                    const physics::time::Interval& anAccessInterval
+                ) -> Access
+                {
+                    return Generator::GenerateAccess(
+                        anAccessInterval,
+                        anInterval,
+                        aFromTrajectory,
+                        aToTrajectory,
+                        this->tolerance_,
+                        celestialSPtr,
+                        aStatisticsPtr
+                    );
+                }
+            )
+            .getWhere(
+                [this](const Access& anAccess) -> bool
+                {
+                    return this->accessFilter_ ? this->accessFilter_(anAccess) : true;
+                }
+            );
+
+    if (aStatisticsPtr != nullptr)
+    {
+        aStatisticsPtr->accessCount += someIntervals.getSize();
+        aStatisticsPtr->generationDuration = aStatisticsPtr->generationDuration + ElapsedSince(startTime);
+    }
+
+    return accesses;
 }
 
 Array<physics::time::Interval> Generator::computePreciseCrossings(
@@ -777,23 +2340,26 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
     const Vector3d& fromPositionCoordinate_ITRF,
     const Trajectory& aToTrajectory,
     const AccessTarget& anAccessTarget,
-    const Shared<const Celestial>& aCelestialSPtr
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Instant& aPreviousAccessEnd,
+    Statistics* aStatisticsPtr
 ) const
 {
+    const auto startTime = std::chrono::steady_clock::now();
+
     const RootSolver rootSolver = RootSolver(100, this->tolerance_.inSeconds());
 
     const Matrix3d SEZRotation = anAccessTarget.computeR_SEZ_ECEF(aCelestialSPtr);
 
     std::function<bool(const Instant&)> condition;
 
-    const auto computeAER = [&fromPositionCoordinate_ITRF, &SEZRotation, &aToTrajectory, &aCelestialSPtr](
-                                const Instant& instant
-                            ) -> Triple<Real, Real, Real>
+    const auto computeAER =
+        [&fromPositionCoordinate_ITRF, &SEZRotation, &aToTrajectory, &aCelestialSPtr, aStatisticsPtr](
+            const Instant& instant
+        ) -> Triple<Real, Real, Real>
     {
-        const Vector3d toPositionCoordinates_ITRF = aToTrajectory.getStateAt(instant)
-                                                        .getPosition()
-                                                        .inFrame(aCelestialSPtr->accessFrame(), instant)
-                                                        .getCoordinates();
+        const Vector3d toPositionCoordinates_ITRF =
+            GetPositionCoordinatesInFrame(aToTrajectory, aCelestialSPtr->accessFrame(), instant, aStatisticsPtr);
 
         const Vector3d dx = toPositionCoordinates_ITRF - fromPositionCoordinate_ITRF;
 
@@ -836,14 +2402,26 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
         const VisibilityCriterion::LineOfSight visibilityCriterion =
             anAccessTarget.accessVisibilityCriterion().as<VisibilityCriterion::LineOfSight>().value();
 
-        condition = [&fromPositionCoordinate_ITRF, &aToTrajectory, &aCelestialSPtr, visibilityCriterion](
-                        const Instant& instant
-                    ) -> bool
+        // must match the coarse evaluation, so that crossings stay bracketed
+        const std::optional<EllipsoidLineOfSight> ellipsoidLineOfSight =
+            EllipsoidLineOfSight::FromLineOfSight(visibilityCriterion);
+
+        condition = [&fromPositionCoordinate_ITRF,
+                     &aToTrajectory,
+                     &aCelestialSPtr,
+                     visibilityCriterion,
+                     ellipsoidLineOfSight,
+                     aStatisticsPtr](const Instant& instant) -> bool
         {
-            const Vector3d toPositionCoordinates_ITRF = aToTrajectory.getStateAt(instant)
-                                                            .getPosition()
-                                                            .inFrame(aCelestialSPtr->accessFrame(), instant)
-                                                            .getCoordinates();
+            const Vector3d toPositionCoordinates_ITRF =
+                GetPositionCoordinatesInFrame(aToTrajectory, aCelestialSPtr->accessFrame(), instant, aStatisticsPtr);
+
+            if (ellipsoidLineOfSight.has_value())
+            {
+                return ellipsoidLineOfSight->isSatisfied(
+                    instant, fromPositionCoordinate_ITRF, toPositionCoordinates_ITRF
+                );
+            }
 
             return visibilityCriterion.isSatisfied(instant, fromPositionCoordinate_ITRF, toPositionCoordinates_ITRF);
         };
@@ -853,14 +2431,13 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
         const VisibilityCriterion::ElevationInterval visibilityCriterion =
             anAccessTarget.accessVisibilityCriterion().as<VisibilityCriterion::ElevationInterval>().value();
 
-        condition = [&fromPositionCoordinate_ITRF, &aToTrajectory, &aCelestialSPtr, visibilityCriterion](
-                        const Instant& instant
-                    ) -> bool
+        condition =
+            [&fromPositionCoordinate_ITRF, &aToTrajectory, &aCelestialSPtr, visibilityCriterion, aStatisticsPtr](
+                const Instant& instant
+            ) -> bool
         {
-            const Vector3d toPositionCoordinates_ITRF = aToTrajectory.getStateAt(instant)
-                                                            .getPosition()
-                                                            .inFrame(aCelestialSPtr->accessFrame(), instant)
-                                                            .getCoordinates();
+            const Vector3d toPositionCoordinates_ITRF =
+                GetPositionCoordinatesInFrame(aToTrajectory, aCelestialSPtr->accessFrame(), instant, aStatisticsPtr);
 
             const Vector3d dx = toPositionCoordinates_ITRF - fromPositionCoordinate_ITRF;
 
@@ -874,6 +2451,15 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
         throw ostk::core::error::RuntimeError("VisibilityCriterion type not supported.");
     }
 
+    const auto recordCrossing = [aStatisticsPtr](const RootSolver::Solution& aSolution) -> void
+    {
+        if (aStatisticsPtr != nullptr)
+        {
+            aStatisticsPtr->crossingCount += 1;
+            aStatisticsPtr->rootSolverIterationCount += aSolution.iterationCount;
+        }
+    };
+
     Array<physics::time::Interval> preciseAccessIntervals = accessIntervals;
 
     for (Index i = 0; i < preciseAccessIntervals.getSize(); ++i)
@@ -901,9 +2487,11 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
 
         const Instant intervalPreviousStep = interval.getStart() - this->step_;
 
-        const Instant lowerBoundPreviousInstant =
-            i == 0 ? intervalPreviousStep
-                   : std::max(intervalPreviousStep, accessIntervals[i - 1].getEnd() + this->step_);
+        const Instant previousAccessEnd = i == 0 ? aPreviousAccessEnd : accessIntervals[i - 1].getEnd();
+
+        const Instant lowerBoundPreviousInstant = previousAccessEnd.isDefined()
+                                                    ? std::max(intervalPreviousStep, previousAccessEnd + this->step_)
+                                                    : intervalPreviousStep;
 
         const Instant lowerBoundInstant = interval.getStart();
 
@@ -920,6 +2508,7 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
                 0.0,
                 Duration::Between(lowerBoundPreviousInstant, lowerBoundInstant).inSeconds()
             );
+            recordCrossing(startCrossingDurationSeconds);
             intervalStart = lowerBoundPreviousInstant + Duration::Seconds(startCrossingDurationSeconds.root);
         }
 
@@ -939,12 +2528,18 @@ Array<physics::time::Interval> Generator::computePreciseCrossings(
                 0.0,
                 Duration::Between(upperBoundInstant, upperBoundNextInstant).inSeconds()
             );
+            recordCrossing(endCrossingDurationSeconds);
             intervalEnd = upperBoundInstant + Duration::Seconds(endCrossingDurationSeconds.root);
         }
 
         preciseAccessIntervals[i] = physics::time::Interval::Closed(intervalStart, intervalEnd);
     }
 
+    if (aStatisticsPtr != nullptr)
+    {
+        aStatisticsPtr->refinementDuration = aStatisticsPtr->refinementDuration + ElapsedSince(startTime);
+    }
+
     return preciseAccessIntervals;
 }
 
@@ -997,7 +2592,8 @@ Access Generator::GenerateAccess(
     const Trajectory& aFromTrajectory,
     const Trajectory& aToTrajectory,
     const Duration& aTolerance,
-    const Shared<const Celestial>& aCelestialSPtr
+    const Shared<const Celestial>& aCelestialSPtr,
+    Statistics* aStatisticsPtr
 )
 {
     const Access::Type type = ((aGlobalInterval.accessStart() != anAccessInterval.accessStart()) &&
@@ -1008,7 +2604,7 @@ Access Generator::GenerateAccess(
     const Instant acquisitionOfSignal = anAccessInterval.getStart();
 
     const Instant timeOfClosestApproach = Generator::FindTimeOfClosestApproach(
-        anAccessInterval, aFromTrajectory, aToTrajectory, aTolerance, aCelestialSPtr
+        anAccessInterval, aFromTrajectory, aToTrajectory, aTolerance, aCelestialSPtr, aStatisticsPtr
     );
 
     const Instant lossOfSignal = anAccessInterval.getEnd();
@@ -1024,7 +2620,9 @@ Access Generator::GenerateAccess(
 
     const Angle maxElevation =
         timeOfClosestApproach.isDefined()
-            ? Generator::CalculateElevationAt(timeOfClosestApproach, aFromTrajectory, aToTrajectory, aCelestialSPtr)
+            ? Generator::CalculateElevationAt(
+                  timeOfClosestApproach, aFromTrajectory, aToTrajectory, aCelestialSPtr, aStatisticsPtr
+              )
             : Angle::Undefined();
 
     return Access {type, acquisitionOfSignal, timeOfClosestApproach, lossOfSignal, maxElevation};
@@ -1035,7 +2633,8 @@ Instant Generator::FindTimeOfClosestApproach(
     const Trajectory& aFromTrajectory,
     const Trajectory& aToTrajectory,
     const Duration& aTolerance,
-    const Shared<const Celestial>& aCelestialSPtr
+    const Shared<const Celestial>& aCelestialSPtr,
+    Statistics* aStatisticsPtr
 )
 {
     struct Context
@@ -1043,6 +2642,7 @@ Instant Generator::FindTimeOfClosestApproach(
         const Instant& startInstant;
         const std::function<Pair<State, State>(const Instant& anInstant)>& getStatesAt;
         const Shared<const Celestial>& celestialSPtr;
+        Statistics* statisticsPtr;
     };
 
     // Capture-less, so that it converts to the plain function pointer NLopt expects: everything it
@@ -1064,9 +2664,13 @@ Instant Generator::FindTimeOfClosestApproach(
 
         const Shared<const Frame>& celestialFrameSPtr = contextPtr->celestialSPtr->accessFrame();
 
-        const Vector3d deltaPosition =
-            queryFromState.getPosition().inFrame(celestialFrameSPtr, queryInstant).accessCoordinates() -
-            queryToState.getPosition().inFrame(celestialFrameSPtr, queryInstant).accessCoordinates();
+        const Position queryFromPosition = GetPositionInFrame(
+            queryFromState.getPosition(), celestialFrameSPtr, queryInstant, contextPtr->statisticsPtr
+        );
+        const Position queryToPosition =
+            GetPositionInFrame(queryToState.getPosition(), celestialFrameSPtr, queryInstant, contextPtr->statisticsPtr);
+
+        const Vector3d deltaPosition = queryFromPosition.accessCoordinates() - queryToPosition.accessCoordinates();
 
         const Real rangeSquared = deltaPosition.squaredNorm();
 
@@ -1074,11 +2678,16 @@ Instant Generator::FindTimeOfClosestApproach(
     };
 
     const std::function<Pair<State, State>(const Instant& anInstant)> getStatesAt =
-        [&aFromTrajectory, &aToTrajectory](const Instant& anInstant) -> Pair<State, State>
+        [&aFromTrajectory, &aToTrajectory, aStatisticsPtr](const Instant& anInstant) -> Pair<State, State>
     {
+        if (aStatisticsPtr != nullptr)
+        {
+            aStatisticsPtr->closestApproachEvaluationCount += 1;
+        }
+
         return {
-            aFromTrajectory.getStateAt(anInstant),
-            aToTrajectory.getStateAt(anInstant),
+            GetStateAt(aFromTrajectory, anInstant, aStatisticsPtr),
+            GetStateAt(aToTrajectory, anInstant, aStatisticsPtr),
         };
     };
 
@@ -1086,6 +2695,7 @@ Instant Generator::FindTimeOfClosestApproach(
         anAccessInterval.getStart(),
         getStatesAt,
         aCelestialSPtr,
+        aStatisticsPtr,
     };
 
     nlopt::opt optimizer = {nlopt::LN_COBYLA, 1};
@@ -1136,17 +2746,14 @@ Angle Generator::CalculateElevationAt(
     const Instant& anInstant,
     const Trajectory& aFromTrajectory,
     const Trajectory& aToTrajectory,
-    const Shared<const Celestial>& aCelestialSPtr
+    const Shared<const Celestial>& aCelestialSPtr,
+    Statistics* aStatisticsPtr
 )
 {
-    const Vector3d fromPositionCoordinates_ITRF = aFromTrajectory.getStateAt(anInstant)
-                                                      .getPosition()
-                                                      .inFrame(aCelestialSPtr->accessFrame(), anInstant)
-                                                      .getCoordinates();
-    const Vector3d toPositionCoordinates_ITRF = aToTrajectory.getStateAt(anInstant)
-                                                    .getPosition()
-                                                    .inFrame(aCelestialSPtr->accessFrame(), anInstant)
-                                                    .getCoordinates();
+    const Vector3d fromPositionCoordinates_ITRF =
+        GetPositionCoordinatesInFrame(aFromTrajectory, aCelestialSPtr->accessFrame(), anInstant, aStatisticsPtr);
+    const Vector3d toPositionCoordinates_ITRF =
+        GetPositionCoordinatesInFrame(aToTrajectory, aCelestialSPtr->accessFrame(), anInstant, aStatisticsPtr);
 
     const Vector3d dx = toPositionCoordinates_ITRF - fromPositionCoordinates_ITRF;
 
@@ -1157,11 +2764,12 @@ AER Generator::CalculateAer(
     const Instant& anInstant,
     const Position& aFromPosition,
     const Position& aToPosition,
-    const Shared<const Celestial>& aCelestialSPtr
+    const Shared<const Celestial>& aCelestialSPtr,
+    Statistics* aStatisticsPtr
 )
 {
     const Vector3d referenceCoordinates_ITRF =
-        aFromPosition.inFrame(aCelestialSPtr->accessFrame(), anInstant).accessCoordinates();
+        GetPositionInFrame(aFromPosition, aCelestialSPtr->accessFrame(), anInstant, aStatisticsPtr).accessCoordinates();
 
     const LLA referencePoint_LLA = LLA::Cartesian(
         referenceCoordinates_ITRF, aCelestialSPtr->getEquatorialRadius(), aCelestialSPtr->getFlattening()
@@ -1169,8 +2777,8 @@ AER Generator::CalculateAer(
 
     const Shared<const Frame> nedFrameSPtr = aCelestialSPtr->getFrameAt(referencePoint_LLA, Celestial::FrameType::NED);
 
-    const Position fromPosition_NED = aFromPosition.inFrame(nedFrameSPtr, anInstant);
-    const Position toPosition_NED = aToPosition.inFrame(nedFrameSPtr, anInstant);
+    const Position fromPosition_NED = GetPositionInFrame(aFromPosition, nedFrameSPtr, anInstant, aStatisticsPtr);
+    const Position toPosition_NED = GetPositionInFrame(aToPosition, nedFrameSPtr, anInstant, aStatisticsPtr);
 
     return AER::FromPositionToPosition(fromPosition_NED, toPosition_NED, true);
 }
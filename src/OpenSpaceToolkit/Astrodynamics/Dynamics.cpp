@@ -1,5 +1,9 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -16,6 +20,7 @@ namespace astrodynamics
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Size;
 
 using ostk::physics::environment::object::Celestial;
@@ -26,6 +31,36 @@ using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::dynamics::ThirdBodyGravity;
 
+namespace
+{
+
+/// @brief Scope of the computation of a contribution, added to its timer on exit when profiling
+class ContributionTimerScope
+{
+   public:
+    ContributionTimerScope(const Array<Shared<NumericalSolver::Profile::Timer>>& aTimerArray, const Index& anIndex)
+        : timerPtr_(aTimerArray.isEmpty() ? nullptr : aTimerArray[anIndex].get()),
+          startTime_(
+              (timerPtr_ != nullptr) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()
+          )
+    {
+    }
+
+    ~ContributionTimerScope()
+    {
+        if (timerPtr_ != nullptr)
+        {
+            timerPtr_->add(std::chrono::steady_clock::now() - startTime_);
+        }
+    }
+
+   private:
+    NumericalSolver::Profile::Timer* timerPtr_;
+    const std::chrono::steady_clock::time_point startTime_;
+};
+
+}  // namespace
+
 Dynamics::Context::Context(
     const Shared<Dynamics>& aDynamicsSPtr,
     const Array<Pair<Index, Size>>& aReadIndexes,
@@ -34,16 +69,159 @@ Dynamics::Context::Context(
     : dynamics(aDynamicsSPtr),
       readIndexes(aReadIndexes),
       writeIndexes(aWriteIndexes),
-      readStateSize(0)
+      readStateSize(0),
+      writeStateSize(0)
 {
     for (const Pair<Index, Size>& pair : readIndexes)
     {
         this->readStateSize += pair.second;
     }
+
+    for (const Pair<Index, Size>& pair : writeIndexes)
+    {
+        this->writeStateSize += pair.second;
+    }
+
+    this->readState = VectorXd::Zero(readStateSize);
+    this->contribution = VectorXd::Zero(writeStateSize);
+}
+
+Dynamics::TransformCache::TransformCache()
+    : instant_(Instant::Undefined()),
+      entries_(Array<Entry>::Empty())
+{
+}
+
+Transform Dynamics::TransformCache::getTransform(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+)
+{
+    if ((!instant_.isDefined()) || (instant_ != anInstant))
+    {
+        // clear() keeps the capacity, so that steady-state evaluations do not allocate
+        entries_.clear();
+        instant_ = anInstant;
+    }
+
+    for (const Entry& entry : entries_)
+    {
+        if ((entry.fromFrameSPtr == aFromFrameSPtr) && (entry.toFrameSPtr == aToFrameSPtr))
+        {
+            return entry.transform;
+        }
+    }
+
+    const Transform transform = aFromFrameSPtr->getTransformTo(aToFrameSPtr, anInstant);
+
+    entries_.add(Entry {aFromFrameSPtr, aToFrameSPtr, transform});
+
+    return transform;
+}
+
+Size Dynamics::TransformCache::getSize() const
+{
+    return entries_.getSize();
+}
+
+Dynamics::MultiRateCache::MultiRateCache(
+    const Duration& aMaximumInterval, const Real& aTolerance, const Size& aContributionSize
+)
+    : maximumInterval_(aMaximumInterval.inSeconds()),
+      tolerance_(aTolerance),
+      interval_(maximumInterval_ / 8.0),
+      evaluationCount_(0),
+      sampleCount_(0),
+      previousTime_(0.0),
+      latestTime_(0.0),
+      previousSlowContribution_(VectorXd::Zero(aContributionSize)),
+      latestSlowContribution_(VectorXd::Zero(aContributionSize)),
+      fastContribution_(VectorXd::Zero(aContributionSize)),
+      predictedSlowContribution_(VectorXd::Zero(aContributionSize))
+{
+}
+
+void Dynamics::MultiRateCache::computeContribution(
+    const Dynamics& aDynamics,
+    const Instant& anInstant,
+    const double& aTime,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    TransformCache& aTransformCache
+)
+{
+    aDynamics.computeFastContributionInPlace(anInstant, x, aFrameSPtr, fastContribution_, aTransformCache);
+
+    // The slow part is predicted from its two latest samples, and thus evaluated at every call until they are available
+    if ((sampleCount_ == 2) && (std::abs(aTime - latestTime_) <= interval_))
+    {
+        this->predictSlowContribution(aTime);
+
+        aContribution = fastContribution_ + predictedSlowContribution_;
+
+        return;
+    }
+
+    aDynamics.computeContributionInPlace(anInstant, x, aFrameSPtr, aContribution, aTransformCache);
+
+    // Samples far apart (e.g. when the integration restarts from its initial time, in the other direction) are not
+    // interpolated between. Evaluations otherwise occur a fraction of a step beyond the interval.
+    if (std::abs(aTime - latestTime_) > 2.0 * maximumInterval_)
+    {
+        sampleCount_ = 0;
+    }
+
+    if (sampleCount_ == 2)
+    {
+        // Adapt the interval to the deviation of the prediction over the elapsed time, assuming an interpolation error
+        // quadratic in time
+        this->predictSlowContribution(aTime);
+
+        const double error = (aContribution - fastContribution_ - predictedSlowContribution_).cwiseAbs().maxCoeff();
+        const double factor = (error > 0.0) ? std::clamp(0.9 * std::sqrt(tolerance_ / error), 0.2, 2.0) : 2.0;
+
+        interval_ = std::min(maximumInterval_, std::abs(aTime - latestTime_) * factor);
+    }
+
+    previousTime_ = latestTime_;
+    previousSlowContribution_.swap(latestSlowContribution_);
+
+    latestTime_ = aTime;
+    latestSlowContribution_ = aContribution - fastContribution_;
+
+    sampleCount_ = std::min<Size>(sampleCount_ + 1, 2);
+    ++evaluationCount_;
+}
+
+Duration Dynamics::MultiRateCache::getInterval() const
+{
+    return Duration::Seconds(interval_);
+}
+
+Size Dynamics::MultiRateCache::getEvaluationCount() const
+{
+    return evaluationCount_;
+}
+
+void Dynamics::MultiRateCache::predictSlowContribution(const double& aTime)
+{
+    if (latestTime_ == previousTime_)
+    {
+        predictedSlowContribution_ = latestSlowContribution_;
+
+        return;
+    }
+
+    const double ratio = (aTime - latestTime_) / (latestTime_ - previousTime_);
+
+    predictedSlowContribution_ =
+        latestSlowContribution_ + ratio * (latestSlowContribution_ - previousSlowContribution_);
 }
 
 Dynamics::Dynamics(const String& aName)
-    : name_(aName)
+    : name_(aName),
+      multiRateMaximumInterval_(Duration::Undefined()),
+      multiRateTolerance_(Real::Undefined())
 {
 }
 
@@ -61,6 +239,53 @@ String Dynamics::getName() const
     return name_;
 }
 
+bool Dynamics::isMultiRateEvaluationEnabled() const
+{
+    return multiRateMaximumInterval_.isDefined();
+}
+
+Duration Dynamics::getMultiRateMaximumInterval() const
+{
+    return multiRateMaximumInterval_;
+}
+
+Real Dynamics::getMultiRateTolerance() const
+{
+    return multiRateTolerance_;
+}
+
+void Dynamics::setMultiRateEvaluation(const Duration& aMaximumInterval, const Real& aTolerance)
+{
+    if (!aMaximumInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-rate maximum interval");
+    }
+
+    if (!aMaximumInterval.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Multi-rate maximum interval");
+    }
+
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-rate tolerance");
+    }
+
+    if (!aTolerance.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Multi-rate tolerance");
+    }
+
+    multiRateMaximumInterval_ = aMaximumInterval;
+    multiRateTolerance_ = aTolerance;
+}
+
+void Dynamics::disableMultiRateEvaluation()
+{
+    multiRateMaximumInterval_ = Duration::Undefined();
+    multiRateTolerance_ = Real::Undefined();
+}
+
 void Dynamics::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Dynamics") : void();
@@ -70,26 +295,253 @@ void Dynamics::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+void Dynamics::computeContributionInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    [[maybe_unused]] TransformCache& aTransformCache
+) const
+{
+    aContribution = this->computeContribution(anInstant, x, aFrameSPtr);
+}
+
+void Dynamics::computeFastContributionInPlace(
+    [[maybe_unused]] const Instant& anInstant,
+    [[maybe_unused]] const Eigen::Ref<const VectorXd>& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    [[maybe_unused]] TransformCache& aTransformCache
+) const
+{
+    aContribution.setZero();
+}
+
+MatrixXd Dynamics::computeContributions(
+    const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    Size writeStateSize = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : this->getWriteCoordinateSubsets())
+    {
+        writeStateSize += subset->getSize();
+    }
+
+    MatrixXd contributions(aStateMatrix.rows(), writeStateSize);
+
+    for (Eigen::Index i = 0; i < aStateMatrix.rows(); ++i)
+    {
+        contributions.row(i) =
+            this->computeContribution(anInstant, aStateMatrix.row(i).transpose(), aFrameSPtr).transpose();
+    }
+
+    return contributions;
+}
+
+void Dynamics::computeContributionsInPlace(
+    const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix,
+    [[maybe_unused]] TransformCache& aTransformCache
+) const
+{
+    aContributionMatrix = this->computeContributions(anInstant, aStateMatrix, aFrameSPtr);
+}
+
+bool Dynamics::hasContributionJacobian() const
+{
+    return false;
+}
+
+MatrixXd Dynamics::computeContributionJacobian(
+    [[maybe_unused]] const Instant& anInstant,
+    [[maybe_unused]] const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr
+) const
+{
+    throw ostk::core::error::RuntimeError("Dynamics [{}] does not provide a contribution Jacobian.", name_);
+}
+
+void Dynamics::computeContributionJacobianInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<MatrixXd> aJacobian,
+    [[maybe_unused]] TransformCache& aTransformCache
+) const
+{
+    aJacobian = this->computeContributionJacobian(anInstant, x, aFrameSPtr);
+}
+
 NumericalSolver::SystemOfEquationsWrapper Dynamics::GetSystemOfEquations(
-    const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<NumericalSolver::Profile>& aProfileSPtr
+)
+{
+    return std::bind(
+        Dynamics::DynamicalEquations<NumericalSolver::StateVector>,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        aContextArray,
+        Dynamics::ContributionTimers(aContextArray, aProfileSPtr),
+        Dynamics::MultiRateCaches(aContextArray),
+        Dynamics::TransformCache(),
+        anInstant,
+        aFrameSPtr
+    );
+}
+
+template <Size N>
+NumericalSolver::FixedSizeSystemOfEquationsWrapper<N> Dynamics::GetFixedSizeSystemOfEquations(
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<NumericalSolver::Profile>& aProfileSPtr
 )
 {
     return std::bind(
-        Dynamics::DynamicalEquations,
+        Dynamics::DynamicalEquations<NumericalSolver::FixedSizeStateVector<N>>,
         std::placeholders::_1,
         std::placeholders::_2,
         std::placeholders::_3,
         aContextArray,
+        Dynamics::ContributionTimers(aContextArray, aProfileSPtr),
+        Dynamics::MultiRateCaches(aContextArray),
+        Dynamics::TransformCache(),
+        anInstant,
+        aFrameSPtr
+    );
+}
+
+NumericalSolver::SystemOfEquationsWrapper Dynamics::GetBatchSystemOfEquations(
+    const Array<Dynamics::Context>& aContextArray,
+    const Size& aMemberCount,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<NumericalSolver::Profile>& aProfileSPtr
+)
+{
+    // The system of equations holds its own copy of the contexts, whose batch buffers are sized here once
+    Array<Dynamics::Context> contextArray = aContextArray;
+
+    for (const Dynamics::Context& dynamicsContext : contextArray)
+    {
+        dynamicsContext.readStateMatrix = MatrixXd::Zero(aMemberCount, dynamicsContext.readStateSize);
+        dynamicsContext.contributionMatrix = MatrixXd::Zero(aMemberCount, dynamicsContext.writeStateSize);
+    }
+
+    return std::bind(
+        Dynamics::BatchDynamicalEquations,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        contextArray,
+        Dynamics::ContributionTimers(aContextArray, aProfileSPtr),
+        aMemberCount,
+        Dynamics::TransformCache(),
         anInstant,
         aFrameSPtr
     );
 }
 
+NumericalSolver::SystemOfEquationsWrapper Dynamics::GetVariationalSystemOfEquations(
+    const Array<Dynamics::Context>& aContextArray,
+    const Size& aStateSize,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<NumericalSolver::Profile>& aProfileSPtr
+)
+{
+    // The system of equations holds its own copy of the contexts, whose Jacobian buffers are sized here once
+    Array<Dynamics::Context> contextArray = aContextArray;
+
+    for (const Dynamics::Context& dynamicsContext : contextArray)
+    {
+        if (!dynamicsContext.dynamics->hasContributionJacobian())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Dynamics [{}] does not provide a contribution Jacobian.", dynamicsContext.dynamics->getName()
+            );
+        }
+
+        dynamicsContext.contributionJacobian =
+            MatrixXd::Zero(dynamicsContext.writeStateSize, dynamicsContext.readStateSize);
+    }
+
+    return std::bind(
+        Dynamics::VariationalDynamicalEquations,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        contextArray,
+        Dynamics::ContributionTimers(aContextArray, aProfileSPtr),
+        MatrixXd(MatrixXd::Zero(aStateSize, aStateSize)),
+        Dynamics::TransformCache(),
+        anInstant,
+        aFrameSPtr
+    );
+}
+
+template <typename StateVector>
 void Dynamics::DynamicalEquations(
+    const StateVector& x,
+    StateVector& dxdt,
+    const double& t,
+    const Array<Dynamics::Context>& aContextArray,
+    const Array<Shared<NumericalSolver::Profile::Timer>>& aContributionTimerArray,
+    const Array<Shared<Dynamics::MultiRateCache>>& aMultiRateCacheArray,
+    Dynamics::TransformCache& aTransformCache,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    dxdt.setZero();
+
+    const Instant nextInstant = anInstant + Duration::Seconds(t);
+
+    for (Index i = 0; i < aContextArray.getSize(); ++i)
+    {
+        const Dynamics::Context& dynamicsContext = aContextArray[i];
+        const ContributionTimerScope contributionTimerScope = {aContributionTimerArray, i};
+
+        Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readState);
+
+        if ((!aMultiRateCacheArray.isEmpty()) && (aMultiRateCacheArray[i] != nullptr))
+        {
+            aMultiRateCacheArray[i]->computeContribution(
+                *dynamicsContext.dynamics,
+                nextInstant,
+                t,
+                dynamicsContext.readState,
+                aFrameSPtr,
+                dynamicsContext.contribution,
+                aTransformCache
+            );
+        }
+        else
+        {
+            dynamicsContext.dynamics->computeContributionInPlace(
+                nextInstant, dynamicsContext.readState, aFrameSPtr, dynamicsContext.contribution, aTransformCache
+            );
+        }
+
+        Dynamics::applyContribution(dxdt, dynamicsContext.contribution, dynamicsContext.writeIndexes);
+    }
+}
+
+void Dynamics::BatchDynamicalEquations(
     const NumericalSolver::StateVector& x,
     NumericalSolver::StateVector& dxdt,
     const double& t,
     const Array<Dynamics::Context>& aContextArray,
+    const Array<Shared<NumericalSolver::Profile::Timer>>& aContributionTimerArray,
+    const Size& aMemberCount,
+    Dynamics::TransformCache& aTransformCache,
     const Instant& anInstant,
     const Shared<const Frame>& aFrameSPtr
 )
@@ -98,39 +550,182 @@ void Dynamics::DynamicalEquations(
 
     const Instant nextInstant = anInstant + Duration::Seconds(t);
 
-    for (const Dynamics::Context& dynamicsContext : aContextArray)
+    const Eigen::Index memberCount = aMemberCount;
+    const Eigen::Index stateSize = x.size() / memberCount;
+
+    // column-major layout: each coordinate subset spans a contiguous block of columns
+    const Eigen::Map<const MatrixXd> stateMatrix(x.data(), memberCount, stateSize);
+    Eigen::Map<MatrixXd> stateDerivativeMatrix(dxdt.data(), memberCount, stateSize);
+
+    for (Index i = 0; i < aContextArray.getSize(); ++i)
     {
-        const VectorXd contribution = dynamicsContext.dynamics->computeContribution(
+        const Dynamics::Context& dynamicsContext = aContextArray[i];
+        const ContributionTimerScope contributionTimerScope = {aContributionTimerArray, i};
+
+        Index readOffset = 0;
+
+        for (const Pair<Index, Size>& pair : dynamicsContext.readIndexes)
+        {
+            dynamicsContext.readStateMatrix.middleCols(readOffset, pair.second) =
+                stateMatrix.middleCols(pair.first, pair.second);
+            readOffset += pair.second;
+        }
+
+        dynamicsContext.dynamics->computeContributionsInPlace(
             nextInstant,
-            Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readStateSize),
-            aFrameSPtr
+            dynamicsContext.readStateMatrix,
+            aFrameSPtr,
+            dynamicsContext.contributionMatrix,
+            aTransformCache
         );
 
-        Dynamics::applyContribution(dxdt, contribution, dynamicsContext.writeIndexes);
+        Index writeOffset = 0;
+
+        for (const Pair<Index, Size>& pair : dynamicsContext.writeIndexes)
+        {
+            stateDerivativeMatrix.middleCols(pair.first, pair.second) +=
+                dynamicsContext.contributionMatrix.middleCols(writeOffset, pair.second);
+            writeOffset += pair.second;
+        }
     }
 }
 
-VectorXd Dynamics::extractReadState(
-    const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, const Size readSize
+void Dynamics::VariationalDynamicalEquations(
+    const NumericalSolver::StateVector& x,
+    NumericalSolver::StateVector& dxdt,
+    const double& t,
+    const Array<Dynamics::Context>& aContextArray,
+    const Array<Shared<NumericalSolver::Profile::Timer>>& aContributionTimerArray,
+    MatrixXd& aStateJacobian,
+    Dynamics::TransformCache& aTransformCache,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    dxdt.setZero();
+
+    const Instant nextInstant = anInstant + Duration::Seconds(t);
+
+    const Eigen::Index stateSize = aStateJacobian.rows();
+
+    // A = ∂f/∂x, assembled block by block from the read and write indexes of each dynamics, in a buffer held by the
+    // system of equations
+    MatrixXd& A = aStateJacobian;
+    A.setZero();
+
+    for (Index i = 0; i < aContextArray.getSize(); ++i)
+    {
+        const Dynamics::Context& dynamicsContext = aContextArray[i];
+        const ContributionTimerScope contributionTimerScope = {aContributionTimerArray, i};
+
+        // The read and write indexes all point within the state, ahead of the state transition matrix
+        Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readState);
+
+        dynamicsContext.dynamics->computeContributionInPlace(
+            nextInstant, dynamicsContext.readState, aFrameSPtr, dynamicsContext.contribution, aTransformCache
+        );
+
+        Dynamics::applyContribution(dxdt, dynamicsContext.contribution, dynamicsContext.writeIndexes);
+
+        dynamicsContext.dynamics->computeContributionJacobianInPlace(
+            nextInstant, dynamicsContext.readState, aFrameSPtr, dynamicsContext.contributionJacobian, aTransformCache
+        );
+
+        const MatrixXd& jacobian = dynamicsContext.contributionJacobian;
+
+        Index writeOffset = 0;
+
+        for (const Pair<Index, Size>& writePair : dynamicsContext.writeIndexes)
+        {
+            Index readOffset = 0;
+
+            for (const Pair<Index, Size>& readPair : dynamicsContext.readIndexes)
+            {
+                A.block(writePair.first, readPair.first, writePair.second, readPair.second) +=
+                    jacobian.block(writeOffset, readOffset, writePair.second, readPair.second);
+                readOffset += readPair.second;
+            }
+
+            writeOffset += writePair.second;
+        }
+    }
+
+    // dΦ/dt = A Φ
+    const Eigen::Map<const MatrixXd> stateTransitionMatrix(x.data() + stateSize, stateSize, stateSize);
+    Eigen::Map<MatrixXd> stateTransitionMatrixDerivative(dxdt.data() + stateSize, stateSize, stateSize);
+
+    stateTransitionMatrixDerivative.noalias() = A * stateTransitionMatrix;
+}
+
+Array<Shared<NumericalSolver::Profile::Timer>> Dynamics::ContributionTimers(
+    const Array<Dynamics::Context>& aContextArray, const Shared<NumericalSolver::Profile>& aProfileSPtr
+)
+{
+    if (aProfileSPtr == nullptr)
+    {
+        return Array<Shared<NumericalSolver::Profile::Timer>>::Empty();
+    }
+
+    return aContextArray.map<Shared<NumericalSolver::Profile::Timer>>(
+        [&aProfileSPtr](const Dynamics::Context& aContext) -> Shared<NumericalSolver::Profile::Timer>
+        {
+            return aProfileSPtr->accessContributionTimer(aContext.dynamics->getName());
+        }
+    );
+}
+
+Array<Shared<Dynamics::MultiRateCache>> Dynamics::MultiRateCaches(const Array<Dynamics::Context>& aContextArray)
+{
+    const bool anyMultiRate = std::any_of(
+        aContextArray.begin(),
+        aContextArray.end(),
+        [](const Dynamics::Context& aContext) -> bool
+        {
+            return aContext.dynamics->isMultiRateEvaluationEnabled();
+        }
+    );
+
+    if (!anyMultiRate)
+    {
+        return Array<Shared<Dynamics::MultiRateCache>>::Empty();
+    }
+
+    // One cache per system of equations, shared by its copies, as the integrator copies the system it is given
+    return aContextArray.map<Shared<Dynamics::MultiRateCache>>(
+        [](const Dynamics::Context& aContext) -> Shared<Dynamics::MultiRateCache>
+        {
+            if (!aContext.dynamics->isMultiRateEvaluationEnabled())
+            {
+                return nullptr;
+            }
+
+            return std::make_shared<Dynamics::MultiRateCache>(
+                aContext.dynamics->getMultiRateMaximumInterval(),
+                aContext.dynamics->getMultiRateTolerance(),
+                aContext.writeStateSize
+            );
+        }
+    );
+}
+
+void Dynamics::extractReadState(
+    const Eigen::Ref<const VectorXd>& x, const Array<Pair<Index, Size>>& readInfo, VectorXd& aReadState
 )
 {
     Index offset = 0;
-    VectorXd reducedState = VectorXd(readSize);
 
     for (const Pair<Index, Size>& pair : readInfo)
     {
         const Index subsetOffset = pair.first;
         const Size subsetSize = pair.second;
 
-        reducedState.segment(offset, subsetSize) = x.segment(subsetOffset, subsetSize);
+        aReadState.segment(offset, subsetSize) = x.segment(subsetOffset, subsetSize);
         offset += subsetSize;
     }
-
-    return reducedState;
 }
 
 void Dynamics::applyContribution(
-    NumericalSolver::StateVector& dxdt, const VectorXd& contribution, const Array<Pair<Index, Size>>& writeInfo
+    Eigen::Ref<VectorXd> dxdt, const VectorXd& contribution, const Array<Pair<Index, Size>>& writeInfo
 )
 {
     Index offset = 0;
@@ -184,5 +779,15 @@ Array<Shared<Dynamics>> Dynamics::FromEnvironment(const Environment& anEnvironme
     return dynamicsArray;
 }
 
+template NumericalSolver::FixedSizeSystemOfEquationsWrapper<6> Dynamics::GetFixedSizeSystemOfEquations<6>(
+    const Array<Dynamics::Context>&, const Instant&, const Shared<const Frame>&, const Shared<NumericalSolver::Profile>&
+);
+template NumericalSolver::FixedSizeSystemOfEquationsWrapper<7> Dynamics::GetFixedSizeSystemOfEquations<7>(
+    const Array<Dynamics::Context>&, const Instant&, const Shared<const Frame>&, const Shared<NumericalSolver::Profile>&
+);
+template NumericalSolver::FixedSizeSystemOfEquationsWrapper<8> Dynamics::GetFixedSizeSystemOfEquations<8>(
+    const Array<Dynamics::Context>&, const Instant&, const Shared<const Frame>&, const Shared<NumericalSolver::Profile>&
+);
+
 }  // namespace astrodynamics
 }  // namespace ostk
@@ -1,9 +1,13 @@
 /// Apache License 2.0
 
+#include <cmath>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
@@ -19,7 +23,10 @@ namespace dynamics
 using ostk::core::type::Real;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
+
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::Unit;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
@@ -90,32 +97,199 @@ VectorXd AtmosphericDrag::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
 {
-    Vector3d positionCoordinates = Vector3d(x[0], x[1], x[2]);
-    Vector3d velocityCoordinates = Vector3d(x[3], x[4], x[5]);
+    VectorXd contribution(3);
+    TransformCache transformCache;
+
+    this->computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache);
+
+    return contribution;
+}
+
+void AtmosphericDrag::computeContributionInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    TransformCache& aTransformCache
+) const
+{
+    const Vector3d positionCoordinates = x.head<3>();
+    const Vector3d velocityCoordinates = x.segment<3>(3);
     const Real mass = x[6];         // kg
     const Real surfaceArea = x[7];  // m^2
     const Real dragCoefficient = x[8];
 
-    // Get atmospheric density
+    const Shared<const Frame> celestialFrameSPtr = celestialObjectSPtr_->accessFrame();
+    const Transform transform = aTransformCache.getTransform(aFrameSPtr, celestialFrameSPtr, anInstant);
+
+    // Get atmospheric density, with the position already expressed in the celestial frame
     const Real atmosphericDensity =
-        celestialObjectSPtr_->getAtmosphericDensityAt(Position::Meters(positionCoordinates, aFrameSPtr), anInstant)
+        celestialObjectSPtr_
+            ->getAtmosphericDensityAt(
+                Position::Meters(transform.applyToPosition(positionCoordinates), celestialFrameSPtr), anInstant
+            )
             .inUnit(Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter)))
             .getValue();
 
-    const Vector3d earthAngularVelocity =
-        aFrameSPtr->getTransformTo(celestialObjectSPtr_->accessFrame(), anInstant).getAngularVelocity();  // rad/s
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
 
     const Vector3d relativeVelocity = velocityCoordinates - earthAngularVelocity.cross(positionCoordinates);
 
     // Compute drag contribution to state derivative
-    const Vector3d dragAccelerationSI =
+    aContribution =
         -(0.5 / mass) * surfaceArea * dragCoefficient * atmosphericDensity * relativeVelocity.norm() * relativeVelocity;
+}
 
-    // Compute contribution
-    VectorXd contribution(3);
-    contribution << dragAccelerationSI[0], dragAccelerationSI[1], dragAccelerationSI[2];
+MatrixXd AtmosphericDrag::computeContributions(
+    const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd contributions(aStateMatrix.rows(), 3);
+    TransformCache transformCache;
 
-    return contribution;
+    this->computeContributionsInPlace(anInstant, aStateMatrix, aFrameSPtr, contributions, transformCache);
+
+    return contributions;
+}
+
+void AtmosphericDrag::computeContributionsInPlace(
+    const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix,
+    TransformCache& aTransformCache
+) const
+{
+    const Unit densityUnit = Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter));
+
+    const Shared<const Frame> celestialFrameSPtr = celestialObjectSPtr_->accessFrame();
+    const Transform transform = aTransformCache.getTransform(aFrameSPtr, celestialFrameSPtr, anInstant);
+
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
+
+    for (Eigen::Index i = 0; i < aStateMatrix.rows(); ++i)
+    {
+        const Vector3d positionCoordinates = aStateMatrix.block<1, 3>(i, 0).transpose();
+        const Vector3d velocityCoordinates = aStateMatrix.block<1, 3>(i, 3).transpose();
+
+        // Get atmospheric density, with the position already expressed in the celestial frame
+        const double atmosphericDensity =
+            celestialObjectSPtr_
+                ->getAtmosphericDensityAt(
+                    Position::Meters(transform.applyToPosition(positionCoordinates), celestialFrameSPtr), anInstant
+                )
+                .inUnit(densityUnit)
+                .getValue();
+
+        const Vector3d relativeVelocity = velocityCoordinates - earthAngularVelocity.cross(positionCoordinates);
+
+        // mass [kg], surface area [m^2] and drag coefficient
+        const double factor = -(0.5 / aStateMatrix(i, 6)) * aStateMatrix(i, 7) * aStateMatrix(i, 8) *
+                              atmosphericDensity * relativeVelocity.norm();
+
+        aContributionMatrix.row(i) = (factor * relativeVelocity).transpose();
+    }
+}
+
+bool AtmosphericDrag::hasContributionJacobian() const
+{
+    return true;
+}
+
+MatrixXd AtmosphericDrag::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd jacobian(3, 9);
+    TransformCache transformCache;
+
+    this->computeContributionJacobianInPlace(anInstant, x, aFrameSPtr, jacobian, transformCache);
+
+    return jacobian;
+}
+
+void AtmosphericDrag::computeContributionJacobianInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<MatrixXd> aJacobian,
+    TransformCache& aTransformCache
+) const
+{
+    const Vector3d positionCoordinates = x.head<3>();
+    const Vector3d velocityCoordinates = x.segment<3>(3);
+    const double mass = x[6];         // kg
+    const double surfaceArea = x[7];  // m^2
+    const double dragCoefficient = x[8];
+
+    const Shared<const Frame> celestialFrameSPtr = celestialObjectSPtr_->accessFrame();
+    const Transform transform = aTransformCache.getTransform(aFrameSPtr, celestialFrameSPtr, anInstant);
+
+    const Unit densityUnit = Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter));
+
+    const auto getAtmosphericDensityAt = [&](const Vector3d& aPositionCoordinates) -> double
+    {
+        return celestialObjectSPtr_
+            ->getAtmosphericDensityAt(
+                Position::Meters(transform.applyToPosition(aPositionCoordinates), celestialFrameSPtr), anInstant
+            )
+            .inUnit(densityUnit)
+            .getValue();
+    };
+
+    const double atmosphericDensity = getAtmosphericDensityAt(positionCoordinates);
+
+    // Central differences, with a step small compared to the density scale height
+    const double positionStep = 10.0;  // m
+
+    Vector3d atmosphericDensityGradient;
+
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        const Vector3d step = positionStep * Vector3d::Unit(k);
+
+        atmosphericDensityGradient[k] = (getAtmosphericDensityAt(positionCoordinates + step) -
+                                         getAtmosphericDensityAt(positionCoordinates - step)) /
+                                        (2.0 * positionStep);
+    }
+
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
+
+    const Vector3d relativeVelocity = velocityCoordinates - earthAngularVelocity.cross(positionCoordinates);
+    const double relativeSpeed = relativeVelocity.norm();
+
+    // a = (A Cd / m) u, with u = -1/2 ρ |v_r| v_r
+    const Vector3d u = -0.5 * atmosphericDensity * relativeSpeed * relativeVelocity;
+    const double ballisticFactor = surfaceArea * dragCoefficient / mass;
+
+    // ∂a/∂v = -1/2 (A Cd / m) ρ (|v_r| I + v_r v_rᵀ / |v_r|)
+    Matrix3d velocityJacobian = Matrix3d::Zero();
+
+    if (relativeSpeed > 0.0)
+    {
+        velocityJacobian =
+            -0.5 * ballisticFactor * atmosphericDensity *
+            (relativeSpeed * Matrix3d::Identity() + (relativeVelocity * relativeVelocity.transpose()) / relativeSpeed);
+    }
+
+    // v_r = v - ω × r, hence ∂v_r/∂r = -[ω×]
+    Matrix3d angularVelocityCrossMatrix;
+
+    // clang-format off
+    angularVelocityCrossMatrix <<                      0.0, -earthAngularVelocity.z(),  earthAngularVelocity.y(),
+                                  earthAngularVelocity.z(),                       0.0, -earthAngularVelocity.x(),
+                                 -earthAngularVelocity.y(),  earthAngularVelocity.x(),                       0.0;
+    // clang-format on
+
+    // ∂a/∂ρ = -1/2 (A Cd / m) |v_r| v_r
+    const Vector3d densityPartial = -0.5 * ballisticFactor * relativeSpeed * relativeVelocity;
+
+    aJacobian.block<3, 3>(0, 0) =
+        -velocityJacobian * angularVelocityCrossMatrix + densityPartial * atmosphericDensityGradient.transpose();
+    aJacobian.block<3, 3>(0, 3) = velocityJacobian;
+    aJacobian.col(6) = -(ballisticFactor / mass) * u;
+    aJacobian.col(7) = (dragCoefficient / mass) * u;
+    aJacobian.col(8) = (surfaceArea / mass) * u;
 }
 
 void AtmosphericDrag::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -1,8 +1,17 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Model.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
@@ -14,13 +23,114 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::core::filesystem::Directory;
+
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
 
-using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+using GravitationalModel = ostk::physics::environment::gravitational::Model;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+namespace
+{
+
+/// @brief Kaula's rule: RMS of the normalized spherical harmonics coefficients of degree n, 1e-5 / n²
+const double KaulaCoefficient = 1.0e-5;
+
+/// @brief Estimate the acceleration of the terms of degree above aDegree (up to aMaximumDegree) at a given radius
+double OmittedAcceleration(
+    const int& aDegree,
+    const int& aMaximumDegree,
+    const double& aRadius,
+    const double& aGravitationalParameter,
+    const double& anEquatorialRadius
+)
+{
+    const double radiusRatio = anEquatorialRadius / aRadius;
+
+    double radiusRatioPower = std::pow(radiusRatio, aDegree + 1);
+    double acceleration = 0.0;
+
+    // A degree n contributes about μ / r² (n + 1) (R / r)^n √(2n + 1) Kaula / n²
+    for (int n = aDegree + 1; n <= aMaximumDegree; ++n)
+    {
+        acceleration += (n + 1) * radiusRatioPower * std::sqrt(2.0 * n + 1.0) * KaulaCoefficient / (n * n);
+        radiusRatioPower *= radiusRatio;
+    }
+
+    return aGravitationalParameter / (aRadius * aRadius) * acceleration;
+}
+
+/// @brief Find the radius above which the terms of degree above aDegree are within the tolerance
+double MinimumTruncationRadius(
+    const int& aDegree,
+    const int& aMaximumDegree,
+    const double& anAccelerationTolerance,
+    const double& aGravitationalParameter,
+    const double& anEquatorialRadius
+)
+{
+    const auto omittedAcceleration = [&](const double& aRadius) -> double
+    {
+        return OmittedAcceleration(aDegree, aMaximumDegree, aRadius, aGravitationalParameter, anEquatorialRadius);
+    };
+
+    double lowerRadius = anEquatorialRadius;
+    double upperRadius = 1.0e3 * anEquatorialRadius;
+
+    if (omittedAcceleration(lowerRadius) <= anAccelerationTolerance)
+    {
+        return 0.0;
+    }
+
+    if (omittedAcceleration(upperRadius) > anAccelerationTolerance)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // The omitted acceleration decreases with the radius: bisect, in log scale
+    for (Size i = 0; i < 64; ++i)
+    {
+        const double radius = std::sqrt(lowerRadius * upperRadius);
+
+        if (omittedAcceleration(radius) > anAccelerationTolerance)
+        {
+            lowerRadius = radius;
+        }
+        else
+        {
+            upperRadius = radius;
+        }
+    }
+
+    return upperRadius;
+}
+
+/// @brief Next degree of the ladder of truncated models: 2, 3, 4, 6, 8, 12, 16, 24, ...
+int NextTruncationDegree(const int& aDegree)
+{
+    if (aDegree < 4)
+    {
+        return aDegree + 1;
+    }
+
+    const bool isPowerOfTwo = (aDegree & (aDegree - 1)) == 0;
+
+    return isPowerOfTwo ? (aDegree + aDegree / 2) : (aDegree + aDegree / 3);
+}
+
+}  // namespace
+
 CentralBodyGravity::CentralBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr)
     : CentralBodyGravity(
           aCelestialObjectSPtr, String::Format("Central Body Gravity [{}]", aCelestialObjectSPtr->getName())
@@ -30,7 +140,9 @@ CentralBodyGravity::CentralBodyGravity(const Shared<const Celestial>& aCelestial
 
 CentralBodyGravity::CentralBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr, const String& aName)
     : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      truncationTolerance_(Real::Undefined()),
+      truncationLevels_(Array<TruncationLevel>::Empty())
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->gravitationalModelIsDefined())
     {
@@ -62,6 +174,92 @@ Shared<const Celestial> CentralBodyGravity::getCelestial() const
     return celestialObjectSPtr_;
 }
 
+Real CentralBodyGravity::getTruncationTolerance() const
+{
+    return truncationTolerance_;
+}
+
+void CentralBodyGravity::setTruncationTolerance(const Real& anAccelerationTolerance)
+{
+    if (!anAccelerationTolerance.isDefined())
+    {
+        truncationTolerance_ = Real::Undefined();
+        truncationLevels_ = Array<TruncationLevel>::Empty();
+
+        return;
+    }
+
+    if (!anAccelerationTolerance.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Truncation tolerance");
+    }
+
+    const Shared<const EarthGravitationalModel> earthGravitationalModelSPtr =
+        std::dynamic_pointer_cast<const EarthGravitationalModel>(celestialObjectSPtr_->accessGravitationalModel());
+
+    if ((earthGravitationalModelSPtr == nullptr) ||
+        ((earthGravitationalModelSPtr->getType() != EarthGravitationalModel::Type::EGM84) &&
+         (earthGravitationalModelSPtr->getType() != EarthGravitationalModel::Type::WGS84_EGM96) &&
+         (earthGravitationalModelSPtr->getType() != EarthGravitationalModel::Type::EGM96) &&
+         (earthGravitationalModelSPtr->getType() != EarthGravitationalModel::Type::EGM2008)))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Adaptive truncation requires a spherical harmonics gravitational model, for dynamics [{}].",
+            this->getName()
+        );
+    }
+
+    const GravitationalModel::Parameters parameters = earthGravitationalModelSPtr->getParameters();
+    const double gravitationalParameter_SI = parameters.gravitationalParameter_.in(GravitationalParameterSIUnit);
+    const double equatorialRadius_SI = parameters.equatorialRadius_.inMeters();
+
+    const int maximumDegree = earthGravitationalModelSPtr->getDegree();
+    const int maximumOrder = earthGravitationalModelSPtr->getOrder();
+
+    Array<TruncationLevel> truncationLevels = Array<TruncationLevel>::Empty();
+
+    for (int degree = 2; degree < maximumDegree; degree = NextTruncationDegree(degree))
+    {
+        const double minimumRadius = MinimumTruncationRadius(
+            degree, maximumDegree, anAccelerationTolerance, gravitationalParameter_SI, equatorialRadius_SI
+        );
+
+        // Levels that no radius of interest can use are not loaded
+        if (std::isinf(minimumRadius))
+        {
+            continue;
+        }
+
+        truncationLevels.add(TruncationLevel {
+            degree,
+            minimumRadius,
+            std::make_shared<const EarthGravitationalModel>(
+                earthGravitationalModelSPtr->getType(), Directory::Undefined(), degree, std::min(degree, maximumOrder)
+            ),
+        });
+    }
+
+    truncationLevels.add(TruncationLevel {maximumDegree, 0.0, earthGravitationalModelSPtr});
+
+    truncationTolerance_ = anAccelerationTolerance;
+    truncationLevels_ = truncationLevels;
+}
+
+Integer CentralBodyGravity::getTruncationDegreeAt(const Real& aRadius) const
+{
+    if (!aRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Radius");
+    }
+
+    if (truncationLevels_.isEmpty())
+    {
+        return Integer::Undefined();
+    }
+
+    return truncationLevels_[this->getTruncationLevelIndexAt(aRadius)].degree;
+}
+
 Array<Shared<const CoordinateSubset>> CentralBodyGravity::getReadCoordinateSubsets() const
 {
     return {
@@ -80,19 +278,231 @@ VectorXd CentralBodyGravity::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
 {
-    Vector3d positionCoordinates = {x[0], x[1], x[2]};
+    VectorXd contribution(3);
+    TransformCache transformCache;
+
+    this->computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache);
+
+    return contribution;
+}
 
-    // Obtain gravitational acceleration from current object
+void CentralBodyGravity::computeContributionInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    TransformCache& aTransformCache
+) const
+{
+    const Transform transform =
+        aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+    const Vector3d positionCoordinates = transform.applyToPosition(x.head<3>());
+
+    // Obtain gravitational acceleration from current object, in the celestial frame
     const Vector3d gravitationalAccelerationSI =
-        celestialObjectSPtr_->getGravitationalFieldAt(Position::Meters(positionCoordinates, aFrameSPtr), anInstant)
-            .inFrame(aFrameSPtr, anInstant)
-            .getValue();
+        this->accessGravitationalModelAt(positionCoordinates.norm()).getFieldValueAt(positionCoordinates, anInstant);
 
-    // Compute contribution
-    VectorXd contribution(3);
-    contribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
+    // Rotate it back to the given frame
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        aContribution[k] = transform.applyToVector(Vector3d::Unit(k)).dot(gravitationalAccelerationSI);
+    }
+}
 
-    return contribution;
+void CentralBodyGravity::computeFastContributionInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    TransformCache& aTransformCache
+) const
+{
+    const Transform transform =
+        aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+    const double gravitationalParameter_SI = celestialObjectSPtr_->accessGravitationalModel()
+                                                 ->getParameters()
+                                                 .gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+    // Point mass acceleration, in the celestial frame
+    const Vector3d positionCoordinates = transform.applyToPosition(x.head<3>());
+    const double distance = positionCoordinates.norm();
+    const Vector3d gravitationalAccelerationSI =
+        (-gravitationalParameter_SI / (distance * distance * distance)) * positionCoordinates;
+
+    // Rotate it back to the given frame
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        aContribution[k] = transform.applyToVector(Vector3d::Unit(k)).dot(gravitationalAccelerationSI);
+    }
+}
+
+MatrixXd CentralBodyGravity::computeContributions(
+    const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd contributions(aStateMatrix.rows(), 3);
+    TransformCache transformCache;
+
+    this->computeContributionsInPlace(anInstant, aStateMatrix, aFrameSPtr, contributions, transformCache);
+
+    return contributions;
+}
+
+void CentralBodyGravity::computeContributionsInPlace(
+    const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix,
+    TransformCache& aTransformCache
+) const
+{
+    const Eigen::Index memberCount = aStateMatrix.rows();
+
+    // Affine map from the given frame to the celestial frame, shared by all members
+    const Transform transform =
+        aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+    Matrix3d rotation;
+
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        rotation.col(k) = transform.applyToVector(Vector3d::Unit(k));
+    }
+
+    const Vector3d translation = transform.applyToPosition(Vector3d::Zero());
+
+    const Shared<const GravitationalModel> gravitationalModelSPtr = celestialObjectSPtr_->accessGravitationalModel();
+    const GravitationalModel::Parameters parameters = gravitationalModelSPtr->getParameters();
+
+    // A model without zonal terms is a point mass, evaluated in the given frame
+    if ((parameters.J2_ == 0.0) && (parameters.J4_ == 0.0))
+    {
+        const double gravitationalParameter_SI = parameters.gravitationalParameter_.in(GravitationalParameterSIUnit);
+        const Vector3d centerCoordinates = -rotation.transpose() * translation;
+
+        for (Eigen::Index i = 0; i < memberCount; ++i)
+        {
+            const double dx = aStateMatrix(i, 0) - centerCoordinates.x();
+            const double dy = aStateMatrix(i, 1) - centerCoordinates.y();
+            const double dz = aStateMatrix(i, 2) - centerCoordinates.z();
+
+            const double distanceSquared = dx * dx + dy * dy + dz * dz;
+            const double factor = -gravitationalParameter_SI / (distanceSquared * std::sqrt(distanceSquared));
+
+            aContributionMatrix(i, 0) = dx * factor;
+            aContributionMatrix(i, 1) = dy * factor;
+            aContributionMatrix(i, 2) = dz * factor;
+        }
+
+        return;
+    }
+
+    for (Eigen::Index i = 0; i < memberCount; ++i)
+    {
+        const Vector3d positionCoordinates = rotation * aStateMatrix.block<1, 3>(i, 0).transpose() + translation;
+
+        const Vector3d gravitationalAccelerationSI = this->accessGravitationalModelAt(positionCoordinates.norm())
+                                                         .getFieldValueAt(positionCoordinates, anInstant);
+
+        // Rotate it back to the given frame
+        aContributionMatrix.row(i) = (rotation.transpose() * gravitationalAccelerationSI).transpose();
+    }
+}
+
+bool CentralBodyGravity::hasContributionJacobian() const
+{
+    return true;
+}
+
+MatrixXd CentralBodyGravity::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd jacobian(3, 3);
+    TransformCache transformCache;
+
+    this->computeContributionJacobianInPlace(anInstant, x, aFrameSPtr, jacobian, transformCache);
+
+    return jacobian;
+}
+
+void CentralBodyGravity::computeContributionJacobianInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<MatrixXd> aJacobian,
+    TransformCache& aTransformCache
+) const
+{
+    const Transform transform =
+        aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+    Matrix3d rotation;
+
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        rotation.col(k) = transform.applyToVector(Vector3d::Unit(k));
+    }
+
+    const GravitationalModel::Parameters parameters = celestialObjectSPtr_->accessGravitationalModel()->getParameters();
+    const double gravitationalParameter_SI = parameters.gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+    // Position in the celestial frame
+    const Vector3d r = transform.applyToPosition(x.head<3>());
+    const double z = r.z();
+
+    const double rSquared = r.squaredNorm();
+    const double rNorm = std::sqrt(rSquared);
+
+    // Point mass: -μ/r³ (I - 3 r rᵀ / r²)
+    Matrix3d jacobian = (-gravitationalParameter_SI / (rSquared * rNorm)) *
+                        (Matrix3d::Identity() - (3.0 / rSquared) * (r * r.transpose()));
+
+    // J2: a = f (x g₁, y g₁, z g₃), with f = -3/2 J2 μ Re² / r⁵, s = z²/r², g₁ = 1 - 5 s and g₃ = 3 - 5 s
+    if (parameters.J2_ != 0.0)
+    {
+        const double equatorialRadius_SI = parameters.equatorialRadius_.inMeters();
+
+        const double f = -1.5 * parameters.J2_ * gravitationalParameter_SI * equatorialRadius_SI *
+                         equatorialRadius_SI / (rSquared * rSquared * rNorm);
+        const double s = z * z / rSquared;
+
+        const Vector3d g = {1.0 - 5.0 * s, 1.0 - 5.0 * s, 3.0 - 5.0 * s};
+
+        // ∂s/∂r = 2/r² (z e_z - s r)
+        const Vector3d sGradient = (2.0 / rSquared) * (z * Vector3d::UnitZ() - s * r);
+
+        jacobian += f * (Matrix3d(g.asDiagonal()) - (5.0 / rSquared) * (r.cwiseProduct(g) * r.transpose()) -
+                         5.0 * (r * sGradient.transpose()));
+    }
+
+    // Rotate it back to the given frame
+    aJacobian = rotation.transpose() * jacobian * rotation;
+}
+
+const GravitationalModel& CentralBodyGravity::accessGravitationalModelAt(const double& aRadius) const
+{
+    if (truncationLevels_.isEmpty())
+    {
+        return *celestialObjectSPtr_->accessGravitationalModel();
+    }
+
+    return *truncationLevels_[this->getTruncationLevelIndexAt(aRadius)].gravitationalModelSPtr;
+}
+
+Index CentralBodyGravity::getTruncationLevelIndexAt(const double& aRadius) const
+{
+    // Levels are sorted by increasing degree, hence decreasing minimum radius, and the last one is the full model
+    Index index = 0;
+
+    while (aRadius < truncationLevels_[index].minimumRadius)
+    {
+        ++index;
+    }
+
+    return index;
 }
 
 void CentralBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator) const
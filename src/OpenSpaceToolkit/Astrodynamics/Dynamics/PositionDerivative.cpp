@@ -60,6 +60,54 @@ VectorXd PositionDerivative::computeContribution(
     return contribution;
 }
 
+void PositionDerivative::computeContributionInPlace(
+    [[maybe_unused]] const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    [[maybe_unused]] TransformCache& aTransformCache
+) const
+{
+    aContribution = x.head<3>();
+}
+
+MatrixXd PositionDerivative::computeContributions(
+    const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd contributions(aStateMatrix.rows(), 3);
+    TransformCache transformCache;
+
+    this->computeContributionsInPlace(anInstant, aStateMatrix, aFrameSPtr, contributions, transformCache);
+
+    return contributions;
+}
+
+void PositionDerivative::computeContributionsInPlace(
+    [[maybe_unused]] const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix,
+    [[maybe_unused]] TransformCache& aTransformCache
+) const
+{
+    aContributionMatrix = aStateMatrix.leftCols(3);
+}
+
+bool PositionDerivative::hasContributionJacobian() const
+{
+    return true;
+}
+
+MatrixXd PositionDerivative::computeContributionJacobian(
+    [[maybe_unused]] const Instant& anInstant,
+    [[maybe_unused]] const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr
+) const
+{
+    return MatrixXd::Identity(3, 3);
+}
+
 void PositionDerivative::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Position Derivative Dynamics") : void();
@@ -1,8 +1,13 @@
 /// Apache License 2.0
 
+#include <cmath>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Model.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
@@ -16,13 +21,51 @@ namespace dynamics
 
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+using GravitationalModel = ostk::physics::environment::gravitational::Model;
 
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+namespace
+{
+
+// Point-mass attraction of a body centered at the given coordinates, plus a correction shared by all members
+void ComputePointMassContributions(
+    const MatrixXd& aStateMatrix,
+    const Vector3d& aCenterCoordinates,
+    const double& aGravitationalParameter_SI,
+    const Vector3d& aCorrectionSI,
+    MatrixXd& aContributionMatrix
+)
+{
+    for (Eigen::Index i = 0; i < aStateMatrix.rows(); ++i)
+    {
+        const double dx = aStateMatrix(i, 0) - aCenterCoordinates.x();
+        const double dy = aStateMatrix(i, 1) - aCenterCoordinates.y();
+        const double dz = aStateMatrix(i, 2) - aCenterCoordinates.z();
+
+        const double distanceSquared = dx * dx + dy * dy + dz * dz;
+        const double factor = -aGravitationalParameter_SI / (distanceSquared * std::sqrt(distanceSquared));
+
+        aContributionMatrix(i, 0) = dx * factor + aCorrectionSI.x();
+        aContributionMatrix(i, 1) = dy * factor + aCorrectionSI.y();
+        aContributionMatrix(i, 2) = dz * factor + aCorrectionSI.z();
+    }
+}
+
+}  // namespace
+
 ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr)
     : ThirdBodyGravity(aCelestialObjectSPtr, String::Format("Third Body Gravity [{}]", aCelestialObjectSPtr->getName()))
 {
@@ -30,7 +73,9 @@ ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObje
 
 ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr, const String& aName)
     : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      ephemerisSPtr_(nullptr),
+      gravitationalParameterSI_(0.0)
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->gravitationalModelIsDefined())
     {
@@ -44,6 +89,36 @@ ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObje
     }
 }
 
+ThirdBodyGravity::ThirdBodyGravity(
+    const Shared<const Celestial>& aCelestialObjectSPtr, const Shared<const ChebyshevEphemeris>& anEphemerisSPtr
+)
+    : ThirdBodyGravity(aCelestialObjectSPtr)
+{
+    if ((anEphemerisSPtr == nullptr) || (!anEphemerisSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    if (anEphemerisSPtr->accessCelestial()->getName() != celestialObjectSPtr_->getName())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Ephemeris of [{}] cannot be used for [{}].",
+            anEphemerisSPtr->accessCelestial()->getName(),
+            celestialObjectSPtr_->getName()
+        );
+    }
+
+    const GravitationalModel::Parameters parameters = celestialObjectSPtr_->accessGravitationalModel()->getParameters();
+
+    if ((parameters.J2_ != 0.0) || (parameters.J4_ != 0.0))
+    {
+        throw ostk::core::error::RuntimeError("Chebyshev ephemeris requires a point-mass gravitational model.");
+    }
+
+    ephemerisSPtr_ = anEphemerisSPtr;
+    gravitationalParameterSI_ = parameters.gravitationalParameter_.in(GravitationalParameterSIUnit);
+}
+
 ThirdBodyGravity::~ThirdBodyGravity() {}
 
 std::ostream& operator<<(std::ostream& anOutputStream, const ThirdBodyGravity& aThirdBodyGravity)
@@ -68,6 +143,11 @@ Shared<const Celestial> ThirdBodyGravity::getCelestial() const
     return celestialObjectSPtr_;
 }
 
+Shared<const ChebyshevEphemeris> ThirdBodyGravity::getEphemeris() const
+{
+    return ephemerisSPtr_;
+}
+
 Array<Shared<const CoordinateSubset>> ThirdBodyGravity::getReadCoordinateSubsets() const
 {
     return {
@@ -86,25 +166,206 @@ VectorXd ThirdBodyGravity::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
 {
-    // Obtain 3rd body effect on center of Central Body (origin in GCRF) aka 3rd body correction
+    VectorXd contribution(3);
+    TransformCache transformCache;
+
+    this->computeContributionInPlace(anInstant, x, aFrameSPtr, contribution, transformCache);
+
+    return contribution;
+}
+
+void ThirdBodyGravity::computeContributionInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<VectorXd> aContribution,
+    TransformCache& aTransformCache
+) const
+{
+    if (this->ephemerisCovers(anInstant, aFrameSPtr))
+    {
+        const Vector3d bodyPosition = ephemerisSPtr_->computePositionAt(anInstant);
+        const Vector3d relativePosition = x.head<3>() - bodyPosition;
+
+        const double distance = relativePosition.norm();
+        const double bodyDistance = bodyPosition.norm();
+
+        // Direct attraction on the spacecraft, minus the attraction on the center of the frame
+        aContribution = -gravitationalParameterSI_ * (relativePosition / (distance * distance * distance) +
+                                                      bodyPosition / (bodyDistance * bodyDistance * bodyDistance));
+
+        return;
+    }
+
+    const Transform transform =
+        aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+    const Shared<const GravitationalModel> gravitationalModelSPtr = celestialObjectSPtr_->accessGravitationalModel();
+
+    // Obtain 3rd body effect on center of Central Body (origin in GCRF) aka 3rd body correction, and 3rd body effect
+    // on the spacecraft, in the celestial frame
     // TBI: This fails for the earth as we cannot calculate the acceleration at the origin of the GCRF
-    Vector3d gravitationalAccelerationSI =
-        -celestialObjectSPtr_->getGravitationalFieldAt(Position::Meters({0.0, 0.0, 0.0}, aFrameSPtr), anInstant)
-             .inFrame(aFrameSPtr, anInstant)
-             .getValue();
+    const Vector3d gravitationalAccelerationSI =
+        gravitationalModelSPtr->getFieldValueAt(transform.applyToPosition(x.head<3>()), anInstant) -
+        gravitationalModelSPtr->getFieldValueAt(transform.applyToPosition(Vector3d::Zero()), anInstant);
 
-    Vector3d positionCoordinates = Vector3d(x[0], x[1], x[2]);
+    // Rotate it back to the given frame
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        aContribution[k] = transform.applyToVector(Vector3d::Unit(k)).dot(gravitationalAccelerationSI);
+    }
+}
 
-    gravitationalAccelerationSI +=
-        celestialObjectSPtr_->getGravitationalFieldAt(Position::Meters(positionCoordinates, aFrameSPtr), anInstant)
-            .inFrame(aFrameSPtr, anInstant)
-            .getValue();
+MatrixXd ThirdBodyGravity::computeContributions(
+    const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd contributions(aStateMatrix.rows(), 3);
+    TransformCache transformCache;
 
-    // Compute contribution
-    VectorXd contribution(3);
-    contribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
+    this->computeContributionsInPlace(anInstant, aStateMatrix, aFrameSPtr, contributions, transformCache);
 
-    return contribution;
+    return contributions;
+}
+
+void ThirdBodyGravity::computeContributionsInPlace(
+    const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix,
+    TransformCache& aTransformCache
+) const
+{
+    if (this->ephemerisCovers(anInstant, aFrameSPtr))
+    {
+        const Vector3d bodyPosition = ephemerisSPtr_->computePositionAt(anInstant);
+        const double bodyDistance = bodyPosition.norm();
+
+        ComputePointMassContributions(
+            aStateMatrix,
+            bodyPosition,
+            gravitationalParameterSI_,
+            -gravitationalParameterSI_ * bodyPosition / (bodyDistance * bodyDistance * bodyDistance),
+            aContributionMatrix
+        );
+
+        return;
+    }
+
+    // Affine map from the given frame to the celestial frame, shared by all members
+    const Transform transform =
+        aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+    Matrix3d rotation;
+
+    for (Eigen::Index k = 0; k < 3; ++k)
+    {
+        rotation.col(k) = transform.applyToVector(Vector3d::Unit(k));
+    }
+
+    const Vector3d translation = transform.applyToPosition(Vector3d::Zero());
+
+    const Shared<const GravitationalModel> gravitationalModelSPtr = celestialObjectSPtr_->accessGravitationalModel();
+    const GravitationalModel::Parameters parameters = gravitationalModelSPtr->getParameters();
+
+    // 3rd body correction, shared by all members: the opposite of the attraction on the center of the given frame
+    const Vector3d correctionSI =
+        -rotation.transpose() * gravitationalModelSPtr->getFieldValueAt(translation, anInstant);
+
+    // A model without zonal terms is a point mass, evaluated in the given frame
+    if ((parameters.J2_ == 0.0) && (parameters.J4_ == 0.0))
+    {
+        ComputePointMassContributions(
+            aStateMatrix,
+            -rotation.transpose() * translation,
+            parameters.gravitationalParameter_.in(GravitationalParameterSIUnit),
+            correctionSI,
+            aContributionMatrix
+        );
+
+        return;
+    }
+
+    for (Eigen::Index i = 0; i < aStateMatrix.rows(); ++i)
+    {
+        const Vector3d positionCoordinates = rotation * aStateMatrix.block<1, 3>(i, 0).transpose() + translation;
+
+        // Rotate the acceleration back to the given frame
+        aContributionMatrix.row(i) =
+            (rotation.transpose() * gravitationalModelSPtr->getFieldValueAt(positionCoordinates, anInstant) +
+             correctionSI)
+                .transpose();
+    }
+}
+
+bool ThirdBodyGravity::hasContributionJacobian() const
+{
+    return true;
+}
+
+MatrixXd ThirdBodyGravity::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    MatrixXd jacobian(3, 3);
+    TransformCache transformCache;
+
+    this->computeContributionJacobianInPlace(anInstant, x, aFrameSPtr, jacobian, transformCache);
+
+    return jacobian;
+}
+
+void ThirdBodyGravity::computeContributionJacobianInPlace(
+    const Instant& anInstant,
+    const Eigen::Ref<const VectorXd>& x,
+    const Shared<const Frame>& aFrameSPtr,
+    Eigen::Ref<MatrixXd> aJacobian,
+    TransformCache& aTransformCache
+) const
+{
+    Vector3d centerCoordinates;
+    double gravitationalParameter_SI;
+
+    if (this->ephemerisCovers(anInstant, aFrameSPtr))
+    {
+        centerCoordinates = ephemerisSPtr_->computePositionAt(anInstant);
+        gravitationalParameter_SI = gravitationalParameterSI_;
+    }
+    else
+    {
+        const Transform transform =
+            aTransformCache.getTransform(aFrameSPtr, celestialObjectSPtr_->accessFrame(), anInstant);
+
+        Matrix3d rotation;
+
+        for (Eigen::Index k = 0; k < 3; ++k)
+        {
+            rotation.col(k) = transform.applyToVector(Vector3d::Unit(k));
+        }
+
+        centerCoordinates = -rotation.transpose() * transform.applyToPosition(Vector3d::Zero());
+        gravitationalParameter_SI = celestialObjectSPtr_->accessGravitationalModel()
+                                        ->getParameters()
+                                        .gravitationalParameter_.in(GravitationalParameterSIUnit);
+    }
+
+    const Vector3d relativePosition = x.head<3>() - centerCoordinates;
+    const double distanceSquared = relativePosition.squaredNorm();
+    const double distance = std::sqrt(distanceSquared);
+
+    // -μ/d³ (I - 3 d dᵀ / d²), the third body correction does not depend on the state
+    aJacobian = (-gravitationalParameter_SI / (distanceSquared * distance)) *
+                (Matrix3d::Identity() - (3.0 / distanceSquared) * (relativePosition * relativePosition.transpose()));
+}
+
+bool ThirdBodyGravity::ephemerisCovers(const Instant& anInstant, const Shared<const Frame>& aFrameSPtr) const
+{
+    if ((ephemerisSPtr_ == nullptr) || (!ephemerisSPtr_->contains(anInstant)))
+    {
+        return false;
+    }
+
+    return (aFrameSPtr == ephemerisSPtr_->accessFrame()) || (*aFrameSPtr == *ephemerisSPtr_->accessFrame());
 }
 
 void ThirdBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -0,0 +1,235 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity/ChebyshevEphemeris.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace dynamics
+{
+namespace thirdbodygravity
+{
+
+using ostk::core::type::Index;
+
+using ostk::physics::time::Duration;
+
+// Segments are not bisected below this duration, the fit fails instead
+static const double MinimumSegmentDuration = 1.0;  // s
+
+ChebyshevEphemeris::ChebyshevEphemeris(
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Interval& anInterval,
+    const Length& aTolerance,
+    const Shared<const Frame>& aFrameSPtr,
+    const Size& aDegree
+)
+    : celestialSPtr_(aCelestialSPtr),
+      interval_(anInterval),
+      tolerance_(aTolerance),
+      frameSPtr_(aFrameSPtr),
+      degree_(aDegree),
+      segments_(Array<Segment>::Empty())
+{
+    if ((celestialSPtr_ == nullptr) || (!celestialSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial");
+    }
+
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if ((frameSPtr_ == nullptr) || (!frameSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!tolerance_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (tolerance_.inMeters() <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (degree_ < 1)
+    {
+        throw ostk::core::error::runtime::Wrong("Degree");
+    }
+
+    this->fitSegment(0.0, interval_.getDuration().inSeconds());
+}
+
+bool ChebyshevEphemeris::isDefined() const
+{
+    return !segments_.isEmpty();
+}
+
+bool ChebyshevEphemeris::contains(const Instant& anInstant) const
+{
+    return anInstant.isDefined() && interval_.contains(anInstant);
+}
+
+const Shared<const Celestial>& ChebyshevEphemeris::accessCelestial() const
+{
+    return celestialSPtr_;
+}
+
+const Interval& ChebyshevEphemeris::accessInterval() const
+{
+    return interval_;
+}
+
+const Shared<const Frame>& ChebyshevEphemeris::accessFrame() const
+{
+    return frameSPtr_;
+}
+
+Length ChebyshevEphemeris::getTolerance() const
+{
+    return tolerance_;
+}
+
+Size ChebyshevEphemeris::getDegree() const
+{
+    return degree_;
+}
+
+Size ChebyshevEphemeris::getSegmentCount() const
+{
+    return segments_.getSize();
+}
+
+Vector3d ChebyshevEphemeris::computePositionAt(const Instant& anInstant) const
+{
+    if (!this->contains(anInstant))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of the ephemeris interval [{}].", anInstant.toString(), interval_.toString()
+        );
+    }
+
+    const double time = (anInstant - interval_.accessStart()).inSeconds();
+
+    // Last segment starting at or before the given time
+    const auto segmentIt = std::upper_bound(
+        segments_.begin(),
+        segments_.end(),
+        time,
+        [](const double& aTime, const Segment& aSegment) -> bool
+        {
+            return aTime < aSegment.startTime;
+        }
+    );
+
+    return ChebyshevEphemeris::EvaluateSegment(
+        (segmentIt == segments_.begin()) ? segments_.accessFirst() : *(segmentIt - 1), time
+    );
+}
+
+void ChebyshevEphemeris::fitSegment(const double& aStartTime, const double& anEndTime)
+{
+    const Size nodeCount = degree_ + 1;
+
+    const double midTime = 0.5 * (aStartTime + anEndTime);
+    const double halfDuration = 0.5 * (anEndTime - aStartTime);
+
+    // Sample the position at the Chebyshev nodes (roots of the polynomial of degree + 1)
+    MatrixXd nodePositions(3, nodeCount);
+
+    for (Index k = 0; k < nodeCount; ++k)
+    {
+        nodePositions.col(k) =
+            this->samplePositionAt(midTime + halfDuration * std::cos(M_PI * (k + 0.5) / double(nodeCount)));
+    }
+
+    Segment segment = {aStartTime, anEndTime, MatrixXd::Zero(3, nodeCount)};
+
+    for (Index j = 0; j < nodeCount; ++j)
+    {
+        for (Index k = 0; k < nodeCount; ++k)
+        {
+            segment.coefficients.col(j) += nodePositions.col(k) * std::cos(M_PI * j * (k + 0.5) / double(nodeCount));
+        }
+    }
+
+    segment.coefficients *= 2.0 / double(nodeCount);
+    segment.coefficients.col(0) *= 0.5;
+
+    // Check the fit at the extrema of the polynomial of degree + 1, which lie between the nodes and include both
+    // segment bounds
+    double maximumError = 0.0;
+
+    for (Index k = 0; k <= nodeCount; ++k)
+    {
+        const double time = midTime + halfDuration * std::cos(M_PI * k / double(nodeCount));
+
+        maximumError = std::max(
+            maximumError,
+            (ChebyshevEphemeris::EvaluateSegment(segment, time) - this->samplePositionAt(time)).norm()
+        );
+    }
+
+    if (maximumError <= tolerance_.inMeters())
+    {
+        segments_.add(segment);
+
+        return;
+    }
+
+    if ((anEndTime - aStartTime) < (2.0 * MinimumSegmentDuration))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot fit the ephemeris of [{}] within [{}].", celestialSPtr_->getName(), tolerance_.toString()
+        );
+    }
+
+    this->fitSegment(aStartTime, midTime);
+    this->fitSegment(midTime, anEndTime);
+}
+
+Vector3d ChebyshevEphemeris::samplePositionAt(const double& aTime) const
+{
+    return celestialSPtr_->getPositionIn(frameSPtr_, interval_.accessStart() + Duration::Seconds(aTime))
+        .inMeters()
+        .getCoordinates();
+}
+
+Vector3d ChebyshevEphemeris::EvaluateSegment(const Segment& aSegment, const double& aTime)
+{
+    const double duration = aSegment.endTime - aSegment.startTime;
+
+    const double tau = (duration > 0.0)
+                       ? std::clamp((2.0 * aTime - aSegment.startTime - aSegment.endTime) / duration, -1.0, 1.0)
+                       : 0.0;
+
+    // Clenshaw recurrence
+    Vector3d b1 = Vector3d::Zero();
+    Vector3d b2 = Vector3d::Zero();
+
+    for (Eigen::Index j = aSegment.coefficients.cols() - 1; j >= 1; --j)
+    {
+        const Vector3d b0 = 2.0 * tau * b1 - b2 + aSegment.coefficients.col(j);
+        b2 = b1;
+        b1 = b0;
+    }
+
+    return tau * b1 - b2 + aSegment.coefficients.col(0);
+}
+
+}  // namespace thirdbodygravity
+}  // namespace dynamics
+}  // namespace astrodynamics
+}  // namespace ostk
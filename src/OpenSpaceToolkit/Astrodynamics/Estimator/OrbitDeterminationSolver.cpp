@@ -1,11 +1,14 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Estimator/OrbitDeterminationSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
 
 namespace ostk
@@ -15,10 +18,77 @@ namespace astrodynamics
 namespace estimator
 {
 
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+
 using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::Propagated;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::StateBuilder;
 
+namespace
+{
+
+// Map a state transition matrix over the coordinates of a broker onto the given row and column subsets, subsets
+// missing from the broker not being propagated (hence constant)
+MatrixXd MapStateTransitionMatrix(
+    const MatrixXd& aStateTransitionMatrix,
+    const CoordinateBroker& aCoordinateBroker,
+    const Array<Shared<const CoordinateSubset>>& aRowSubsets,
+    const Array<Shared<const CoordinateSubset>>& aColumnSubsets
+)
+{
+    Size rowCount = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : aRowSubsets)
+    {
+        rowCount += subset->getSize();
+    }
+
+    Size columnCount = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : aColumnSubsets)
+    {
+        columnCount += subset->getSize();
+    }
+
+    MatrixXd stateTransitionMatrix = MatrixXd::Zero(rowCount, columnCount);
+
+    Index rowIndex = 0;
+
+    for (const Shared<const CoordinateSubset>& rowSubset : aRowSubsets)
+    {
+        Index columnIndex = 0;
+
+        for (const Shared<const CoordinateSubset>& columnSubset : aColumnSubsets)
+        {
+            if (aCoordinateBroker.hasSubset(rowSubset) && aCoordinateBroker.hasSubset(columnSubset))
+            {
+                stateTransitionMatrix.block(rowIndex, columnIndex, rowSubset->getSize(), columnSubset->getSize()) =
+                    aStateTransitionMatrix.block(
+                        aCoordinateBroker.getSubsetIndex(rowSubset),
+                        aCoordinateBroker.getSubsetIndex(columnSubset),
+                        rowSubset->getSize(),
+                        columnSubset->getSize()
+                    );
+            }
+            else if ((*rowSubset) == (*columnSubset))
+            {
+                stateTransitionMatrix.block(rowIndex, columnIndex, rowSubset->getSize(), columnSubset->getSize())
+                    .setIdentity();
+            }
+
+            columnIndex += columnSubset->getSize();
+        }
+
+        rowIndex += rowSubset->getSize();
+    }
+
+    return stateTransitionMatrix;
+}
+
+}  // namespace
+
 OrbitDeterminationSolver::Analysis::Analysis(
     const State& anEstimatedState, const LeastSquaresSolver::Analysis& anAnalysis
 )
@@ -51,12 +121,14 @@ OrbitDeterminationSolver::OrbitDeterminationSolver(
     const Environment& anEnvironment,
     const NumericalSolver& aNumericalSolver,
     const LeastSquaresSolver& aSolver,
-    const Shared<const Frame>& anEstimationFrameSPtr
+    const Shared<const Frame>& anEstimationFrameSPtr,
+    const bool& isStateTransitionMatrixPropagated
 )
     : environment_(anEnvironment),
       propagator_(Propagator::FromEnvironment(aNumericalSolver, anEnvironment)),
       solver_(aSolver),
-      estimationFrameSPtr_(anEstimationFrameSPtr)
+      estimationFrameSPtr_(anEstimationFrameSPtr),
+      stateTransitionMatrixIsPropagated_(isStateTransitionMatrixPropagated)
 {
     if (!environment_.hasCentralCelestialObject())
     {
@@ -84,6 +156,11 @@ const Shared<const Frame>& OrbitDeterminationSolver::accessEstimationFrame() con
     return estimationFrameSPtr_;
 }
 
+bool OrbitDeterminationSolver::isStateTransitionMatrixPropagated() const
+{
+    return stateTransitionMatrixIsPropagated_;
+}
+
 OrbitDeterminationSolver::Analysis OrbitDeterminationSolver::estimate(
     const State& anInitialGuessState,
     const Array<State>& anObservationStateArray,
@@ -131,12 +208,46 @@ OrbitDeterminationSolver::Analysis OrbitDeterminationSolver::estimate(
         return propagator_.calculateStatesAt(propagatorState, anInstantArray);
     };
 
+    // The state transition matrices of the propagator are expressed in its integration frame
+    const bool useStateTransitionMatrices = stateTransitionMatrixIsPropagated_ &&
+                                            propagator_.canCalculateStateTransitionMatrices() &&
+                                            ((*estimationFrameSPtr_) == (*Propagator::IntegrationFrameSPtr));
+
+    const auto stateTransitionMatrixGenerator =
+        [&](const State& aState, const Array<Instant>& anInstantArray) -> Pair<Array<State>, Array<MatrixXd>>
+    {
+        const State propagatorState = propagationStateBuilder.expand(aState, initialGuessStateInEstimationFrame);
+
+        const Pair<Array<State>, Array<MatrixXd>> statesAndStateTransitionMatrices =
+            propagator_.calculateStatesAndStateTransitionMatricesAt(propagatorState, anInstantArray);
+
+        const Array<Shared<const CoordinateSubset>> propagatorStateSubsets = propagatorState.getCoordinateSubsets();
+        const Array<Shared<const CoordinateSubset>> stateSubsets = aState.getCoordinateSubsets();
+
+        return {
+            statesAndStateTransitionMatrices.first,
+            statesAndStateTransitionMatrices.second.map<MatrixXd>(
+                [&](const MatrixXd& aStateTransitionMatrix) -> MatrixXd
+                {
+                    return MapStateTransitionMatrix(
+                        aStateTransitionMatrix,
+                        *propagator_.accessCoordinateBroker(),
+                        propagatorStateSubsets,
+                        stateSubsets
+                    );
+                }
+            ),
+        };
+    };
+
     LeastSquaresSolver::Analysis analysis = solver_.solve(
         estimationStateBuilder.reduce(initialGuessStateInEstimationFrame),
         observationStatesInEstimationFrame,
         stateGenerator,
         anInitialGuessSigmas,
-        anObservationSigmas
+        anObservationSigmas,
+        useStateTransitionMatrices ? LeastSquaresSolver::StateTransitionMatrixGenerator(stateTransitionMatrixGenerator)
+                                   : nullptr
     );
 
     const State estimatedState =
@@ -22,6 +22,58 @@ using ostk::core::type::Shared;
 
 using ostk::physics::coordinate::Frame;
 
+namespace
+{
+
+// Rows of the given subsets, out of a matrix whose rows follow the coordinates of a state with the given state subsets
+MatrixXd ExtractSubsetRows(
+    const MatrixXd& aMatrix,
+    const Array<Shared<const CoordinateSubset>>& aStateSubsets,
+    const Array<Shared<const CoordinateSubset>>& aSubsets
+)
+{
+    Size rowCount = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : aSubsets)
+    {
+        rowCount += subset->getSize();
+    }
+
+    MatrixXd rows(rowCount, aMatrix.cols());
+    Size currentRowIndex = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : aSubsets)
+    {
+        Size stateRowIndex = 0;
+        bool isFound = false;
+
+        for (const Shared<const CoordinateSubset>& stateSubset : aStateSubsets)
+        {
+            if (*stateSubset == *subset)
+            {
+                isFound = true;
+                break;
+            }
+
+            stateRowIndex += stateSubset->getSize();
+        }
+
+        if (!isFound)
+        {
+            throw ostk::core::error::RuntimeError(
+                "Generated states do not contain the observation Coordinate Subset [{}].", subset->getName()
+            );
+        }
+
+        rows.middleRows(currentRowIndex, subset->getSize()) = aMatrix.middleRows(stateRowIndex, subset->getSize());
+        currentRowIndex += subset->getSize();
+    }
+
+    return rows;
+}
+
+}  // namespace
+
 LeastSquaresSolver::Step::Step(const Real& aRmsError, const VectorXd& anXHat)
     : rmsError(aRmsError),
       xHat(anXHat)
@@ -191,7 +243,8 @@ LeastSquaresSolver::Analysis LeastSquaresSolver::solve(
     const Array<State>& anObservationStateArray,
     const std::function<Array<State>(const State&, const Array<Instant>&)>& aStateGenerator,
     const std::unordered_map<CoordinateSubset, VectorXd>& anInitialGuessSigmas,
-    const std::unordered_map<CoordinateSubset, VectorXd>& anObservationSigmas
+    const std::unordered_map<CoordinateSubset, VectorXd>& anObservationSigmas,
+    const StateTransitionMatrixGenerator& aStateTransitionMatrixGenerator
 ) const
 {
     // Notation used: https://www.sciencedirect.com/book/9780126836301/statistical-orbit-determination (Chapter 4, pg
@@ -237,6 +290,18 @@ LeastSquaresSolver::Analysis LeastSquaresSolver::solve(
         return aStateGenerator(denormalizedState, anInstantArray);
     };
 
+    // Wrap state transition matrix generator to denormalize before calling the original
+    const StateTransitionMatrixGenerator denormalizedStateTransitionMatrixGenerator =
+        [&aStateTransitionMatrixGenerator, &initialGuessStateBuilder, &scaleFactors](
+            const State& aNormalizedState, const Array<Instant>& anInstantArray
+        ) -> Pair<Array<State>, Array<MatrixXd>>
+    {
+        const VectorXd denormalizedCoords = aNormalizedState.getCoordinates().cwiseProduct(scaleFactors);
+        const State denormalizedState =
+            initialGuessStateBuilder.build(aNormalizedState.getInstant(), denormalizedCoords);
+        return aStateTransitionMatrixGenerator(denormalizedState, anInstantArray);
+    };
+
     // Setup state builders
     const Instant estimatedStateInstant = normalizedInitialGuess.getInstant();
     const StateBuilder estimationStateBuilder(normalizedInitialGuess);
@@ -357,19 +422,63 @@ LeastSquaresSolver::Analysis LeastSquaresSolver::solve(
 
         currentEstimatedState = estimationStateBuilder.build(estimatedStateInstant, XNom);
 
-        // G(X∗ᵢ) (computed observations) for all observation instants
-        computedObservationCoordinates = computeObservationsCoordinates(currentEstimatedState, observationInstants);
+        // H(t,t₀) = ∂G(X∗)/∂X∗₀ (sensitivty matrix for all observations at tᵢ w.r.t. nominal trajectory at estimated
+        // state instant t₀)
+        Array<MatrixXd> HFull = Array<MatrixXd>::Empty();
+
+        if (aStateTransitionMatrixGenerator)
+        {
+            // G(X∗ᵢ) and Φ(tᵢ,t₀), from a single propagation of the variational equations
+            const Pair<Array<State>, Array<MatrixXd>> statesAndStateTransitionMatrices =
+                denormalizedStateTransitionMatrixGenerator(currentEstimatedState, observationInstants);
+
+            const Array<State>& states = statesAndStateTransitionMatrices.first;
+            const Array<MatrixXd>& stateTransitionMatrices = statesAndStateTransitionMatrices.second;
+
+            if ((states.getSize() != observationCount) || (stateTransitionMatrices.getSize() != observationCount))
+            {
+                throw ostk::core::error::RuntimeError(
+                    "State transition matrix generator must return one state and one matrix per observation."
+                );
+            }
+
+            HFull.reserve(observationCount);
+
+            for (Size i = 0; i < observationCount; ++i)
+            {
+                if ((*states[i].accessFrame()) != (*estimationStateFrame))
+                {
+                    throw ostk::core::error::RuntimeError(
+                        "Generated states must be in the same frame as the initial guess state."
+                    );
+                }
+
+                computedObservationCoordinates.col(i) = states[i].extractCoordinates(observationStateSubsets);
+
+                // Hᵢ = ∂G(X∗ᵢ)/∂X∗₀ S, as the estimated coordinates are normalized
+                HFull.add(
+                    ExtractSubsetRows(
+                        stateTransitionMatrices[i], states[i].getCoordinateSubsets(), observationStateSubsets
+                    ) *
+                    scaleFactors.asDiagonal()
+                );
+            }
+        }
+        else
+        {
+            // G(X∗ᵢ) (computed observations) for all observation instants
+            computedObservationCoordinates =
+                computeObservationsCoordinates(currentEstimatedState, observationInstants);
+
+            HFull = finiteDifferenceSolver_.computeStateTransitionMatrix(
+                currentEstimatedState, observationInstants, computeObservationsCoordinates
+            );
+        }
 
         // Compute residuals
         // y = Y - G(X∗) (observed - computed)
         residualCoordinates = observationCoordinates - computedObservationCoordinates;
 
-        // H(t,t₀) = ∂G(X∗)/∂X∗₀ (sensitivty matrix for all observations at tᵢ w.r.t. nominal trajectory at estimated
-        // state instant t₀)
-        const Array<MatrixXd> HFull = finiteDifferenceSolver_.computeStateTransitionMatrix(
-            currentEstimatedState, observationInstants, computeObservationsCoordinates
-        );
-
         // Loop through each observation
         for (Size i = 0; i < observationCount; ++i)
         {
@@ -49,6 +49,15 @@ Array<Interval> TemporalConditionSolver::solve(
 Array<Interval> TemporalConditionSolver::solve(
     const Array<TemporalConditionSolver::Condition>& aConditionArray, const Interval& anInterval
 ) const
+{
+    return this->solve(aConditionArray, anInterval, {});
+}
+
+Array<Interval> TemporalConditionSolver::solve(
+    const Array<TemporalConditionSolver::Condition>& aConditionArray,
+    const Interval& anInterval,
+    const std::function<void(const Size&)>& aSwitchingCallback
+) const
 {
     if (!anInterval.isDefined())
     {
@@ -84,8 +93,15 @@ Array<Interval> TemporalConditionSolver::solve(
 
             if (conditionIsSwitching)
             {
+                Size iterationCount = 0;
+
                 const Instant switchingInstant =
-                    this->findSwitchingInstant(previousInstantCache, instant, aConditionArray);
+                    this->findSwitchingInstant(previousInstantCache, instant, aConditionArray, iterationCount);
+
+                if (aSwitchingCallback)
+                {
+                    aSwitchingCallback(iterationCount);
+                }
 
                 if (conditionIsMet)
                 {
@@ -116,7 +132,8 @@ Array<Interval> TemporalConditionSolver::solve(
 Instant TemporalConditionSolver::findSwitchingInstant(
     const Instant& aPreviousInstant,
     const Instant& aNextInstant,
-    const Array<TemporalConditionSolver::Condition>& aConditionArray
+    const Array<TemporalConditionSolver::Condition>& aConditionArray,
+    Size& anIterationCount
 ) const
 {
     const RootSolver rootSolver = RootSolver(this->maximumIterationCount_, this->tolerance_.inSeconds());
@@ -134,6 +151,8 @@ Instant TemporalConditionSolver::findSwitchingInstant(
         Duration::Between(aPreviousInstant, aNextInstant).inSeconds()
     );
 
+    anIterationCount = result.iterationCount;
+
     return aPreviousInstant + Duration::Seconds(result.root);
 }
 
@@ -51,7 +51,8 @@ Propagated::Propagated(const Propagator& aPropagator, const State& aState, const
     : Model(),
       propagator_(aPropagator),
       cachedStateArray_(1, aState),
-      initialRevolutionNumber_(aRevolutionNumber)
+      initialRevolutionNumber_(aRevolutionNumber),
+      checkpointStoreSPtr_(nullptr)
 {
 }
 
@@ -61,7 +62,8 @@ Propagated::Propagated(
     : Model(),
       propagator_(aPropagator),
       cachedStateArray_(aCachedStateArray),
-      initialRevolutionNumber_(aRevolutionNumber)
+      initialRevolutionNumber_(aRevolutionNumber),
+      checkpointStoreSPtr_(nullptr)
 {
     sanitizeCachedArray();
 }
@@ -171,6 +173,27 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         }
     }
 
+    if (checkpointStoreSPtr_ != nullptr)
+    {
+        const CheckpointStore::PropagationFunction propagationFunction =
+            [this](const Array<Instant>& aNodeInstantArray, const State& aBoundaryState) -> Array<State>
+        {
+            return this->propagateCheckpointNodesAt(aNodeInstantArray, aBoundaryState);
+        };
+
+        return anInstantArray.map<State>(
+            [this, &propagationFunction](const Instant& anInstant) -> State
+            {
+                return checkpointStoreSPtr_->calculateStateAt(anInstant, propagationFunction);
+            }
+        );
+    }
+
+    return this->propagateStatesAt(propagator_, anInstantArray);
+}
+
+Array<State> Propagated::propagateStatesAt(const Propagator& aPropagator, const Array<Instant>& anInstantArray) const
+{
     // Builder for output states based on cached array
     StateBuilder outputStateBuilder = {this->cachedStateArray_.accessFirst()};
 
@@ -193,7 +216,7 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         instants.add(anInstantArray[j]);
     }
 
-    allStates.add(propagator_.calculateStatesAt(this->cachedStateArray_.accessFirst(), instants));
+    allStates.add(aPropagator.calculateStatesAt(this->cachedStateArray_.accessFirst(), instants));
 
     // Propagate all instants between states
 
@@ -225,10 +248,10 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         }
 
         // Forward propagation
-        Array<State> forwardStates = propagator_.calculateStatesAt(this->cachedStateArray_[i], instants);
+        Array<State> forwardStates = aPropagator.calculateStatesAt(this->cachedStateArray_[i], instants);
 
         // Backward propagation
-        Array<State> backwardStates = propagator_.calculateStatesAt(this->cachedStateArray_[i + 1], instants);
+        Array<State> backwardStates = aPropagator.calculateStatesAt(this->cachedStateArray_[i + 1], instants);
 
         Real durationBetweenStates = (nextStateInstant - thisStateInstant).inSeconds();
 
@@ -262,7 +285,7 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         instants.add(anInstantArray[j]);
     }
 
-    allStates.add(propagator_.calculateStatesAt(this->cachedStateArray_.accessLast(), instants));
+    allStates.add(aPropagator.calculateStatesAt(this->cachedStateArray_.accessLast(), instants));
 
     return allStates;
 }
@@ -356,6 +379,50 @@ void Propagated::setCachedStateArray(const Array<State>& aStateArray)
     this->cachedStateArray_ = aStateArray;
 
     sanitizeCachedArray();
+
+    // Stored segments were propagated from the previous cached states, start over with the same settings. A new store
+    // is created rather than cleared, as copies of this model may share the current one.
+    if (checkpointStoreSPtr_ != nullptr)
+    {
+        this->enableCheckpointing(
+            checkpointStoreSPtr_->getSegmentDuration(),
+            checkpointStoreSPtr_->getMemoryBudget(),
+            checkpointStoreSPtr_->getEvictionPolicy()
+        );
+    }
+}
+
+void Propagated::enableCheckpointing(
+    const Duration& aSegmentDuration, const Size& aMemoryBudget, const CheckpointStore::EvictionPolicy& anEvictionPolicy
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagated");
+    }
+
+    this->checkpointStoreSPtr_ =
+        std::make_shared<CheckpointStore>(this->getEpoch(), aSegmentDuration, aMemoryBudget, anEvictionPolicy);
+}
+
+void Propagated::disableCheckpointing()
+{
+    this->checkpointStoreSPtr_ = nullptr;
+}
+
+bool Propagated::isCheckpointingEnabled() const
+{
+    return checkpointStoreSPtr_ != nullptr;
+}
+
+const CheckpointStore& Propagated::accessCheckpointStore() const
+{
+    if (checkpointStoreSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Checkpoint store");
+    }
+
+    return *checkpointStoreSPtr_;
 }
 
 void Propagated::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -435,6 +502,36 @@ void Propagated::sanitizeCachedArray() const
     }
 }
 
+Array<State> Propagated::propagateCheckpointNodesAt(
+    const Array<Instant>& anInstantArray, const State& aBoundaryState
+) const
+{
+    // Queries may run concurrently: each propagation works on its own copy of the propagator, so that the numerical
+    // solver of the model is never mutated
+    const Propagator propagator = propagator_;
+
+    if (aBoundaryState.isDefined())
+    {
+        const Instant& firstCachedInstant = this->cachedStateArray_.accessFirst().accessInstant();
+        const Instant& lastCachedInstant = this->cachedStateArray_.accessLast().accessInstant();
+        const Instant& boundaryInstant = aBoundaryState.accessInstant();
+
+        // Within the cached state array, the cached states remain the reference. Outside of it, the checkpoint on
+        // the segment bound is at least as close as the outermost cached state.
+        const bool isAfterCachedStates =
+            (anInstantArray.accessFirst() >= lastCachedInstant) && (boundaryInstant >= lastCachedInstant);
+        const bool isBeforeCachedStates =
+            (anInstantArray.accessLast() <= firstCachedInstant) && (boundaryInstant <= firstCachedInstant);
+
+        if (isAfterCachedStates || isBeforeCachedStates)
+        {
+            return propagator.calculateStatesAt(aBoundaryState, anInstantArray);
+        }
+    }
+
+    return this->propagateStatesAt(propagator, anInstantArray);
+}
+
 Tabulated Propagated::toTabulated(const Array<Instant>& anInstantArray) const
 {
     const Array<State> propagatedStates = this->calculateStatesAt(anInstantArray);
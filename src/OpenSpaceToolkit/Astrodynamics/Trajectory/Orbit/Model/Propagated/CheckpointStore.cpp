@@ -0,0 +1,510 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated/CheckpointStore.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace model
+{
+namespace propagated
+{
+
+using ostk::core::type::Index;
+
+using ostk::mathematics::object::VectorXd;
+
+namespace
+{
+
+// Bounds the propagation cost of a segment whose states cannot be interpolated within the tolerance
+constexpr Size MaximumPieceCount = 64;
+
+}  // namespace
+
+CheckpointStore::CheckpointStore(
+    const Instant& anEpoch,
+    const Duration& aSegmentDuration,
+    const Size& aMemoryBudget,
+    const EvictionPolicy& anEvictionPolicy,
+    const Size& aDegree,
+    const Real& aTolerance
+)
+    : epoch_(anEpoch),
+      segmentDuration_(aSegmentDuration),
+      memoryBudget_(aMemoryBudget),
+      evictionPolicy_(anEvictionPolicy),
+      degree_(aDegree),
+      tolerance_(aTolerance),
+      segments_(),
+      checkpoints_(),
+      recency_(),
+      memoryUsage_(0),
+      hitCount_(0),
+      missCount_(0)
+{
+    if (!epoch_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
+
+    if (!segmentDuration_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment duration");
+    }
+
+    if (segmentDuration_.inSeconds() <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Segment duration must be positive.");
+    }
+
+    if (memoryBudget_ == 0)
+    {
+        throw ostk::core::error::RuntimeError("Memory budget must be positive.");
+    }
+
+    if (degree_ < 1)
+    {
+        throw ostk::core::error::RuntimeError("Degree must be at least 1.");
+    }
+
+    if (!tolerance_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (tolerance_ <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Tolerance must be positive.");
+    }
+}
+
+const Instant& CheckpointStore::accessEpoch() const
+{
+    return epoch_;
+}
+
+Duration CheckpointStore::getSegmentDuration() const
+{
+    return segmentDuration_;
+}
+
+Size CheckpointStore::getMemoryBudget() const
+{
+    return memoryBudget_;
+}
+
+CheckpointStore::EvictionPolicy CheckpointStore::getEvictionPolicy() const
+{
+    return evictionPolicy_;
+}
+
+Size CheckpointStore::getDegree() const
+{
+    return degree_;
+}
+
+Real CheckpointStore::getTolerance() const
+{
+    return tolerance_;
+}
+
+Size CheckpointStore::getSegmentCount() const
+{
+    const std::lock_guard<std::mutex> lock {this->mutex_};
+
+    return segments_.size();
+}
+
+Size CheckpointStore::getMemoryUsage() const
+{
+    const std::lock_guard<std::mutex> lock {this->mutex_};
+
+    return memoryUsage_;
+}
+
+Size CheckpointStore::getHitCount() const
+{
+    const std::lock_guard<std::mutex> lock {this->mutex_};
+
+    return hitCount_;
+}
+
+Size CheckpointStore::getMissCount() const
+{
+    const std::lock_guard<std::mutex> lock {this->mutex_};
+
+    return missCount_;
+}
+
+State CheckpointStore::calculateStateAt(const Instant& anInstant, const PropagationFunction& aPropagationFunction)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Integer segmentIndex = this->getSegmentIndex(anInstant);
+
+    {
+        const std::lock_guard<std::mutex> lock {this->mutex_};
+
+        const auto segmentIt = segments_.find(segmentIndex);
+
+        if (segmentIt != segments_.end())
+        {
+            recency_.splice(recency_.begin(), recency_, segmentIt->second.recencyIt);
+            ++hitCount_;
+
+            return this->interpolate(segmentIt->second, segmentIndex, anInstant);
+        }
+
+        ++missCount_;
+    }
+
+    // Propagate without holding the lock, concurrent misses on the same segment both propagate the same states and
+    // the first one to finish is kept
+    const State checkpoint = this->getCheckpoint(segmentIndex, aPropagationFunction);
+
+    Segment segment = this->propagateSegment(segmentIndex, checkpoint, aPropagationFunction);
+
+    const State state = this->interpolate(segment, segmentIndex, anInstant);
+
+    {
+        const std::lock_guard<std::mutex> lock {this->mutex_};
+
+        this->store(segmentIndex, std::move(segment));
+    }
+
+    return state;
+}
+
+void CheckpointStore::clear()
+{
+    const std::lock_guard<std::mutex> lock {this->mutex_};
+
+    segments_.clear();
+    checkpoints_.clear();
+    recency_.clear();
+    memoryUsage_ = 0;
+    hitCount_ = 0;
+    missCount_ = 0;
+}
+
+String CheckpointStore::StringFromEvictionPolicy(const EvictionPolicy& anEvictionPolicy)
+{
+    switch (anEvictionPolicy)
+    {
+        case EvictionPolicy::LeastRecentlyUsed:
+            return "LeastRecentlyUsed";
+
+        case EvictionPolicy::Farthest:
+            return "Farthest";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Eviction policy");
+    }
+}
+
+Integer CheckpointStore::getSegmentIndex(const Instant& anInstant) const
+{
+    return static_cast<int>(std::floor((anInstant - epoch_).inSeconds() / segmentDuration_.inSeconds()));
+}
+
+Instant CheckpointStore::getSegmentStartInstant(const Integer& aSegmentIndex) const
+{
+    return epoch_ + Duration::Seconds(static_cast<int>(aSegmentIndex) * segmentDuration_.inSeconds());
+}
+
+Array<Instant> CheckpointStore::getNodeInstants(const Integer& aSegmentIndex, const Size& aPieceCount) const
+{
+    const Instant startInstant = this->getSegmentStartInstant(aSegmentIndex);
+    const double pieceDuration = segmentDuration_.inSeconds() / static_cast<double>(aPieceCount);
+
+    Array<Instant> nodeInstants = Array<Instant>::Empty();
+    nodeInstants.reserve((aPieceCount * degree_) + 1);
+
+    // Chebyshev-Lobatto nodes of each piece, in ascending order and including both bounds, which adjacent pieces share
+    for (Index pieceIndex = 0; pieceIndex < aPieceCount; ++pieceIndex)
+    {
+        const double pieceStart = pieceIndex * pieceDuration;
+
+        for (Index j = (pieceIndex == 0) ? 0 : 1; j <= degree_; ++j)
+        {
+            nodeInstants.add(
+                startInstant + Duration::Seconds(
+                                   pieceStart +
+                                   (0.5 * pieceDuration * (1.0 - std::cos(M_PI * j / static_cast<double>(degree_))))
+                               )
+            );
+        }
+    }
+
+    return nodeInstants;
+}
+
+State CheckpointStore::getCheckpoint(const Integer& aSegmentIndex, const PropagationFunction& aPropagationFunction)
+{
+    // Segments are propagated from their bound on the side of the epoch
+    const Integer boundIndex = (aSegmentIndex >= 0) ? aSegmentIndex : Integer(aSegmentIndex + 1);
+
+    if (boundIndex == 0)
+    {
+        return State::Undefined();
+    }
+
+    const bool isAfterEpoch = boundIndex > 0;
+
+    Integer currentBoundIndex = 0;
+    State checkpoint = State::Undefined();
+
+    {
+        const std::lock_guard<std::mutex> lock {this->mutex_};
+
+        // Checkpoints are derived outwards from the epoch, so the ones stored on each side of it are contiguous
+        if (isAfterEpoch)
+        {
+            auto checkpointIt = checkpoints_.upper_bound(boundIndex);
+
+            if ((checkpointIt != checkpoints_.begin()) && ((--checkpointIt)->first > 0))
+            {
+                currentBoundIndex = checkpointIt->first;
+                checkpoint = checkpointIt->second;
+            }
+        }
+        else
+        {
+            const auto checkpointIt = checkpoints_.lower_bound(boundIndex);
+
+            if ((checkpointIt != checkpoints_.end()) && (checkpointIt->first < 0))
+            {
+                currentBoundIndex = checkpointIt->first;
+                checkpoint = checkpointIt->second;
+            }
+        }
+    }
+
+    // Derive the missing checkpoints one segment at a time, the segments propagated on the way are stored as well
+    while (currentBoundIndex != boundIndex)
+    {
+        const Integer segmentIndex = isAfterEpoch ? currentBoundIndex : Integer(currentBoundIndex - 1);
+        const Integer nextBoundIndex = isAfterEpoch ? Integer(currentBoundIndex + 1) : Integer(currentBoundIndex - 1);
+
+        Segment segment = this->propagateSegment(segmentIndex, checkpoint, aPropagationFunction);
+
+        {
+            const std::lock_guard<std::mutex> lock {this->mutex_};
+
+            this->store(segmentIndex, std::move(segment));
+
+            checkpoint = checkpoints_.at(nextBoundIndex);
+        }
+
+        currentBoundIndex = nextBoundIndex;
+    }
+
+    return checkpoint;
+}
+
+CheckpointStore::Segment CheckpointStore::propagateSegment(
+    const Integer& aSegmentIndex, const State& aCheckpoint, const PropagationFunction& aPropagationFunction
+) const
+{
+    for (Size pieceCount = 1;; pieceCount *= 2)
+    {
+        const Array<Instant> nodeInstants = this->getNodeInstants(aSegmentIndex, pieceCount);
+        const Array<State> nodeStates = aPropagationFunction(nodeInstants, aCheckpoint);
+
+        if (nodeStates.getSize() != nodeInstants.getSize())
+        {
+            throw ostk::core::error::runtime::Wrong(
+                "Propagated state array size",
+                String::Format("Expected: {}, Got: {}", nodeInstants.getSize(), nodeStates.getSize())
+            );
+        }
+
+        const StateBuilder stateBuilder = {nodeStates.accessFirst()};
+
+        MatrixXd nodeCoordinates(nodeStates.accessFirst().getSize(), nodeStates.getSize());
+
+        for (Index j = 0; j < nodeStates.getSize(); ++j)
+        {
+            nodeCoordinates.col(j) = stateBuilder.reduce(nodeStates[j]).accessCoordinates();
+        }
+
+        // Past the maximum piece count, keep the finest interpolation even if it does not meet the tolerance
+        if ((pieceCount >= MaximumPieceCount) || (this->estimateError(nodeCoordinates, pieceCount) <= tolerance_))
+        {
+            const Size memoryUsage = sizeof(Segment) + (nodeCoordinates.size() * sizeof(double));
+
+            return {nodeCoordinates, stateBuilder, pieceCount, std::list<Integer>::iterator(), memoryUsage};
+        }
+    }
+}
+
+Real CheckpointStore::estimateError(const MatrixXd& aNodeCoordinates, const Size& aPieceCount) const
+{
+    // The magnitude of the two highest-order Chebyshev coefficients of each piece, relative to the largest magnitude
+    // of the coordinate over the segment
+    const double degree = static_cast<double>(degree_);
+
+    double maximumError = 0.0;
+
+    for (Index i = 0; i < static_cast<Index>(aNodeCoordinates.rows()); ++i)
+    {
+        const double scale = aNodeCoordinates.row(i).cwiseAbs().maxCoeff();
+
+        if (scale == 0.0)
+        {
+            continue;
+        }
+
+        for (Index pieceIndex = 0; pieceIndex < aPieceCount; ++pieceIndex)
+        {
+            double error = 0.0;
+
+            for (Index k = (degree_ > 1) ? degree_ - 1 : degree_; k <= degree_; ++k)
+            {
+                double coefficient = 0.0;
+
+                for (Index j = 0; j <= degree_; ++j)
+                {
+                    const double nodeWeight = ((j == 0) || (j == degree_)) ? 0.5 : 1.0;
+
+                    coefficient += nodeWeight * aNodeCoordinates(i, (pieceIndex * degree_) + j) *
+                                   std::cos(M_PI * static_cast<double>(k * j) / degree);
+                }
+
+                error += std::abs(((k == degree_) ? 1.0 : 2.0) * coefficient / degree);
+            }
+
+            maximumError = std::max(maximumError, error / scale);
+        }
+    }
+
+    return maximumError;
+}
+
+State CheckpointStore::interpolate(const Segment& aSegment, const Integer& aSegmentIndex, const Instant& anInstant)
+    const
+{
+    const double pieceDuration = segmentDuration_.inSeconds() / static_cast<double>(aSegment.pieceCount);
+    const double elapsedDuration = (anInstant - this->getSegmentStartInstant(aSegmentIndex)).inSeconds();
+
+    const Index pieceIndex = std::min<Index>(
+        aSegment.pieceCount - 1, static_cast<Index>(std::max(0.0, std::floor(elapsedDuration / pieceDuration)))
+    );
+
+    const double x = 2.0 * (elapsedDuration - (pieceIndex * pieceDuration)) / pieceDuration - 1.0;
+    const Index offset = pieceIndex * degree_;
+
+    // Barycentric interpolation, with the weights of the Chebyshev-Lobatto nodes
+    VectorXd weights(degree_ + 1);
+
+    for (Index j = 0; j <= degree_; ++j)
+    {
+        const double nodeX = -std::cos(M_PI * j / static_cast<double>(degree_));
+
+        if (x == nodeX)
+        {
+            return aSegment.stateBuilder.build(anInstant, aSegment.nodeCoordinates.col(offset + j));
+        }
+
+        const double sign = (j % 2 == 0) ? 1.0 : -1.0;
+        const double scale = ((j == 0) || (j == degree_)) ? 0.5 : 1.0;
+
+        weights(j) = sign * scale / (x - nodeX);
+    }
+
+    return aSegment.stateBuilder.build(
+        anInstant, (aSegment.nodeCoordinates.middleCols(offset, degree_ + 1) * weights) / weights.sum()
+    );
+}
+
+void CheckpointStore::store(const Integer& aSegmentIndex, Segment&& aSegment)
+{
+    // The bound away from the epoch is the checkpoint of the next segment outwards
+    const bool isAfterEpoch = aSegmentIndex >= 0;
+    const Integer outerBoundIndex = isAfterEpoch ? Integer(aSegmentIndex + 1) : aSegmentIndex;
+
+    if (checkpoints_.find(outerBoundIndex) == checkpoints_.end())
+    {
+        const State checkpoint = aSegment.stateBuilder.build(
+            this->getSegmentStartInstant(outerBoundIndex),
+            aSegment.nodeCoordinates.col(isAfterEpoch ? aSegment.nodeCoordinates.cols() - 1 : 0)
+        );
+
+        memoryUsage_ += sizeof(State) + (checkpoint.getSize() * sizeof(double));
+        checkpoints_.insert({outerBoundIndex, checkpoint});
+    }
+
+    if (segments_.find(aSegmentIndex) != segments_.end())
+    {
+        return;
+    }
+
+    recency_.push_front(aSegmentIndex);
+    aSegment.recencyIt = recency_.begin();
+
+    memoryUsage_ += aSegment.memoryUsage;
+    segments_.insert({aSegmentIndex, std::move(aSegment)});
+
+    this->evict(aSegmentIndex);
+}
+
+void CheckpointStore::evict(const Integer& aRetainedSegmentIndex)
+{
+    while ((memoryUsage_ > memoryBudget_) && (segments_.size() > 1))
+    {
+        Integer evictedSegmentIndex = Integer::Undefined();
+
+        switch (evictionPolicy_)
+        {
+            case EvictionPolicy::LeastRecentlyUsed:
+                // The retained segment was just used, so it is never the last one
+                evictedSegmentIndex = recency_.back();
+                break;
+
+            case EvictionPolicy::Farthest:
+            {
+                const Integer firstSegmentIndex = segments_.begin()->first;
+                const Integer lastSegmentIndex = segments_.rbegin()->first;
+
+                evictedSegmentIndex = (std::abs(static_cast<int>(lastSegmentIndex - aRetainedSegmentIndex)) >
+                                       std::abs(static_cast<int>(firstSegmentIndex - aRetainedSegmentIndex)))
+                                        ? lastSegmentIndex
+                                        : firstSegmentIndex;
+                break;
+            }
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Eviction policy");
+        }
+
+        const auto evictedSegmentIt = segments_.find(evictedSegmentIndex);
+
+        memoryUsage_ -= evictedSegmentIt->second.memoryUsage;
+        recency_.erase(evictedSegmentIt->second.recencyIt);
+        segments_.erase(evictedSegmentIt);
+    }
+}
+
+}  // namespace propagated
+}  // namespace model
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <thread>
 #include <typeindex>
 
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
@@ -8,6 +10,7 @@
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
@@ -20,6 +23,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utility/Parallel.hpp>
 
 namespace ostk
 {
@@ -32,6 +36,7 @@ using ostk::core::container::Map;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Position;
@@ -43,6 +48,89 @@ using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::dynamics::Thruster;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::StateBuilder;
+using ostk::astrodynamics::utility::ParallelFor;
+
+namespace
+{
+
+void ValidateInstantArray(const Array<Instant>& anInstantArray)
+{
+    for (Size k = 0; (k + 1) < anInstantArray.getSize(); ++k)
+    {
+        if (anInstantArray[k] > anInstantArray[k + 1])
+        {
+            throw ostk::core::error::runtime::Wrong(
+                "Unsorted Instant Array",
+                String::Format(
+                    "Index {}: {} > Index {}: {}",
+                    k,
+                    anInstantArray[k].toString(),
+                    k + 1,
+                    anInstantArray[k + 1].toString()
+                )
+            );
+        }
+    }
+}
+
+void ValidateStateArray(const Array<State>& aStateArray)
+{
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+    }
+}
+
+/// @brief Integrate a state to an instant or an array of instants, on fixed size state vectors when the solver is
+///        specialized for the size of the state
+template <typename Instants>
+auto IntegrateTime(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Instants& anInstants,
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& aStartInstant,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    const Shared<NumericalSolver::Profile> profileSPtr = aNumericalSolver.getProfile();
+
+    switch (aState.getSize())
+    {
+        case 6:
+            return aNumericalSolver.integrateTime<6>(
+                aState,
+                anInstants,
+                Dynamics::GetFixedSizeSystemOfEquations<6>(aContextArray, aStartInstant, aFrameSPtr, profileSPtr)
+            );
+
+        case 7:
+            return aNumericalSolver.integrateTime<7>(
+                aState,
+                anInstants,
+                Dynamics::GetFixedSizeSystemOfEquations<7>(aContextArray, aStartInstant, aFrameSPtr, profileSPtr)
+            );
+
+        case 8:
+            return aNumericalSolver.integrateTime<8>(
+                aState,
+                anInstants,
+                Dynamics::GetFixedSizeSystemOfEquations<8>(aContextArray, aStartInstant, aFrameSPtr, profileSPtr)
+            );
+
+        default:
+            return aNumericalSolver.integrateTime(
+                aState,
+                anInstants,
+                Dynamics::GetSystemOfEquations(aContextArray, aStartInstant, aFrameSPtr, profileSPtr)
+            );
+    }
+}
+
+}  // namespace
 
 const Shared<const Frame> Propagator::IntegrationFrameSPtr = Frame::GCRF();
 
@@ -226,6 +314,14 @@ void Propagator::clearDynamics()
 }
 
 State Propagator::calculateStateAt(const State& aState, const Instant& anInstant) const
+{
+    Array<State> observedStates = Array<State>::Empty();
+
+    return this->calculateStateAt(aState, anInstant, observedStates);
+}
+
+State Propagator::calculateStateAt(const State& aState, const Instant& anInstant, Array<State>& anObservedStateArray)
+    const
 {
     if (!this->isDefined())
     {
@@ -236,24 +332,30 @@ State Propagator::calculateStateAt(const State& aState, const Instant& anInstant
 
     const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+    NumericalSolver numericalSolver = numericalSolver_;
 
-    const State solverOutputState = numericalSolver_.integrateTime(
-        solverInputState,
-        anInstant,
-        Dynamics::GetSystemOfEquations(
-            dynamicsContexts_, solverInputState.accessInstant(), Propagator::IntegrationFrameSPtr
-        )
-    );
+    const State state = this->propagateStateAt(aState, anInstant, solverStateBuilder, numericalSolver);
 
-    const StateBuilder outputStateBuilder = {aState};
+    anObservedStateArray = numericalSolver.accessObservedStates();
 
-    return outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState);
+    return state;
 }
 
 NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
     const State& aState, const Instant& anInstant, const EventCondition& anEventCondition
 ) const
+{
+    Array<State> observedStates = Array<State>::Empty();
+
+    return this->calculateStateToCondition(aState, anInstant, anEventCondition, observedStates);
+}
+
+NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
+    const State& aState,
+    const Instant& anInstant,
+    const EventCondition& anEventCondition,
+    Array<State>& anObservedStateArray
+) const
 {
     if (!this->isDefined())
     {
@@ -268,10 +370,14 @@ NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
 
     const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
 
-    NumericalSolver::ConditionSolution conditionSolution = numericalSolver_.integrateTime(
+    NumericalSolver numericalSolver = numericalSolver_;
+
+    NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
         solverInputState,
         anInstant,
-        Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr),
+        Dynamics::GetSystemOfEquations(
+            dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr, numericalSolver.getProfile()
+        ),
         anEventCondition
     );
 
@@ -279,6 +385,8 @@ NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
 
     conditionSolution.state = outputStateBuilder.expand(conditionSolution.state.inFrame(aState.accessFrame()), aState);
 
+    anObservedStateArray = numericalSolver.accessObservedStates();
+
     return conditionSolution;
 }
 
@@ -299,38 +407,79 @@ Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Inst
         return Array<State>::Empty();
     }
 
-    for (Size k = 0; k < anInstantArray.getSize() - 1; ++k)
+    ValidateInstantArray(anInstantArray);
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+
+    NumericalSolver numericalSolver = numericalSolver_;
+
+    return this->propagateStatesAt(aState, anInstantArray, solverStateBuilder, numericalSolver);
+}
+
+bool Propagator::canCalculateStateTransitionMatrices() const
+{
+    if (dynamicsContexts_.isEmpty())
     {
-        if (anInstantArray[k] > anInstantArray[k + 1])
+        return false;
+    }
+
+    return std::all_of(
+        dynamicsContexts_.begin(),
+        dynamicsContexts_.end(),
+        [](const Dynamics::Context& aDynamicsContext) -> bool
         {
-            throw ostk::core::error::runtime::Wrong(
-                "Unsorted Instant Array",
-                String::Format(
-                    "Index {}: {} > Index {}: {}",
-                    k,
-                    anInstantArray[k].toString(),
-                    k + 1,
-                    anInstantArray[k + 1].toString()
-                )
-            );
+            return aDynamicsContext.dynamics->hasContributionJacobian();
         }
+    );
+}
+
+Pair<Array<State>, Array<MatrixXd>> Propagator::calculateStatesAndStateTransitionMatricesAt(
+    const State& aState, const Array<Instant>& anInstantArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return {Array<State>::Empty(), Array<MatrixXd>::Empty()};
     }
 
+    ValidateInstantArray(anInstantArray);
+
     this->validateDynamicsSet();
 
     const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
-
     const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
 
     const Instant& startInstant = solverInputState.accessInstant();
+    const Size stateSize = coordinatesBrokerSPtr_->getNumberOfCoordinates();
+
+    // The state, followed by the state transition matrix (column-major), initialized to the identity
+    NumericalSolver::StateVector variationalStateVector(stateSize + stateSize * stateSize);
+    variationalStateVector.head(stateSize) = solverInputState.accessCoordinates();
+    Eigen::Map<MatrixXd>(variationalStateVector.data() + stateSize, stateSize, stateSize).setIdentity();
+
+    NumericalSolver numericalSolver = numericalSolver_;
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetVariationalSystemOfEquations(
+        dynamicsContexts_, stateSize, startInstant, Propagator::IntegrationFrameSPtr, numericalSolver.getProfile()
+    );
 
     Array<Instant> forwardInstants;
     forwardInstants.reserve(anInstantArray.getSize());
     Array<Instant> backwardInstants;
     backwardInstants.reserve(anInstantArray.getSize());
 
-    const StateBuilder outputStateBuilder(aState);
-
     for (const Instant& anInstant : anInstantArray)
     {
         if (anInstant <= startInstant)
@@ -343,41 +492,283 @@ Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Inst
         }
     }
 
+    // backward propagation only
+    Array<NumericalSolver::StateVector> backwardStateVectors = Array<NumericalSolver::StateVector>::Empty();
+    if (!backwardInstants.isEmpty())
+    {
+        std::reverse(backwardInstants.begin(), backwardInstants.end());
+
+        backwardStateVectors = numericalSolver.integrateBatchTime(
+            variationalStateVector, startInstant, backwardInstants, systemOfEquations
+        );
+
+        std::reverse(backwardInstants.begin(), backwardInstants.end());
+        std::reverse(backwardStateVectors.begin(), backwardStateVectors.end());
+    }
+
     // forward propagation only
-    Array<State> forwardPropagatedStates;
+    Array<NumericalSolver::StateVector> forwardStateVectors = Array<NumericalSolver::StateVector>::Empty();
     if (!forwardInstants.isEmpty())
     {
-        forwardPropagatedStates = numericalSolver_.integrateTime(
-            solverInputState,
-            forwardInstants,
-            Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr)
+        forwardStateVectors = numericalSolver.integrateBatchTime(
+            variationalStateVector, startInstant, forwardInstants, systemOfEquations
+        );
+    }
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    const Array<Instant> instants = backwardInstants + forwardInstants;
+    const Array<NumericalSolver::StateVector> stateVectors = backwardStateVectors + forwardStateVectors;
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(instants.getSize());
+    Array<MatrixXd> stateTransitionMatrices = Array<MatrixXd>::Empty();
+    stateTransitionMatrices.reserve(instants.getSize());
+
+    for (Index k = 0; k < instants.getSize(); ++k)
+    {
+        const State solverOutputState = solverStateBuilder.build(instants[k], stateVectors[k].head(stateSize));
+
+        states.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+        stateTransitionMatrices.add(
+            MatrixXd(Eigen::Map<const MatrixXd>(stateVectors[k].data() + stateSize, stateSize, stateSize))
+        );
+    }
+
+    return {states, stateTransitionMatrices};
+}
+
+Array<State> Propagator::calculateEnsembleStateAt(
+    const Array<State>& aStateArray, const Instant& anInstant, const Size& aThreadCount
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    ValidateStateArray(aStateArray);
+
+    this->validateDynamicsSet();
+
+    Array<State> states = Array<State>(aStateArray.getSize(), State::Undefined());
+
+    this->propagateEnsemble(
+        aStateArray.getSize(),
+        aThreadCount,
+        [&](const Index& aMemberIndex, const StateBuilder& aSolverStateBuilder, NumericalSolver& aNumericalSolver
+        ) -> void
+        {
+            states[aMemberIndex] =
+                this->propagateStateAt(aStateArray[aMemberIndex], anInstant, aSolverStateBuilder, aNumericalSolver);
+        }
+    );
+
+    return states;
+}
+
+Array<Array<State>> Propagator::calculateEnsembleStatesAt(
+    const Array<State>& aStateArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    return this->calculateEnsembleStatesAt(
+        aStateArray, Array<Array<Instant>>(aStateArray.getSize(), anInstantArray), aThreadCount
+    );
+}
+
+Array<Array<State>> Propagator::calculateEnsembleStatesAt(
+    const Array<State>& aStateArray, const Array<Array<Instant>>& anInstantArrays, const Size& aThreadCount
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (aStateArray.getSize() != anInstantArrays.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Number of states [{}] differs from number of instant arrays [{}].",
+            aStateArray.getSize(),
+            anInstantArrays.getSize()
+        );
+    }
+
+    ValidateStateArray(aStateArray);
+
+    for (const Array<Instant>& instantArray : anInstantArrays)
+    {
+        ValidateInstantArray(instantArray);
+    }
+
+    this->validateDynamicsSet();
+
+    Array<Array<State>> states = Array<Array<State>>(aStateArray.getSize(), Array<State>::Empty());
+
+    this->propagateEnsemble(
+        aStateArray.getSize(),
+        aThreadCount,
+        [&](const Index& aMemberIndex, const StateBuilder& aSolverStateBuilder, NumericalSolver& aNumericalSolver
+        ) -> void
+        {
+            if (anInstantArrays[aMemberIndex].isEmpty())
+            {
+                return;
+            }
+
+            states[aMemberIndex] = this->propagateStatesAt(
+                aStateArray[aMemberIndex], anInstantArrays[aMemberIndex], aSolverStateBuilder, aNumericalSolver
+            );
+        }
+    );
+
+    return states;
+}
+
+Array<State> Propagator::calculateBatchStateAt(const Array<State>& aStateArray, const Instant& anInstant) const
+{
+    return this->calculateBatchStatesAt(aStateArray, {anInstant})
+        .map<State>(
+            [](const Array<State>& aMemberStateArray) -> State
+            {
+                return aMemberStateArray.accessFirst();
+            }
         );
+}
+
+Array<Array<State>> Propagator::calculateBatchStatesAt(
+    const Array<State>& aStateArray, const Array<Instant>& anInstantArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    ValidateStateArray(aStateArray);
+
+    if (aStateArray.isEmpty())
+    {
+        return Array<Array<State>>::Empty();
+    }
+
+    const Instant& startInstant = aStateArray.accessFirst().accessInstant();
+
+    for (const State& state : aStateArray)
+    {
+        if (state.accessInstant() != startInstant)
+        {
+            throw ostk::core::error::RuntimeError(
+                "Batch states must share the same instant [{}], found [{}].",
+                startInstant.toString(),
+                state.accessInstant().toString()
+            );
+        }
+    }
+
+    Array<Array<State>> states = Array<Array<State>>(aStateArray.getSize(), Array<State>::Empty());
+
+    if (anInstantArray.isEmpty())
+    {
+        return states;
+    }
+
+    ValidateInstantArray(anInstantArray);
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+
+    const Size memberCount = aStateArray.getSize();
+    const Size stateSize = coordinatesBrokerSPtr_->getNumberOfCoordinates();
+
+    // Structure of arrays: one row per member, so that each coordinate is contiguous across members
+    MatrixXd stateMatrix(memberCount, stateSize);
+
+    for (Index i = 0; i < memberCount; ++i)
+    {
+        stateMatrix.row(i) = solverStateBuilder.reduce(aStateArray[i].inFrame(Propagator::IntegrationFrameSPtr))
+                                 .accessCoordinates()
+                                 .transpose();
+    }
+
+    const NumericalSolver::StateVector batchStateVector =
+        Eigen::Map<const VectorXd>(stateMatrix.data(), stateMatrix.size());
+
+    NumericalSolver numericalSolver = numericalSolver_;
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetBatchSystemOfEquations(
+        dynamicsContexts_, memberCount, startInstant, Propagator::IntegrationFrameSPtr, numericalSolver.getProfile()
+    );
+
+    Array<Instant> forwardInstants;
+    forwardInstants.reserve(anInstantArray.getSize());
+    Array<Instant> backwardInstants;
+    backwardInstants.reserve(anInstantArray.getSize());
+
+    for (const Instant& anInstant : anInstantArray)
+    {
+        if (anInstant <= startInstant)
+        {
+            backwardInstants.add(anInstant);
+        }
+        else
+        {
+            forwardInstants.add(anInstant);
+        }
     }
 
     // backward propagation only
-    Array<State> backwardPropagatedStates;
+    Array<NumericalSolver::StateVector> backwardBatchStateVectors = Array<NumericalSolver::StateVector>::Empty();
     if (!backwardInstants.isEmpty())
     {
         std::reverse(backwardInstants.begin(), backwardInstants.end());
 
-        backwardPropagatedStates = numericalSolver_.integrateTime(
-            solverInputState,
-            backwardInstants,
-            Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr)
-        );
+        backwardBatchStateVectors =
+            numericalSolver.integrateBatchTime(batchStateVector, startInstant, backwardInstants, systemOfEquations);
 
-        std::reverse(backwardPropagatedStates.begin(), backwardPropagatedStates.end());
+        std::reverse(backwardInstants.begin(), backwardInstants.end());
+        std::reverse(backwardBatchStateVectors.begin(), backwardBatchStateVectors.end());
     }
 
-    Array<State> outputStates;
-    outputStates.reserve(backwardPropagatedStates.getSize() + forwardPropagatedStates.getSize());
+    // forward propagation only
+    Array<NumericalSolver::StateVector> forwardBatchStateVectors = Array<NumericalSolver::StateVector>::Empty();
+    if (!forwardInstants.isEmpty())
+    {
+        forwardBatchStateVectors =
+            numericalSolver.integrateBatchTime(batchStateVector, startInstant, forwardInstants, systemOfEquations);
+    }
 
-    for (const State& solverOutputState : backwardPropagatedStates + forwardPropagatedStates)
+    const Array<StateBuilder> outputStateBuilders = aStateArray.map<StateBuilder>(
+        [](const State& aState) -> StateBuilder
+        {
+            return {aState};
+        }
+    );
+
+    for (Index i = 0; i < memberCount; ++i)
     {
-        outputStates.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+        states[i].reserve(anInstantArray.getSize());
     }
 
-    return outputStates;
+    const Array<Instant> instants = backwardInstants + forwardInstants;
+    const Array<NumericalSolver::StateVector> batchStateVectors = backwardBatchStateVectors + forwardBatchStateVectors;
+
+    for (Index k = 0; k < instants.getSize(); ++k)
+    {
+        const Eigen::Map<const MatrixXd> outputStateMatrix(batchStateVectors[k].data(), memberCount, stateSize);
+
+        for (Index i = 0; i < memberCount; ++i)
+        {
+            const State solverOutputState = solverStateBuilder.build(instants[k], outputStateMatrix.row(i).transpose());
+
+            states[i].add(outputStateBuilders[i].expand(
+                solverOutputState.inFrame(aStateArray[i].accessFrame()), aStateArray[i]
+            ));
+        }
+    }
+
+    return states;
 }
 
 void Propagator::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -455,6 +846,128 @@ void Propagator::validateDynamicsSet() const
     }
 }
 
+State Propagator::propagateStateAt(
+    const State& aState,
+    const Instant& anInstant,
+    const StateBuilder& aSolverStateBuilder,
+    NumericalSolver& aNumericalSolver
+) const
+{
+    const State solverInputState = aSolverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+
+    const State solverOutputState = IntegrateTime(
+        aNumericalSolver,
+        solverInputState,
+        anInstant,
+        dynamicsContexts_,
+        solverInputState.accessInstant(),
+        Propagator::IntegrationFrameSPtr
+    );
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    return outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState);
+}
+
+Array<State> Propagator::propagateStatesAt(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const StateBuilder& aSolverStateBuilder,
+    NumericalSolver& aNumericalSolver
+) const
+{
+    const State solverInputState = aSolverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+
+    const Instant& startInstant = solverInputState.accessInstant();
+
+    Array<Instant> forwardInstants;
+    forwardInstants.reserve(anInstantArray.getSize());
+    Array<Instant> backwardInstants;
+    backwardInstants.reserve(anInstantArray.getSize());
+
+    const StateBuilder outputStateBuilder(aState);
+
+    for (const Instant& anInstant : anInstantArray)
+    {
+        if (anInstant <= startInstant)
+        {
+            backwardInstants.add(anInstant);
+        }
+        else
+        {
+            forwardInstants.add(anInstant);
+        }
+    }
+
+    // forward propagation only
+    Array<State> forwardPropagatedStates;
+    if (!forwardInstants.isEmpty())
+    {
+        forwardPropagatedStates = IntegrateTime(
+            aNumericalSolver,
+            solverInputState,
+            forwardInstants,
+            dynamicsContexts_,
+            startInstant,
+            Propagator::IntegrationFrameSPtr
+        );
+    }
+
+    // backward propagation only
+    Array<State> backwardPropagatedStates;
+    if (!backwardInstants.isEmpty())
+    {
+        std::reverse(backwardInstants.begin(), backwardInstants.end());
+
+        backwardPropagatedStates = IntegrateTime(
+            aNumericalSolver,
+            solverInputState,
+            backwardInstants,
+            dynamicsContexts_,
+            startInstant,
+            Propagator::IntegrationFrameSPtr
+        );
+
+        std::reverse(backwardPropagatedStates.begin(), backwardPropagatedStates.end());
+    }
+
+    Array<State> outputStates;
+    outputStates.reserve(backwardPropagatedStates.getSize() + forwardPropagatedStates.getSize());
+
+    for (const State& solverOutputState : backwardPropagatedStates + forwardPropagatedStates)
+    {
+        outputStates.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+    }
+
+    return outputStates;
+}
+
+void Propagator::propagateEnsemble(
+    const Size& aMemberCount,
+    const Size& aThreadCount,
+    const std::function<void(const Index&, const StateBuilder&, NumericalSolver&)>& aMemberFunction
+) const
+{
+    // The coordinate broker and dynamics are shared by all members, only the numerical solver (which records the
+    // observed states) is copied per thread.
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+
+    const Size threadCount =
+        (aThreadCount == 0) ? std::max<Size>(1, std::thread::hardware_concurrency()) : aThreadCount;
+
+    Array<NumericalSolver> numericalSolvers(std::min(aMemberCount, threadCount), numericalSolver_);
+
+    // members are handed out one at a time, as their propagation cost can differ widely
+    ParallelFor(
+        aMemberCount,
+        threadCount,
+        [&](const Index& aMemberIndex, const Index& aWorkerIndex) -> void
+        {
+            aMemberFunction(aMemberIndex, solverStateBuilder, numericalSolvers[aWorkerIndex]);
+        }
+    );
+}
+
 }  // namespace trajectory
 }  // namespace astrodynamics
 }  // namespace ostk
@@ -1689,16 +1689,18 @@ Segment::Solution Segment::solveWithDynamics_(
         aDynamicsArray,
     };
 
+    Array<State> observedStates = Array<State>::Empty();
+
     const NumericalSolver::ConditionSolution conditionSolution =
-        propagator.calculateStateToCondition(aState, anEndInstant, *anEventCondition);
+        propagator.calculateStateToCondition(aState, anEndInstant, *anEventCondition, observedStates);
 
     // Expand states based on input state
     const StateBuilder stateBuilder = {aState};
 
     Array<State> states = Array<State>::Empty();
-    states.reserve(propagator.accessNumericalSolver().accessObservedStates().getSize());
+    states.reserve(observedStates.getSize());
 
-    for (const State& state : propagator.accessNumericalSolver().accessObservedStates())
+    for (const State& state : observedStates)
     {
         states.add(stateBuilder.expand(state.inFrame(aState.accessFrame()), aState));
     }
@@ -1721,15 +1723,17 @@ Array<State> Segment::propagateWithDynamics_(
         aDynamicsArray,
     };
 
-    propagator.calculateStateAt(aState, anEndInstant);
+    Array<State> observedStates = Array<State>::Empty();
+
+    propagator.calculateStateAt(aState, anEndInstant, observedStates);
 
     // Expand states based on input state
     const StateBuilder stateBuilder = {aState};
 
     Array<State> states = Array<State>::Empty();
-    states.reserve(propagator.accessNumericalSolver().accessObservedStates().getSize());
+    states.reserve(observedStates.getSize());
 
-    for (const State& state : propagator.accessNumericalSolver().accessObservedStates())
+    for (const State& state : observedStates)
     {
         states.add(stateBuilder.expand(state.inFrame(aState.accessFrame()), aState));
     }
@@ -1,6 +1,12 @@
 /// Apache License 2.0
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <numeric>
+#include <vector>
 
 #include <boost/numeric/odeint.hpp>
 #include <boost/numeric/odeint/algebra/vector_space_algebra.hpp>
@@ -102,6 +108,686 @@ auto make_controlled_adam_bashforth_moulton(double abs_tol, double rel_tol)
     return ControlledStepperType(StepAdjusterType(abs_tol, rel_tol));
 }
 
+namespace
+{
+
+/// @brief Number of backward differences retained by the Gauss-Jackson method
+constexpr Size GaussJacksonDifferenceCount = 8;
+
+/// @brief Number of position coordinates integrated from the second sums of the accelerations
+constexpr Size GaussJacksonPositionSize = 3;
+
+using GaussJacksonCoefficients = std::array<double, GaussJacksonDifferenceCount + 1>;
+
+/// @brief Convert the coefficients of a series in backward differences of f(n) into the weights of the ordinates
+///        f(n), f(n - 1), ..., f(n - 8)
+GaussJacksonCoefficients GaussJacksonOrdinateWeights(const GaussJacksonCoefficients& aDifferenceCoefficients)
+{
+    GaussJacksonCoefficients weights;
+    weights.fill(0.0);
+
+    for (Index k = 0; k <= GaussJacksonDifferenceCount; ++k)
+    {
+        double binomialCoefficient = 1.0;
+
+        for (Index j = 0; j <= k; ++j)
+        {
+            weights[j] += ((j % 2 == 0) ? 1.0 : -1.0) * binomialCoefficient * aDifferenceCoefficients[k];
+            binomialCoefficient *= double(k - j) / double(j + 1);
+        }
+    }
+
+    return weights;
+}
+
+// With the first sums S1(n) = S1(n - 1) + f(n) and the second sums S2(n) = S2(n - 1) + S1(n) of the accelerations:
+//   summed Adams corrector:      x(n) / h = S1(n) + Σ A(k) ∇^k f(n)
+//   summed Adams predictor:      x(n + 1) / h = S1(n) + Σ Ap(k) ∇^k f(n)
+//   Gauss-Jackson corrector:     r(n) / h² = S2(n) - S1(n) + Σ B(k) ∇^k a(n)
+//   Gauss-Jackson predictor:     r(n + 1) / h² = S2(n) + Σ Bp(k) ∇^k a(n)
+
+const GaussJacksonCoefficients GaussJacksonFirstSumCorrectorWeights = GaussJacksonOrdinateWeights({
+    -1.0 / 2.0,
+    -1.0 / 12.0,
+    -1.0 / 24.0,
+    -19.0 / 720.0,
+    -3.0 / 160.0,
+    -863.0 / 60480.0,
+    -275.0 / 24192.0,
+    -33953.0 / 3628800.0,
+    -8183.0 / 1036800.0,
+});
+
+const GaussJacksonCoefficients GaussJacksonFirstSumPredictorWeights = GaussJacksonOrdinateWeights({
+    1.0 / 2.0,
+    5.0 / 12.0,
+    3.0 / 8.0,
+    251.0 / 720.0,
+    95.0 / 288.0,
+    19087.0 / 60480.0,
+    5257.0 / 17280.0,
+    1070017.0 / 3628800.0,
+    25713.0 / 89600.0,
+});
+
+const GaussJacksonCoefficients GaussJacksonSecondSumCorrectorWeights = GaussJacksonOrdinateWeights({
+    1.0 / 12.0,
+    0.0,
+    -1.0 / 240.0,
+    -1.0 / 240.0,
+    -221.0 / 60480.0,
+    -19.0 / 6048.0,
+    -9829.0 / 3628800.0,
+    -407.0 / 172800.0,
+    -330157.0 / 159667200.0,
+});
+
+const GaussJacksonCoefficients GaussJacksonSecondSumPredictorWeights = GaussJacksonOrdinateWeights({
+    1.0 / 12.0,
+    1.0 / 12.0,
+    19.0 / 240.0,
+    3.0 / 40.0,
+    863.0 / 12096.0,
+    275.0 / 4032.0,
+    33953.0 / 518400.0,
+    8183.0 / 129600.0,
+    3250433.0 / 53222400.0,
+});
+
+/// @brief Fixed step 8th order Gauss-Jackson (positions) and summed Adams (other coordinates) predictor-corrector.
+///
+/// @details The method is started with a Runge-Kutta-Fehlberg 7(8) stepper, stepping exactly one fixed step at a
+/// time until enough back points are known. Each call to doStep must be given the state produced by the previous one.
+class GaussJacksonStepper
+{
+   public:
+    using Starter = typename result_of::make_controlled<runge_kutta_fehlberg78<NumericalSolver::StateVector>>::type;
+
+    GaussJacksonStepper(
+        const double& aSignedTimeStep, const double& anAbsoluteTolerance, const double& aRelativeTolerance
+    )
+        : timeStep_(aSignedTimeStep),
+          starter_(make_controlled(
+              anAbsoluteTolerance, aRelativeTolerance, runge_kutta_fehlberg78<NumericalSolver::StateVector>()
+          )),
+          startTime_(0.0),
+          stepCount_(0),
+          positionSize_(0),
+          derivatives_(),
+          firstSums_(),
+          secondSums_(),
+          derivative_(),
+          positions_()
+    {
+    }
+
+    const Starter& accessStarter() const
+    {
+        return starter_;
+    }
+
+    void doStep(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        NumericalSolver::StateVector& aStateVector,
+        double& aTime
+    )
+    {
+        if (derivatives_.empty())
+        {
+            startTime_ = aTime;
+
+            aSystemOfEquations(aStateVector, derivative_, aTime);
+            derivatives_.push_front(derivative_);
+
+            // Positions are integrated from the accelerations only when their derivatives are the velocities
+            const Size velocityOffset = GaussJacksonPositionSize;
+
+            positionSize_ = ((Size(aStateVector.size()) >= 2 * GaussJacksonPositionSize) &&
+                             derivative_.head(GaussJacksonPositionSize)
+                                 .isApprox(aStateVector.segment(velocityOffset, GaussJacksonPositionSize), 1e-12))
+                              ? GaussJacksonPositionSize
+                              : 0;
+        }
+
+        const double nextTime = startTime_ + double(stepCount_ + 1) * timeStep_;
+
+        if (derivatives_.size() <= GaussJacksonDifferenceCount)
+        {
+            integrate_adaptive(starter_, aSystemOfEquations, aStateVector, aTime, nextTime, timeStep_);
+
+            aSystemOfEquations(aStateVector, derivative_, nextTime);
+            derivatives_.push_front(derivative_);
+
+            if (derivatives_.size() == (GaussJacksonDifferenceCount + 1))
+            {
+                this->initializeSums(aStateVector);
+            }
+        }
+        else
+        {
+            this->predictCorrect(aSystemOfEquations, aStateVector, nextTime);
+        }
+
+        aTime = nextTime;
+        ++stepCount_;
+    }
+
+   private:
+    double timeStep_;
+    Starter starter_;
+    double startTime_;
+    Size stepCount_;
+    Size positionSize_;
+    std::deque<NumericalSolver::StateVector> derivatives_;
+    NumericalSolver::StateVector firstSums_;
+    NumericalSolver::StateVector secondSums_;
+    NumericalSolver::StateVector derivative_;
+    NumericalSolver::StateVector positions_;
+
+    /// @brief Set the integration constants so that the correctors reproduce the last starter state
+    void initializeSums(const NumericalSolver::StateVector& aStateVector)
+    {
+        const Size& k = positionSize_;
+
+        firstSums_ = aStateVector / timeStep_;
+        secondSums_ = aStateVector.head(k) / (timeStep_ * timeStep_);
+
+        for (Index j = 0; j <= GaussJacksonDifferenceCount; ++j)
+        {
+            firstSums_.noalias() -= GaussJacksonFirstSumCorrectorWeights[j] * derivatives_[j];
+            secondSums_.noalias() -= GaussJacksonSecondSumCorrectorWeights[j] * derivatives_[j].segment(k, k);
+        }
+
+        secondSums_ += firstSums_.segment(k, k);
+    }
+
+    void predictCorrect(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        NumericalSolver::StateVector& aStateVector,
+        const double& aNextTime
+    )
+    {
+        const Size& k = positionSize_;
+        const double h = timeStep_;
+
+        // Predict
+        aStateVector = firstSums_;
+        positions_ = secondSums_;
+
+        for (Index j = 0; j <= GaussJacksonDifferenceCount; ++j)
+        {
+            aStateVector.noalias() += GaussJacksonFirstSumPredictorWeights[j] * derivatives_[j];
+            positions_.noalias() += GaussJacksonSecondSumPredictorWeights[j] * derivatives_[j].segment(k, k);
+        }
+
+        aStateVector *= h;
+        aStateVector.head(k) = (h * h) * positions_;
+
+        // Evaluate
+        aSystemOfEquations(aStateVector, derivative_, aNextTime);
+
+        // Correct, the oldest back point dropping out of the differences
+        derivatives_.pop_back();
+        derivatives_.push_front(derivative_);
+
+        aStateVector = firstSums_ + derivative_;
+        positions_ = secondSums_;
+
+        for (Index j = 0; j <= GaussJacksonDifferenceCount; ++j)
+        {
+            aStateVector.noalias() += GaussJacksonFirstSumCorrectorWeights[j] * derivatives_[j];
+            positions_.noalias() += GaussJacksonSecondSumCorrectorWeights[j] * derivatives_[j].segment(k, k);
+        }
+
+        // S2(n + 1) - S1(n + 1) = S2(n)
+        aStateVector *= h;
+        aStateVector.head(k) = (h * h) * positions_;
+
+        // Evaluate, and update the sums with the corrected derivatives
+        aSystemOfEquations(aStateVector, derivative_, aNextTime);
+
+        derivatives_.front() = derivative_;
+
+        firstSums_ += derivative_;
+        secondSums_ += firstSums_.segment(k, k);
+    }
+};
+
+/// @brief Scope of a profiled solve: clears the solve record on entry, and adds it to the profile on exit
+class ProfiledSolve
+{
+   public:
+    ProfiledSolve(const Shared<NumericalSolver::Profile>& aProfileSPtr, NumericalSolver::Profile::Record& aRecord)
+        : profileSPtr_(aProfileSPtr),
+          record_(aRecord),
+          startTime_(std::chrono::steady_clock::now())
+    {
+        if (profileSPtr_ != nullptr)
+        {
+            record_ = {};
+        }
+    }
+
+    ~ProfiledSolve()
+    {
+        if (profileSPtr_ != nullptr)
+        {
+            record_.duration = std::chrono::steady_clock::now() - startTime_;
+            profileSPtr_->add(record_);
+        }
+    }
+
+   private:
+    const Shared<NumericalSolver::Profile>& profileSPtr_;
+    NumericalSolver::Profile::Record& record_;
+    const std::chrono::steady_clock::time_point startTime_;
+};
+
+/// @brief Stepper forwarding to an underlying stepper, and passing each accepted step to a callback, along with the
+///        number of tries rejected before it
+///
+/// @details Lets the steps taken by odeint integrate functions be recorded. Rejected tries are only visible with
+/// controlled steppers: dense-output steppers retry internally, so that their steps are reported without rejections.
+template <typename Stepper, typename StepCallback>
+class ProfiledStepper
+{
+   public:
+    using stepper_category = typename Stepper::stepper_category;
+
+    ProfiledStepper(Stepper& aStepper, const StepCallback& aStepCallback)
+        : stepper_(aStepper),
+          stepCallback_(aStepCallback),
+          rejectedStepCount_(0)
+    {
+    }
+
+    // Fixed step steppers
+
+    template <typename System, typename StateVector, typename Time>
+    void do_step(System&& aSystem, StateVector& aStateVector, const Time& aTime, const Time& aTimeStep)
+    {
+        stepper_.do_step(aSystem, aStateVector, aTime, aTimeStep);
+
+        stepCallback_(aTimeStep, 0);
+    }
+
+    // Controlled steppers
+
+    template <typename System, typename StateVector, typename Time>
+    controlled_step_result try_step(System&& aSystem, StateVector& aStateVector, Time& aTime, Time& aTimeStep)
+    {
+        const Time startTime = aTime;
+
+        const controlled_step_result result = stepper_.try_step(aSystem, aStateVector, aTime, aTimeStep);
+
+        if (result == controlled_step_result::success)
+        {
+            stepCallback_(aTime - startTime, rejectedStepCount_);
+            rejectedStepCount_ = 0;
+        }
+        else
+        {
+            ++rejectedStepCount_;
+        }
+
+        return result;
+    }
+
+    // Dense-output steppers
+
+    template <typename StateVector, typename Time>
+    void initialize(const StateVector& aStateVector, const Time& aTime, const Time& aTimeStep)
+    {
+        stepper_.initialize(aStateVector, aTime, aTimeStep);
+    }
+
+    template <typename System>
+    auto do_step(System&& aSystem)
+    {
+        const auto times = stepper_.do_step(aSystem);
+
+        stepCallback_(times.second - times.first, 0);
+
+        return times;
+    }
+
+    template <typename Time, typename StateVector>
+    void calc_state(const Time& aTime, StateVector& aStateVector) const
+    {
+        stepper_.calc_state(aTime, aStateVector);
+    }
+
+    decltype(auto) current_state() const
+    {
+        return stepper_.current_state();
+    }
+
+    auto current_time() const
+    {
+        return stepper_.current_time();
+    }
+
+    auto current_time_step() const
+    {
+        return stepper_.current_time_step();
+    }
+
+   private:
+    Stepper& stepper_;
+    const StepCallback& stepCallback_;
+    Size rejectedStepCount_;
+};
+
+template <typename Stepper, typename StepCallback>
+inline ProfiledStepper<Stepper, StepCallback> makeProfiledStepper(Stepper& aStepper, const StepCallback& aStepCallback)
+{
+    return {aStepper, aStepCallback};
+}
+
+/// @brief Call a function with a stepper of the given type, on state vectors of the given type. Adams-Bashforth-Moulton
+///        steppers are not supported.
+template <typename StateVector, typename Function>
+inline void withStepper_(
+    const NumericalSolver::StepperType& aStepperType,
+    const double& anAbsoluteTolerance,
+    const double& aRelativeTolerance,
+    const Function& aFunction
+)
+{
+    using StepperType = NumericalSolver::StepperType;
+
+    switch (aStepperType)
+    {
+        case StepperType::RungeKutta4:
+            aFunction(runge_kutta4<StateVector> {});
+            break;
+
+        case StepperType::RungeKuttaCashKarp54:
+            aFunction(make_controlled(anAbsoluteTolerance, aRelativeTolerance, runge_kutta_cash_karp54<StateVector>()));
+            break;
+
+        case StepperType::RungeKuttaFehlberg78:
+            aFunction(make_controlled(anAbsoluteTolerance, aRelativeTolerance, runge_kutta_fehlberg78<StateVector>()));
+            break;
+
+        case StepperType::RungeKuttaDopri5:
+            aFunction(make_controlled(anAbsoluteTolerance, aRelativeTolerance, runge_kutta_dopri5<StateVector>()));
+            break;
+
+        case StepperType::BulirschStoer:
+            aFunction(bulirsch_stoer<StateVector>(anAbsoluteTolerance, aRelativeTolerance));
+            break;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+    }
+}
+
+/// @brief Integrate to an array of durations with a stepper of the given type, passing each accepted step to a
+///        callback
+///
+/// @details Forward and backward durations are integrated separately, each in chronological order, from the same
+/// initial state, with a new stepper per direction. The state vectors are returned in the order of the durations.
+template <typename StateVector, typename System, typename SignedTimeStep, typename StepCallback>
+inline Array<StateVector> integrateDurations_(
+    const StateVector& anInitialStateVector,
+    const Array<Real>& aDurationArray,
+    const System& aSystemOfEquations,
+    const NumericalSolver::StepperType& aStepperType,
+    const double& anAbsoluteTolerance,
+    const double& aRelativeTolerance,
+    const SignedTimeStep& aSignedTimeStep,
+    const StepCallback& aStepCallback
+)
+{
+    Array<StateVector> stateVectors = Array<StateVector>(aDurationArray.getSize(), anInitialStateVector);
+
+    for (const double direction : {1.0, -1.0})
+    {
+        std::vector<Index> indexes;
+        indexes.reserve(aDurationArray.getSize());
+
+        for (Index i = 0; i < aDurationArray.getSize(); ++i)
+        {
+            const double duration = aDurationArray[i];
+
+            if ((direction > 0.0) ? (duration > 0.0) : (duration < 0.0))
+            {
+                indexes.push_back(i);
+            }
+        }
+
+        if (indexes.empty())
+        {
+            continue;
+        }
+
+        std::stable_sort(
+            indexes.begin(),
+            indexes.end(),
+            [&aDurationArray, direction](const Index& anIndex, const Index& anotherIndex) -> bool
+            {
+                return (direction * aDurationArray[anIndex]) < (direction * aDurationArray[anotherIndex]);
+            }
+        );
+
+        // The stepper starts at the first time of the sequence, hence the leading zero
+        std::vector<double> times;
+        times.reserve(indexes.size() + 1);
+        times.push_back(0.0);
+
+        for (const Index& index : indexes)
+        {
+            times.push_back(aDurationArray[index]);
+        }
+
+        StateVector stateVector = anInitialStateVector;
+        Index outputIndex = 0;
+
+        const auto observer =
+            [&stateVectors, &indexes, &outputIndex](const StateVector& anOutputStateVector, const double& /*aTime*/)
+            -> void
+        {
+            if (outputIndex > 0)
+            {
+                stateVectors[indexes[outputIndex - 1]] = anOutputStateVector;
+            }
+
+            ++outputIndex;
+        };
+
+        const double signedTimeStep = aSignedTimeStep(direction);
+
+        withStepper_<StateVector>(
+            aStepperType,
+            anAbsoluteTolerance,
+            aRelativeTolerance,
+            [&](auto aStepper) -> void
+            {
+                integrate_times(
+                    makeProfiledStepper(aStepper, aStepCallback),
+                    aSystemOfEquations,
+                    stateVector,
+                    times.begin(),
+                    times.end(),
+                    signedTimeStep,
+                    observer
+                );
+            }
+        );
+    }
+
+    return stateVectors;
+}
+
+}  // namespace
+
+NumericalSolver::Profile::Timer::Timer()
+    : nanosecondCount_(0)
+{
+}
+
+void NumericalSolver::Profile::Timer::add(const std::chrono::nanoseconds& aDuration)
+{
+    nanosecondCount_.fetch_add(aDuration.count(), std::memory_order_relaxed);
+}
+
+Duration NumericalSolver::Profile::Timer::getDuration() const
+{
+    return Duration::Nanoseconds(static_cast<double>(nanosecondCount_.load(std::memory_order_relaxed)));
+}
+
+void NumericalSolver::Profile::Timer::reset()
+{
+    nanosecondCount_.store(0, std::memory_order_relaxed);
+}
+
+NumericalSolver::Profile::Profile()
+    : mutex_(),
+      solveCount_(0),
+      total_(),
+      contributionTimers_()
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const NumericalSolver::Profile& aProfile)
+{
+    aProfile.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+Size NumericalSolver::Profile::getSolveCount() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return solveCount_;
+}
+
+Size NumericalSolver::Profile::getEvaluationCount() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return total_.evaluationCount;
+}
+
+Size NumericalSolver::Profile::getAcceptedStepCount() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return total_.acceptedStepCount;
+}
+
+Size NumericalSolver::Profile::getRejectedStepCount() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return total_.rejectedStepCount;
+}
+
+Array<Real> NumericalSolver::Profile::getStepSizes() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return total_.stepSizes;
+}
+
+Duration NumericalSolver::Profile::getDuration() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return Duration::Nanoseconds(static_cast<double>(total_.duration.count()));
+}
+
+Duration NumericalSolver::Profile::getEvaluationDuration() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    return Duration::Nanoseconds(static_cast<double>(total_.evaluationDuration.count()));
+}
+
+Array<Pair<String, Duration>> NumericalSolver::Profile::getContributionDurations() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    Array<Pair<String, Duration>> contributionDurations;
+    contributionDurations.reserve(contributionTimers_.getSize());
+
+    for (const auto& contributionTimer : contributionTimers_)
+    {
+        contributionDurations.add({contributionTimer.first, contributionTimer.second->getDuration()});
+    }
+
+    return contributionDurations;
+}
+
+Shared<NumericalSolver::Profile::Timer> NumericalSolver::Profile::accessContributionTimer(const String& aName)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& contributionTimer : contributionTimers_)
+    {
+        if (contributionTimer.first == aName)
+        {
+            return contributionTimer.second;
+        }
+    }
+
+    const Shared<Timer> timerSPtr = std::make_shared<Timer>();
+
+    contributionTimers_.add({aName, timerSPtr});
+
+    return timerSPtr;
+}
+
+void NumericalSolver::Profile::add(const NumericalSolver::Profile::Record& aRecord)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    ++solveCount_;
+
+    total_.evaluationCount += aRecord.evaluationCount;
+    total_.acceptedStepCount += aRecord.acceptedStepCount;
+    total_.rejectedStepCount += aRecord.rejectedStepCount;
+    total_.stepSizes.add(aRecord.stepSizes);
+    total_.evaluationDuration += aRecord.evaluationDuration;
+    total_.duration += aRecord.duration;
+}
+
+void NumericalSolver::Profile::reset()
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    solveCount_ = 0;
+    total_ = {};
+
+    for (const auto& contributionTimer : contributionTimers_)
+    {
+        contributionTimer.second->reset();
+    }
+}
+
+void NumericalSolver::Profile::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Numerical Solver Profile") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Solve count:" << this->getSolveCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Evaluation count:" << this->getEvaluationCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Accepted step count:" << this->getAcceptedStepCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Rejected step count:" << this->getRejectedStepCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Duration:" << this->getDuration().toString();
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Evaluation duration:" << this->getEvaluationDuration().toString();
+
+    for (const auto& contributionDuration : this->getContributionDurations())
+    {
+        ostk::core::utils::Print::Line(anOutputStream)
+            << String::Format("{}:", contributionDuration.first) << contributionDuration.second.toString();
+    }
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
 NumericalSolver::NumericalSolver(
     const NumericalSolver::LogType& aLogType,
     const NumericalSolver::StepperType& aStepperType,
@@ -157,12 +843,172 @@ void NumericalSolver::setMaxStepSize(const Real& aMaxStepSize)
     maxStepSize_ = aMaxStepSize;
 }
 
+bool NumericalSolver::isDenseOutputEnabled() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return denseOutputEnabled_;
+}
+
+void NumericalSolver::setDenseOutputEnabled(const bool& isEnabled)
+{
+    if (isEnabled && (stepperType_ != StepperType::RungeKuttaDopri5) && (stepperType_ != StepperType::BulirschStoer))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Dense output is only supported with RungeKuttaDopri5 and BulirschStoer steppers."
+        );
+    }
+
+    if (isEnabled && gaussJacksonEnabled_)
+    {
+        throw ostk::core::error::RuntimeError("Dense output cannot be combined with Gauss-Jackson integration.");
+    }
+
+    if (isEnabled && sundmanExponent_.isDefined())
+    {
+        throw ostk::core::error::RuntimeError("Dense output cannot be combined with the Sundman transformation.");
+    }
+
+    denseOutputEnabled_ = isEnabled;
+}
+
+bool NumericalSolver::isGaussJacksonEnabled() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return gaussJacksonEnabled_;
+}
+
+void NumericalSolver::setGaussJacksonEnabled(const bool& isEnabled)
+{
+    if (isEnabled && denseOutputEnabled_)
+    {
+        throw ostk::core::error::RuntimeError("Gauss-Jackson integration cannot be combined with dense output.");
+    }
+
+    if (isEnabled && sundmanExponent_.isDefined())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Gauss-Jackson integration cannot be combined with the Sundman transformation."
+        );
+    }
+
+    gaussJacksonEnabled_ = isEnabled;
+}
+
+Real NumericalSolver::getSundmanExponent() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return sundmanExponent_;
+}
+
+void NumericalSolver::setSundmanExponent(const Real& aSundmanExponent)
+{
+    if (aSundmanExponent.isDefined())
+    {
+        if (!aSundmanExponent.isStrictlyPositive())
+        {
+            throw ostk::core::error::runtime::Wrong("Sundman exponent");
+        }
+
+        if ((stepperType_ == StepperType::AdamsBashforthMoulton5) ||
+            (stepperType_ == StepperType::AdamsBashforthMoulton8))
+        {
+            throw ostk::core::error::RuntimeError(
+                "The Sundman transformation is not supported with Adams-Bashforth-Moulton steppers."
+            );
+        }
+
+        if (denseOutputEnabled_)
+        {
+            throw ostk::core::error::RuntimeError("The Sundman transformation cannot be combined with dense output.");
+        }
+
+        if (gaussJacksonEnabled_)
+        {
+            throw ostk::core::error::RuntimeError(
+                "The Sundman transformation cannot be combined with Gauss-Jackson integration."
+            );
+        }
+    }
+
+    sundmanExponent_ = aSundmanExponent;
+}
+
+Shared<NumericalSolver::Profile> NumericalSolver::getProfile() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return profileSPtr_;
+}
+
+void NumericalSolver::setProfile(const Shared<NumericalSolver::Profile>& aProfileSPtr)
+{
+    profileSPtr_ = aProfileSPtr;
+}
+
+template <typename SystemOfEquations>
+SystemOfEquations NumericalSolver::profileSystemOfEquations(const SystemOfEquations& aSystemOfEquations)
+{
+    if (profileSPtr_ == nullptr)
+    {
+        return aSystemOfEquations;
+    }
+
+    return [this, aSystemOfEquations](const auto& x, auto& dxdt, const double t) -> void
+    {
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        aSystemOfEquations(x, dxdt, t);
+
+        profileRecord_.evaluationDuration += std::chrono::steady_clock::now() - startTime;
+        ++profileRecord_.evaluationCount;
+    };
+}
+
+void NumericalSolver::profileStep(const double& aStepSize, const Size& aRejectedStepCount)
+{
+    if (profileSPtr_ == nullptr)
+    {
+        return;
+    }
+
+    ++profileRecord_.acceptedStepCount;
+    profileRecord_.rejectedStepCount += aRejectedStepCount;
+    profileRecord_.stepSizes.add(aStepSize);
+}
+
+bool NumericalSolver::fixedSizeIntegrationIsSpecialized() const
+{
+    return !denseOutputEnabled_ && !gaussJacksonEnabled_ && !sundmanExponent_.isDefined() &&
+           (getLogType() == NumericalSolver::LogType::NoLog) &&
+           (stepperType_ != StepperType::AdamsBashforthMoulton5) &&
+           (stepperType_ != StepperType::AdamsBashforthMoulton8);
+}
+
 Array<State> NumericalSolver::integrateTime(
     const State& aState,
     const Array<Instant>& anInstantArray,
     const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
 )
 {
+    const ProfiledSolve profiledSolve = {profileSPtr_, profileRecord_};
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->profileSystemOfEquations(aSystemOfEquations);
+
     const Array<Real> durationArray = anInstantArray.map<Real>(
         [&aState](const Instant& anInstant) -> Real
         {
@@ -170,17 +1016,36 @@ Array<State> NumericalSolver::integrateTime(
         }
     );
 
-    const Array<NumericalSolver::Solution> solutions =
-        MathNumericalSolver::integrateDuration(aState.accessCoordinates(), durationArray, aSystemOfEquations);
+    Array<NumericalSolver::StateVector> stateVectors;
+
+    if (denseOutputEnabled_)
+    {
+        stateVectors =
+            this->integrateDurationWithDenseOutput(aState.accessCoordinates(), durationArray, systemOfEquations);
+    }
+    else if (gaussJacksonEnabled_)
+    {
+        stateVectors =
+            this->integrateDurationWithGaussJackson(aState.accessCoordinates(), durationArray, systemOfEquations);
+    }
+    else if (sundmanExponent_.isDefined())
+    {
+        stateVectors = this->integrateDurationWithSundmanTransformation(
+            aState.accessCoordinates(), durationArray, systemOfEquations
+        );
+    }
+    else
+    {
+        stateVectors = this->integrateDurationWithStepper(aState.accessCoordinates(), durationArray, systemOfEquations);
+    }
 
     Array<State> states;
-    states.reserve(solutions.getSize());
-    for (Index i = 0; i < solutions.getSize(); ++i)
+    states.reserve(stateVectors.getSize());
+    for (Index i = 0; i < stateVectors.getSize(); ++i)
     {
-        const NumericalSolver::Solution& solution = solutions.at(i);
         const State state = {
             anInstantArray[i],
-            solution.first,
+            stateVectors.at(i),
             aState.accessFrame(),
             aState.accessCoordinateBroker(),
         };
@@ -194,22 +1059,94 @@ State NumericalSolver::integrateTime(
     const State& aState, const Instant& anEndTime, const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
 )
 {
+    const ProfiledSolve profiledSolve = {profileSPtr_, profileRecord_};
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->profileSystemOfEquations(aSystemOfEquations);
+
     observedStates_ = {};
 
     const StateBuilder stateBuilder = {aState};
 
+    if (gaussJacksonEnabled_ || sundmanExponent_.isDefined())
+    {
+        const Array<Real> durationArray = {(anEndTime - aState.accessInstant()).inSeconds()};
+
+        const Array<NumericalSolver::StateVector> stateVectors =
+            gaussJacksonEnabled_
+                ? this->integrateDurationWithGaussJackson(aState.accessCoordinates(), durationArray, systemOfEquations)
+                : this->integrateDurationWithSundmanTransformation(
+                      aState.accessCoordinates(), durationArray, systemOfEquations
+                  );
+        const NumericalSolver::StateVector& stateVector = stateVectors[0];
+
+        observedStates_ = {aState};
+
+        const State endState = stateBuilder.build(anEndTime, stateVector);
+
+        if (anEndTime != aState.accessInstant())
+        {
+            observedStates_.add(endState);
+        }
+
+        return endState;
+    }
+
     const NumericalSolver::Solution solution = MathNumericalSolver::integrateDuration(
-        aState.accessCoordinates(), (anEndTime - aState.accessInstant()).inSeconds(), aSystemOfEquations
+        aState.accessCoordinates(), (anEndTime - aState.accessInstant()).inSeconds(), systemOfEquations
     );
 
-    for (const auto& state : MathNumericalSolver::getObservedStateVectors())
+    const Array<NumericalSolver::Solution>& observedStateVectors = MathNumericalSolver::getObservedStateVectors();
+
+    for (const auto& state : observedStateVectors)
     {
         observedStates_.add(stateBuilder.build(aState.accessInstant() + Duration::Seconds(state.second), state.first));
     }
 
+    // The accepted steps are the ones between observed states, the rejected ones are not exposed by the integrator
+    for (Index i = 1; i < observedStateVectors.getSize(); ++i)
+    {
+        this->profileStep(observedStateVectors[i].second - observedStateVectors[i - 1].second, 0);
+    }
+
     return stateBuilder.build(anEndTime, solution.first);
 }
 
+Array<NumericalSolver::StateVector> NumericalSolver::integrateBatchTime(
+    const NumericalSolver::StateVector& aBatchStateVector,
+    const Instant& aStartInstant,
+    const Array<Instant>& anInstantArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    const ProfiledSolve profiledSolve = {profileSPtr_, profileRecord_};
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->profileSystemOfEquations(aSystemOfEquations);
+
+    const Array<Real> durationArray = anInstantArray.map<Real>(
+        [&aStartInstant](const Instant& anInstant) -> Real
+        {
+            return (anInstant - aStartInstant).inSeconds();
+        }
+    );
+
+    if (denseOutputEnabled_)
+    {
+        return this->integrateDurationWithDenseOutput(aBatchStateVector, durationArray, systemOfEquations);
+    }
+
+    if (gaussJacksonEnabled_)
+    {
+        return this->integrateDurationWithGaussJackson(aBatchStateVector, durationArray, systemOfEquations);
+    }
+
+    if (sundmanExponent_.isDefined())
+    {
+        return this->integrateDurationWithSundmanTransformation(aBatchStateVector, durationArray, systemOfEquations);
+    }
+
+    return this->integrateDurationWithStepper(aBatchStateVector, durationArray, systemOfEquations);
+}
+
 NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
     const State& aState,
     const Instant& anInstant,
@@ -223,7 +1160,8 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
     // at every bracket. Combined with tight integration tolerances and discontinuous dynamics
     // (e.g. thrust events) this drives the accepted step size near zero and makes the run
     // effectively non-terminating. Callers should select a Runge-Kutta or Bulirsch-Stoer stepper.
-    if (stepperType_ == StepperType::AdamsBashforthMoulton5 || stepperType_ == StepperType::AdamsBashforthMoulton8)
+    if (!gaussJacksonEnabled_ &&
+        (stepperType_ == StepperType::AdamsBashforthMoulton5 || stepperType_ == StepperType::AdamsBashforthMoulton8))
     {
         throw ostk::core::error::RuntimeError(
             "Conditional integration is not supported with Adams-Bashforth-Moulton steppers "
@@ -232,6 +1170,10 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
         );
     }
 
+    const ProfiledSolve profiledSolve = {profileSPtr_, profileRecord_};
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->profileSystemOfEquations(aSystemOfEquations);
+
     observedStates_ = {aState};
 
     const Real aDurationInSeconds = (anInstant - aState.accessInstant()).inSeconds();
@@ -258,7 +1200,7 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
         };
     }
 
-    return integrateTimeWithControlledStepper(aState, anInstant, aSystemOfEquations, anEventCondition);
+    return integrateTimeWithControlledStepper(aState, anInstant, systemOfEquations, anEventCondition);
 }
 
 NumericalSolver NumericalSolver::Undefined()
@@ -355,6 +1297,244 @@ NumericalSolver::NumericalSolver(
 {
 }
 
+Array<NumericalSolver::StateVector> NumericalSolver::integrateDurationWithStepper(
+    const NumericalSolver::StateVector& aStateVector,
+    const Array<Real>& aDurationArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    // The mathematics library logs the steps, and provides the Adams-Bashforth-Moulton steppers
+    if ((getLogType() != NumericalSolver::LogType::NoLog) || (stepperType_ == StepperType::AdamsBashforthMoulton5) ||
+        (stepperType_ == StepperType::AdamsBashforthMoulton8))
+    {
+        return MathNumericalSolver::integrateDuration(aStateVector, aDurationArray, aSystemOfEquations)
+            .map<NumericalSolver::StateVector>(
+                [](const NumericalSolver::Solution& aSolution) -> NumericalSolver::StateVector
+                {
+                    return aSolution.first;
+                }
+            );
+    }
+
+    return integrateDurations_<NumericalSolver::StateVector>(
+        aStateVector,
+        aDurationArray,
+        aSystemOfEquations,
+        stepperType_,
+        static_cast<double>(absoluteTolerance_),
+        static_cast<double>(relativeTolerance_),
+        [this](const double& aDirection) -> double
+        {
+            return this->getSignedTimeStep(aDirection);
+        },
+        [this](const double& aStepSize, const Size& aRejectedStepCount) -> void
+        {
+            this->profileStep(aStepSize, aRejectedStepCount);
+        }
+    );
+}
+
+Array<NumericalSolver::StateVector> NumericalSolver::integrateDurationWithDenseOutput(
+    const NumericalSolver::StateVector& aStateVector,
+    const Array<Real>& aDurationArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    Array<NumericalSolver::StateVector> stateVectors =
+        Array<NumericalSolver::StateVector>(aDurationArray.getSize(), aStateVector);
+
+    const auto stepCallback = [this](const double& aStepSize, const Size& aRejectedStepCount) -> void
+    {
+        this->profileStep(aStepSize, aRejectedStepCount);
+    };
+
+    for (const double direction : {1.0, -1.0})
+    {
+        std::vector<Index> indexes;
+        indexes.reserve(aDurationArray.getSize());
+
+        for (Index i = 0; i < aDurationArray.getSize(); ++i)
+        {
+            const double duration = aDurationArray[i];
+
+            if ((direction > 0.0) ? (duration > 0.0) : (duration < 0.0))
+            {
+                indexes.push_back(i);
+            }
+        }
+
+        if (indexes.empty())
+        {
+            continue;
+        }
+
+        std::stable_sort(
+            indexes.begin(),
+            indexes.end(),
+            [&aDurationArray, direction](const Index& anIndex, const Index& anotherIndex) -> bool
+            {
+                return (direction * aDurationArray[anIndex]) < (direction * aDurationArray[anotherIndex]);
+            }
+        );
+
+        // The dense-output stepper is initialized at the first time of the sequence, hence the leading zero
+        std::vector<double> times;
+        times.reserve(indexes.size() + 1);
+        times.push_back(0.0);
+
+        for (const Index& index : indexes)
+        {
+            times.push_back(aDurationArray[index]);
+        }
+
+        NumericalSolver::StateVector stateVector = aStateVector;
+        Index outputIndex = 0;
+
+        const auto observer = [&stateVectors, &indexes, &outputIndex](
+                                  const NumericalSolver::StateVector& anOutputStateVector, const double& /*aTime*/
+                              ) -> void
+        {
+            if (outputIndex > 0)
+            {
+                stateVectors[indexes[outputIndex - 1]] = anOutputStateVector;
+            }
+
+            ++outputIndex;
+        };
+
+        const double signedTimeStep = getSignedTimeStep(times.back());
+
+        const auto integrate = [&](auto aStepper) -> void
+        {
+            integrate_times(
+                makeProfiledStepper(aStepper, stepCallback),
+                aSystemOfEquations,
+                stateVector,
+                times.begin(),
+                times.end(),
+                signedTimeStep,
+                observer
+            );
+        };
+
+        switch (stepperType_)
+        {
+            case StepperType::RungeKuttaDopri5:
+            {
+                if (maxStepSize_.isDefined())
+                {
+                    integrate(make_dense_output(
+                        static_cast<double>(absoluteTolerance_),
+                        static_cast<double>(relativeTolerance_),
+                        static_cast<double>(maxStepSize_),
+                        runge_kutta_dopri5<NumericalSolver::StateVector>()
+                    ));
+                }
+                else
+                {
+                    integrate(make_dense_output(
+                        static_cast<double>(absoluteTolerance_),
+                        static_cast<double>(relativeTolerance_),
+                        runge_kutta_dopri5<NumericalSolver::StateVector>()
+                    ));
+                }
+
+                break;
+            }
+
+            case StepperType::BulirschStoer:
+            {
+                integrate(bulirsch_stoer_dense_out<NumericalSolver::StateVector>(
+                    static_cast<double>(absoluteTolerance_), static_cast<double>(relativeTolerance_)
+                ));
+
+                break;
+            }
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Stepper type");
+        }
+    }
+
+    return stateVectors;
+}
+
+Array<NumericalSolver::StateVector> NumericalSolver::integrateDurationWithGaussJackson(
+    const NumericalSolver::StateVector& aStateVector,
+    const Array<Real>& aDurationArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    Array<NumericalSolver::StateVector> stateVectors =
+        Array<NumericalSolver::StateVector>(aDurationArray.getSize(), aStateVector);
+
+    for (const double direction : {1.0, -1.0})
+    {
+        std::vector<Index> indexes;
+        indexes.reserve(aDurationArray.getSize());
+
+        for (Index i = 0; i < aDurationArray.getSize(); ++i)
+        {
+            const double duration = aDurationArray[i];
+
+            if ((direction > 0.0) ? (duration > 0.0) : (duration < 0.0))
+            {
+                indexes.push_back(i);
+            }
+        }
+
+        if (indexes.empty())
+        {
+            continue;
+        }
+
+        std::stable_sort(
+            indexes.begin(),
+            indexes.end(),
+            [&aDurationArray, direction](const Index& anIndex, const Index& anotherIndex) -> bool
+            {
+                return (direction * aDurationArray[anIndex]) < (direction * aDurationArray[anotherIndex]);
+            }
+        );
+
+        const double signedTimeStep = getSignedTimeStep(direction);
+
+        GaussJacksonStepper stepper = {
+            signedTimeStep, static_cast<double>(absoluteTolerance_), static_cast<double>(relativeTolerance_)
+        };
+
+        NumericalSolver::StateVector stateVector = aStateVector;
+        double time = 0.0;
+
+        for (const Index& index : indexes)
+        {
+            const double duration = aDurationArray[index];
+
+            // March on the fixed step grid up to the last node before the duration
+            while ((direction * (duration - time)) >= (std::abs(signedTimeStep) - 1e-9))
+            {
+                stepper.doStep(aSystemOfEquations, stateVector, time);
+
+                this->profileStep(signedTimeStep, 0);
+            }
+
+            // Reach the duration from that node with the starter, without disturbing the multistep history
+            NumericalSolver::StateVector outputStateVector = stateVector;
+
+            if (std::abs(duration - time) > 1e-9)
+            {
+                integrate_adaptive(
+                    stepper.accessStarter(), aSystemOfEquations, outputStateVector, time, duration, duration - time
+                );
+            }
+
+            stateVectors[index] = outputStateVector;
+        }
+    }
+
+    return stateVectors;
+}
+
 void NumericalSolver::observeState(const State& aState)
 {
     observedStates_.add(aState);
@@ -379,26 +1559,48 @@ struct IsFixedStepStepper<stepper_type_4> : std::true_type
 {
 };
 
-/// @brief Perform a single integration step with a fixed-step stepper
+/// @brief Perform a single integration step with a fixed-step stepper. Returns the number of rejected tries (none).
 template <typename Stepper, typename System>
-inline typename std::enable_if<IsFixedStepStepper<Stepper>::value>::type doStep(
+inline typename std::enable_if<IsFixedStepStepper<Stepper>::value, Size>::type doStep(
     Stepper& stepper, const System& system, NumericalSolver::StateVector& stateVector, double& currentTime, double& dt
 )
 {
     stepper.do_step(system, stateVector, currentTime, dt);
     currentTime += dt;
+
+    return 0;
 }
 
-/// @brief Perform a single integration step with a controlled stepper (retries until accepted)
+/// @brief Perform a single integration step with a controlled stepper (retries until accepted). Returns the number
+///        of rejected tries.
 template <typename Stepper, typename System>
-inline typename std::enable_if<!IsFixedStepStepper<Stepper>::value>::type doStep(
+inline typename std::enable_if<!IsFixedStepStepper<Stepper>::value, Size>::type doStep(
     Stepper& stepper, const System& system, NumericalSolver::StateVector& stateVector, double& currentTime, double& dt
 )
 {
+    Size rejectedStepCount = 0;
+
     while (stepper.try_step(system, stateVector, currentTime, dt) ==
            boost::numeric::odeint::controlled_step_result::fail)
     {
+        ++rejectedStepCount;
     }
+
+    return rejectedStepCount;
+}
+
+/// @brief Perform a single fixed step with the Gauss-Jackson stepper. Returns the number of rejected tries (none).
+inline Size doStep(
+    GaussJacksonStepper& stepper,
+    const NumericalSolver::SystemOfEquationsWrapper& system,
+    NumericalSolver::StateVector& stateVector,
+    double& currentTime,
+    [[maybe_unused]] double& dt
+)
+{
+    stepper.doStep(system, stateVector, currentTime);
+
+    return 0;
 }
 
 /// @brief Integrate adaptively to a target time. Used for the trim integration after the main
@@ -414,6 +1616,296 @@ inline void integrateToTime_(
     integrate_adaptive(stepper, system, stateVector, startTime, endTime, stepSize);
 }
 
+/// @brief Integrate to a target time off the Gauss-Jackson fixed step grid, with its starter
+inline void integrateToTime_(
+    GaussJacksonStepper& stepper,
+    NumericalSolver::StateVector& stateVector,
+    double startTime,
+    double endTime,
+    const NumericalSolver::SystemOfEquationsWrapper& system
+)
+{
+    GaussJacksonStepper::Starter starter = stepper.accessStarter();
+    integrateToTime_(starter, stateVector, startTime, endTime, system);
+}
+
+/// @brief Sample the solution at the given times, starting from the given state
+template <typename Stepper, typename Observer>
+inline void integrateTimes_(
+    Stepper& stepper,
+    const NumericalSolver::SystemOfEquationsWrapper& system,
+    NumericalSolver::StateVector& stateVector,
+    const VectorXd& times,
+    double dt,
+    Observer observer
+)
+{
+    integrate_times(stepper, system, stateVector, times.begin(), times.end(), dt, observer);
+}
+
+/// @brief Sample the solution at the given times with the Gauss-Jackson starter, as the samples are off the grid
+template <typename Observer>
+inline void integrateTimes_(
+    GaussJacksonStepper& stepper,
+    const NumericalSolver::SystemOfEquationsWrapper& system,
+    NumericalSolver::StateVector& stateVector,
+    const VectorXd& times,
+    double dt,
+    Observer observer
+)
+{
+    integrate_times(stepper.accessStarter(), system, stateVector, times.begin(), times.end(), dt, observer);
+}
+
+/// @brief Stepper taking the steps of an underlying stepper in the Sundman regularized independent variable s, with
+///        dt/ds = (r / r0)^α, r being the norm of the first three coordinates and r0 its initial value.
+///
+/// @details The time is appended to the state and integrated alongside it. Step sizes are exchanged in time with the
+/// caller, so that they can be limited as for the other steppers, and instants between steps are reached by
+/// integrating in time with a copy of the underlying stepper.
+template <typename Stepper>
+class SundmanStepper
+{
+   public:
+    SundmanStepper(
+        const Stepper& aStepper, const double& anExponent, const NumericalSolver::StateVector& anInitialStateVector
+    )
+        : stepper_(aStepper),
+          regularizedStepper_(aStepper),
+          exponent_(anExponent),
+          initialRadius_(0.0)
+    {
+        if (anInitialStateVector.size() < 3)
+        {
+            throw ostk::core::error::RuntimeError(
+                "The Sundman transformation requires the first three coordinates to be a position."
+            );
+        }
+
+        initialRadius_ = anInitialStateVector.head(3).norm();
+
+        if (!(initialRadius_ > 0.0))
+        {
+            throw ostk::core::error::RuntimeError("The Sundman transformation requires a non-zero initial position.");
+        }
+    }
+
+    /// @brief Underlying stepper, to integrate in time
+    const Stepper& accessStepper() const
+    {
+        return stepper_;
+    }
+
+    template <typename System>
+    Size step(const System& aSystem, NumericalSolver::StateVector& aStateVector, double& aTime, double& aTimeStep)
+    {
+        const Eigen::Index size = aStateVector.size();
+
+        augmentedStateVector_.resize(size + 1);
+        augmentedStateVector_ << aStateVector, aTime;
+        derivative_.resize(size);
+
+        const auto regularizedSystem = [this, &aSystem, size](
+                                           const NumericalSolver::StateVector& anAugmentedStateVector,
+                                           NumericalSolver::StateVector& anAugmentedDerivative,
+                                           const double /*anIndependentVariable*/
+                                       ) -> void
+        {
+            stateVector_ = anAugmentedStateVector.head(size);
+
+            aSystem(stateVector_, derivative_, anAugmentedStateVector[size]);
+
+            const double timeDerivative = this->calculateTimeDerivative(stateVector_);
+
+            anAugmentedDerivative.head(size) = timeDerivative * derivative_;
+            anAugmentedDerivative[size] = timeDerivative;
+        };
+
+        // The system is autonomous in s, which can then restart from zero at every step
+        double independentVariable = 0.0;
+        double independentVariableStep = aTimeStep / this->calculateTimeDerivative(aStateVector);
+
+        const Size rejectedStepCount = doStep(
+            regularizedStepper_, regularizedSystem, augmentedStateVector_, independentVariable, independentVariableStep
+        );
+
+        aStateVector = augmentedStateVector_.head(size);
+        aTime = augmentedStateVector_[size];
+        aTimeStep = independentVariableStep * this->calculateTimeDerivative(aStateVector);
+
+        return rejectedStepCount;
+    }
+
+   private:
+    Stepper stepper_;
+    Stepper regularizedStepper_;
+    double exponent_;
+    double initialRadius_;
+
+    NumericalSolver::StateVector augmentedStateVector_;
+    NumericalSolver::StateVector stateVector_;
+    NumericalSolver::StateVector derivative_;
+
+    double calculateTimeDerivative(const NumericalSolver::StateVector& aStateVector) const
+    {
+        return std::pow(aStateVector.head(3).norm() / initialRadius_, exponent_);
+    }
+};
+
+/// @brief Perform a single step in the Sundman regularized independent variable. Returns the number of rejected tries.
+template <typename Stepper, typename System>
+inline Size doStep(
+    SundmanStepper<Stepper>& stepper,
+    const System& system,
+    NumericalSolver::StateVector& stateVector,
+    double& currentTime,
+    double& dt
+)
+{
+    return stepper.step(system, stateVector, currentTime, dt);
+}
+
+/// @brief Integrate to a target time between Sundman steps, in time with the underlying stepper
+template <typename Stepper, typename System>
+inline void integrateToTime_(
+    SundmanStepper<Stepper>& stepper,
+    NumericalSolver::StateVector& stateVector,
+    double startTime,
+    double endTime,
+    const System& system
+)
+{
+    Stepper timeStepper = stepper.accessStepper();
+    integrateToTime_(timeStepper, stateVector, startTime, endTime, system);
+}
+
+/// @brief Sample the solution at the given times between Sundman steps, in time with the underlying stepper
+template <typename Stepper, typename Observer>
+inline void integrateTimes_(
+    SundmanStepper<Stepper>& stepper,
+    const NumericalSolver::SystemOfEquationsWrapper& system,
+    NumericalSolver::StateVector& stateVector,
+    const VectorXd& times,
+    double dt,
+    Observer observer
+)
+{
+    Stepper timeStepper = stepper.accessStepper();
+    integrateTimes_(timeStepper, system, stateVector, times, dt, observer);
+}
+
+template <typename Stepper>
+inline SundmanStepper<Stepper> makeSundmanStepper(
+    const Stepper& aStepper, const double& anExponent, const NumericalSolver::StateVector& anInitialStateVector
+)
+{
+    return {aStepper, anExponent, anInitialStateVector};
+}
+
+/// @brief Call a function with a Sundman stepper wrapping a stepper of the given type
+template <typename Function>
+inline auto withSundmanStepper_(
+    const NumericalSolver::StepperType& aStepperType,
+    const double& anAbsoluteTolerance,
+    const double& aRelativeTolerance,
+    const double& anExponent,
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Function& aFunction
+)
+{
+    using StepperType = NumericalSolver::StepperType;
+
+    switch (aStepperType)
+    {
+        case StepperType::RungeKutta4:
+        {
+            auto stepper = makeSundmanStepper(stepper_type_4 {}, anExponent, anInitialStateVector);
+            return aFunction(stepper);
+        }
+
+        case StepperType::RungeKuttaCashKarp54:
+        {
+            auto stepper = makeSundmanStepper(
+                make_controlled(
+                    anAbsoluteTolerance,
+                    aRelativeTolerance,
+                    runge_kutta_cash_karp54<NumericalSolver::StateVector>()
+                ),
+                anExponent,
+                anInitialStateVector
+            );
+            return aFunction(stepper);
+        }
+
+        case StepperType::RungeKuttaFehlberg78:
+        {
+            auto stepper = makeSundmanStepper(
+                make_controlled(
+                    anAbsoluteTolerance, aRelativeTolerance, runge_kutta_fehlberg78<NumericalSolver::StateVector>()
+                ),
+                anExponent,
+                anInitialStateVector
+            );
+            return aFunction(stepper);
+        }
+
+        case StepperType::RungeKuttaDopri5:
+        {
+            auto stepper = makeSundmanStepper(
+                make_controlled(
+                    anAbsoluteTolerance, aRelativeTolerance, runge_kutta_dopri5<NumericalSolver::StateVector>()
+                ),
+                anExponent,
+                anInitialStateVector
+            );
+            return aFunction(stepper);
+        }
+
+        case StepperType::BulirschStoer:
+        {
+            auto stepper = makeSundmanStepper(
+                bulirsch_stoer<NumericalSolver::StateVector>(anAbsoluteTolerance, aRelativeTolerance),
+                anExponent,
+                anInitialStateVector
+            );
+            return aFunction(stepper);
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+    }
+}
+
+/// @brief Wrap a system of equations on fixed size state vectors into one on dynamic size state vectors
+template <Size N>
+inline NumericalSolver::SystemOfEquationsWrapper dynamicSizeSystemOfEquations_(
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<N>& aSystemOfEquations
+)
+{
+    return [aSystemOfEquations](
+               const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+           ) -> void
+    {
+        const NumericalSolver::FixedSizeStateVector<N> fixedSizeStateVector = x;
+        NumericalSolver::FixedSizeStateVector<N> fixedSizeDerivative;
+
+        aSystemOfEquations(fixedSizeStateVector, fixedSizeDerivative, t);
+
+        dxdt = fixedSizeDerivative;
+    };
+}
+
+/// @brief Check that a state has the size of fixed size integration
+inline void validateFixedSize_(const State& aState, const Size& aSize)
+{
+    if (aState.getSize() != aSize)
+    {
+        throw ostk::core::error::RuntimeError(
+            "State size [{}] does not match the fixed integration size [{}].", aState.getSize(), aSize
+        );
+    }
+}
+
 }  // namespace
 
 template <typename Stepper>
@@ -471,7 +1963,9 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTimeWithStepperImpl
         const double maxDt = std::min(remainingAbs + stepSignAbs, maxStepSizeDouble);
         dt = std::clamp(dt, -maxDt, maxDt);
 
-        doStep(aStepper, aSystemOfEquations, currentStateVector, currentTime, dt);
+        const Size rejectedStepCount = doStep(aStepper, aSystemOfEquations, currentStateVector, currentTime, dt);
+
+        this->profileStep(currentTime - previousTime, rejectedStepCount);
 
         currentState = createState(currentStateVector, currentTime);
 
@@ -492,7 +1986,7 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTimeWithStepperImpl
         // integrate_adaptive with a zero-length window and have boost odeint reject the request.
         if (std::abs(endTime - currentTime) > 1e-12)
         {
-            integrateToTime_<Stepper>(aStepper, currentStateVector, currentTime, endTime, aSystemOfEquations);
+            integrateToTime_(aStepper, currentStateVector, currentTime, endTime, aSystemOfEquations);
         }
 
         const State finalState = createState(currentStateVector, endTime);
@@ -538,15 +2032,7 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTimeWithStepperImpl
     };
 
     const double initialDt = signedSampleDt / 10.0;
-    integrate_times(
-        aStepper,
-        aSystemOfEquations,
-        previousStateVector,
-        sampleTimes.begin(),
-        sampleTimes.end(),
-        initialDt,
-        sampleObserver
-    );
+    integrateTimes_(aStepper, aSystemOfEquations, previousStateVector, sampleTimes, initialDt, sampleObserver);
 
     // CubicSpline (boost cardinal_cubic_b_spline) requires h > 0 and ascending x. For backward
     // integration the samples are in descending time order — reverse them so the spline sees an
@@ -653,6 +2139,25 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTimeWithControlledS
         );
     };
 
+    if (gaussJacksonEnabled_)
+    {
+        return dispatch(GaussJacksonStepper {
+            signedTimeStep, static_cast<double>(absoluteTolerance_), static_cast<double>(relativeTolerance_)
+        });
+    }
+
+    if (sundmanExponent_.isDefined())
+    {
+        return withSundmanStepper_(
+            stepperType_,
+            static_cast<double>(absoluteTolerance_),
+            static_cast<double>(relativeTolerance_),
+            static_cast<double>(sundmanExponent_),
+            aState.accessCoordinates(),
+            dispatch
+        );
+    }
+
     switch (stepperType_)
     {
         case StepperType::RungeKutta4:
@@ -680,6 +2185,240 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTimeWithControlledS
     }
 }
 
+Array<NumericalSolver::StateVector> NumericalSolver::integrateDurationWithSundmanTransformation(
+    const NumericalSolver::StateVector& aStateVector,
+    const Array<Real>& aDurationArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    Array<NumericalSolver::StateVector> stateVectors =
+        Array<NumericalSolver::StateVector>(aDurationArray.getSize(), aStateVector);
+
+    for (const double direction : {1.0, -1.0})
+    {
+        std::vector<Index> indexes;
+        indexes.reserve(aDurationArray.getSize());
+
+        for (Index i = 0; i < aDurationArray.getSize(); ++i)
+        {
+            const double duration = aDurationArray[i];
+
+            if ((direction > 0.0) ? (duration > 0.0) : (duration < 0.0))
+            {
+                indexes.push_back(i);
+            }
+        }
+
+        if (indexes.empty())
+        {
+            continue;
+        }
+
+        std::stable_sort(
+            indexes.begin(),
+            indexes.end(),
+            [&aDurationArray, direction](const Index& anIndex, const Index& anotherIndex) -> bool
+            {
+                return (direction * aDurationArray[anIndex]) < (direction * aDurationArray[anotherIndex]);
+            }
+        );
+
+        const double signedTimeStep = getSignedTimeStep(direction);
+
+        const auto integrate = [&](auto& aStepper) -> void
+        {
+            NumericalSolver::StateVector stateVector = aStateVector;
+            NumericalSolver::StateVector previousStateVector = aStateVector;
+            double time = 0.0;
+            double previousTime = 0.0;
+            double dt = signedTimeStep;
+
+            for (const Index& index : indexes)
+            {
+                const double duration = aDurationArray[index];
+
+                while ((direction * (duration - time)) > 0.0)
+                {
+                    previousStateVector = stateVector;
+                    previousTime = time;
+
+                    const Size rejectedStepCount = doStep(aStepper, aSystemOfEquations, stateVector, time, dt);
+
+                    this->profileStep(time - previousTime, rejectedStepCount);
+                }
+
+                // Reach the duration in time from the last step before it
+                NumericalSolver::StateVector outputStateVector = stateVector;
+
+                if (duration != time)
+                {
+                    outputStateVector = previousStateVector;
+                    integrateToTime_(aStepper, outputStateVector, previousTime, duration, aSystemOfEquations);
+                }
+
+                stateVectors[index] = outputStateVector;
+            }
+        };
+
+        withSundmanStepper_(
+            stepperType_,
+            static_cast<double>(absoluteTolerance_),
+            static_cast<double>(relativeTolerance_),
+            static_cast<double>(sundmanExponent_),
+            aStateVector,
+            integrate
+        );
+    }
+
+    return stateVectors;
+}
+
+template <Size N>
+Array<State> NumericalSolver::integrateTime(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<N>& aSystemOfEquations
+)
+{
+    validateFixedSize_(aState, N);
+
+    if (!this->fixedSizeIntegrationIsSpecialized())
+    {
+        return this->integrateTime(aState, anInstantArray, dynamicSizeSystemOfEquations_<N>(aSystemOfEquations));
+    }
+
+    const ProfiledSolve profiledSolve = {profileSPtr_, profileRecord_};
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<N> systemOfEquations =
+        this->profileSystemOfEquations(aSystemOfEquations);
+
+    const Array<Real> durationArray = anInstantArray.map<Real>(
+        [&aState](const Instant& anInstant) -> Real
+        {
+            return (anInstant - aState.accessInstant()).inSeconds();
+        }
+    );
+
+    const Array<NumericalSolver::FixedSizeStateVector<N>> stateVectors =
+        integrateDurations_<NumericalSolver::FixedSizeStateVector<N>>(
+            aState.accessCoordinates(),
+            durationArray,
+            systemOfEquations,
+            stepperType_,
+            static_cast<double>(absoluteTolerance_),
+            static_cast<double>(relativeTolerance_),
+            [this](const double& aDirection) -> double
+            {
+                return this->getSignedTimeStep(aDirection);
+            },
+            [this](const double& aStepSize, const Size& aRejectedStepCount) -> void
+            {
+                this->profileStep(aStepSize, aRejectedStepCount);
+            }
+        );
+
+    Array<State> states;
+    states.reserve(stateVectors.getSize());
+
+    for (Index i = 0; i < stateVectors.getSize(); ++i)
+    {
+        const State state = {
+            anInstantArray[i],
+            VectorXd(stateVectors[i]),
+            aState.accessFrame(),
+            aState.accessCoordinateBroker(),
+        };
+        states.add(state);
+    }
+
+    return states;
+}
+
+template <Size N>
+State NumericalSolver::integrateTime(
+    const State& aState,
+    const Instant& anEndTime,
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<N>& aSystemOfEquations
+)
+{
+    validateFixedSize_(aState, N);
+
+    if (!this->fixedSizeIntegrationIsSpecialized())
+    {
+        return this->integrateTime(aState, anEndTime, dynamicSizeSystemOfEquations_<N>(aSystemOfEquations));
+    }
+
+    const ProfiledSolve profiledSolve = {profileSPtr_, profileRecord_};
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<N> systemOfEquations =
+        this->profileSystemOfEquations(aSystemOfEquations);
+
+    observedStates_ = {aState};
+
+    const double duration = (anEndTime - aState.accessInstant()).inSeconds();
+
+    if (duration == 0.0)
+    {
+        return aState;
+    }
+
+    const StateBuilder stateBuilder = {aState};
+
+    NumericalSolver::FixedSizeStateVector<N> stateVector = aState.accessCoordinates();
+    double previousTime = 0.0;
+
+    const auto observer = [this, &aState, &stateBuilder, &previousTime](
+                              const NumericalSolver::FixedSizeStateVector<N>& anObservedStateVector,
+                              const double& aTime
+                          ) -> void
+    {
+        if (aTime == previousTime)
+        {
+            return;
+        }
+
+        observedStates_.add(
+            stateBuilder.build(aState.accessInstant() + Duration::Seconds(aTime), VectorXd(anObservedStateVector))
+        );
+
+        this->profileStep(aTime - previousTime, 0);
+
+        previousTime = aTime;
+    };
+
+    const double signedTimeStep = getSignedTimeStep(duration);
+
+    withStepper_<NumericalSolver::FixedSizeStateVector<N>>(
+        stepperType_,
+        static_cast<double>(absoluteTolerance_),
+        static_cast<double>(relativeTolerance_),
+        [&](auto aStepper) -> void
+        {
+            integrate_adaptive(aStepper, systemOfEquations, stateVector, 0.0, duration, signedTimeStep, observer);
+        }
+    );
+
+    return stateBuilder.build(anEndTime, VectorXd(stateVector));
+}
+
+template Array<State> NumericalSolver::integrateTime<6>(
+    const State&, const Array<Instant>&, const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6>&
+);
+template Array<State> NumericalSolver::integrateTime<7>(
+    const State&, const Array<Instant>&, const NumericalSolver::FixedSizeSystemOfEquationsWrapper<7>&
+);
+template Array<State> NumericalSolver::integrateTime<8>(
+    const State&, const Array<Instant>&, const NumericalSolver::FixedSizeSystemOfEquationsWrapper<8>&
+);
+
+template State NumericalSolver::integrateTime<6>(
+    const State&, const Instant&, const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6>&
+);
+template State NumericalSolver::integrateTime<7>(
+    const State&, const Instant&, const NumericalSolver::FixedSizeSystemOfEquationsWrapper<7>&
+);
+template State NumericalSolver::integrateTime<8>(
+    const State&, const Instant&, const NumericalSolver::FixedSizeSystemOfEquationsWrapper<8>&
+);
+
 }  // namespace state
 }  // namespace trajectory
 }  // namespace astrodynamics
@@ -0,0 +1,66 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Astrodynamics/Utility/FastAtan2.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace utility
+{
+
+using ArrayXb = Eigen::Array<bool, Eigen::Dynamic, 1>;
+using ArrayXd = Eigen::ArrayXd;
+
+ArrayXd FastAtan2(const ArrayXd& y, const ArrayXd& x)
+{
+    const ArrayXd absX = x.abs();
+    const ArrayXd absY = y.abs();
+    const ArrayXd maximum = absX.max(absY);
+
+    // equal magnitudes give exactly 1, including when both are infinite
+    const ArrayXd t = (maximum > 0.0).select((absX == absY).select(1.0, absX.min(absY) / maximum), 0.0);
+    const ArrayXb isShifted = t > 0.66;
+
+    const ArrayXd u = isShifted.select((t - 1.0) / (t + 1.0), t);
+    const ArrayXd z = u.square();
+
+    const ArrayXd p =
+        ((((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z - 7.500855792314704667340e1) * z -
+          1.228866684490136173410e2) *
+             z -
+         6.485021904942025371773e1);
+    const ArrayXd q =
+        (((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z + 4.328810604912902668951e2) * z +
+          4.853903996359136964868e2) *
+             z +
+         1.945506571482613964425e2);
+
+    ArrayXd angle = u + u * z * p / q;
+
+    // the sign bits (rather than comparisons to zero) pick the half planes, so that signed zeros match std::atan2
+    const ArrayXb isXNegative = x.unaryExpr(
+        [](const double& aValue) -> bool
+        {
+            return std::signbit(aValue);
+        }
+    );
+    const ArrayXb isYNegative = y.unaryExpr(
+        [](const double& aValue) -> bool
+        {
+            return std::signbit(aValue);
+        }
+    );
+
+    angle = isShifted.select(angle + M_PI_4, angle);
+    angle = (absY > absX).select(M_PI_2 - angle, angle);
+    angle = isXNegative.select(M_PI - angle, angle);
+
+    return isYNegative.select(-angle, angle);
+}
+
+}  // namespace utility
+}  // namespace astrodynamics
+}  // namespace ostk
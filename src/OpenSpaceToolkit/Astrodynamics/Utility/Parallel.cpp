@@ -0,0 +1,92 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Astrodynamics/Utility/Parallel.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace utility
+{
+
+void ParallelFor(
+    const Size& aCount, const Size& aThreadCount, const std::function<void(const Index&, const Index&)>& aFunction
+)
+{
+    const Size workerCount = std::min(aCount, aThreadCount);
+
+    if (workerCount <= 1)
+    {
+        for (Index index = 0; index < aCount; ++index)
+        {
+            aFunction(index, 0);
+        }
+
+        return;
+    }
+
+    std::atomic<Index> nextIndex {0};
+    std::atomic<bool> hasFailed {false};
+    std::exception_ptr exceptionPtr = nullptr;
+    std::mutex exceptionMutex;
+
+    const auto work = [&](const Index& aWorkerIndex) -> void
+    {
+        while (!hasFailed.load())
+        {
+            const Index index = nextIndex.fetch_add(1);
+
+            if (index >= aCount)
+            {
+                return;
+            }
+
+            try
+            {
+                aFunction(index, aWorkerIndex);
+            }
+            catch (...)
+            {
+                const std::lock_guard<std::mutex> lock {exceptionMutex};
+
+                if (exceptionPtr == nullptr)
+                {
+                    exceptionPtr = std::current_exception();
+                }
+
+                hasFailed.store(true);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+
+    for (Index workerIndex = 1; workerIndex < workerCount; ++workerIndex)
+    {
+        workers.emplace_back(work, workerIndex);
+    }
+
+    work(0);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (exceptionPtr != nullptr)
+    {
+        std::rethrow_exception(exceptionPtr);
+    }
+}
+
+}  // namespace utility
+}  // namespace astrodynamics
+}  // namespace ostk
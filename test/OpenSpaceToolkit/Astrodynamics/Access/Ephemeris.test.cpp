@@ -0,0 +1,140 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::access::Ephemeris;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+class OpenSpaceToolkit_Astrodynamics_Access_Ephemeris : public ::testing::Test
+{
+   protected:
+    Environment defaultEnvironment_ = Environment::Default();
+    const Shared<const Celestial> defaultEarthSPtr_ = defaultEnvironment_.accessCelestialObjectWithName("Earth");
+
+    const TLE defaultTLE_ = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const Orbit defaultTrajectory_ = Orbit(SGP4(defaultTLE_), defaultEarthSPtr_);
+
+    const Instant defaultStartInstant_ = Instant::Parse("2024-10-19 02:25:00.000", Scale::UTC);
+    const Array<Instant> defaultInstants_ =
+        Interval::Closed(defaultStartInstant_, defaultStartInstant_ + Duration::Hours(1.0))
+            .generateGrid(Duration::Minutes(1.0));
+
+    const Ephemeris defaultEphemeris_ = {defaultTrajectory_, defaultInstants_, Frame::ITRF()};
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Ephemeris, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Ephemeris(defaultTrajectory_, defaultInstants_, Frame::ITRF()));
+        EXPECT_NO_THROW(Ephemeris(defaultTrajectory_, defaultInstants_));
+        EXPECT_NO_THROW(Ephemeris(defaultTrajectory_, Array<Instant>::Empty()));
+    }
+
+    {
+        const Array<Instant> unsortedInstants = {defaultInstants_[1], defaultInstants_[0]};
+
+        EXPECT_THROW(Ephemeris(defaultTrajectory_, unsortedInstants), ostk::core::error::RuntimeError);
+
+        const Array<Instant> duplicateInstants = {defaultInstants_[0], defaultInstants_[0]};
+
+        EXPECT_THROW(Ephemeris(defaultTrajectory_, duplicateInstants), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Ephemeris, IsDefined)
+{
+    {
+        EXPECT_TRUE(defaultEphemeris_.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(Ephemeris(Trajectory::Undefined(), defaultInstants_).isDefined());
+        EXPECT_FALSE(Ephemeris(defaultTrajectory_, defaultInstants_, Frame::Undefined()).isDefined());
+        EXPECT_FALSE(Ephemeris::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Ephemeris, Accessors)
+{
+    {
+        EXPECT_EQ(defaultEphemeris_.accessTrajectory(), defaultTrajectory_);
+        EXPECT_EQ(defaultEphemeris_.accessInstants(), defaultInstants_);
+        EXPECT_EQ(*defaultEphemeris_.accessFrame(), *Frame::ITRF());
+        EXPECT_EQ(defaultEphemeris_.getSize(), defaultInstants_.getSize());
+    }
+
+    {
+        const MatrixXd& positionCoordinates = defaultEphemeris_.accessPositionCoordinates();
+
+        ASSERT_EQ(positionCoordinates.rows(), 3);
+        ASSERT_EQ(positionCoordinates.cols(), static_cast<Eigen::Index>(defaultInstants_.getSize()));
+
+        for (Index i = 0; i < defaultInstants_.getSize(); ++i)
+        {
+            const Instant& instant = defaultInstants_[i];
+
+            EXPECT_TRUE(positionCoordinates.col(i).isApprox(
+                defaultTrajectory_.getStateAt(instant).getPosition().inFrame(Frame::ITRF(), instant).getCoordinates(),
+                1e-12
+            ));
+        }
+    }
+
+    {
+        const Ephemeris ephemeris = {defaultTrajectory_, defaultInstants_, Frame::GCRF()};
+
+        EXPECT_TRUE(ephemeris.accessPositionCoordinates().col(0).isApprox(
+            defaultTrajectory_.getStateAt(defaultInstants_[0])
+                .getPosition()
+                .inFrame(Frame::GCRF(), defaultInstants_[0])
+                .getCoordinates(),
+            1e-12
+        ));
+    }
+
+    {
+        EXPECT_THROW(Ephemeris::Undefined().accessTrajectory(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Ephemeris::Undefined().accessInstants(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Ephemeris::Undefined().accessPositionCoordinates(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Ephemeris::Undefined().accessFrame(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Ephemeris::Undefined().getSize(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Ephemeris, Undefined)
+{
+    {
+        EXPECT_NO_THROW(Ephemeris::Undefined());
+    }
+}
@@ -0,0 +1,121 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/FlattenedAzimuthElevationMasks.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/VisibilityCriterion.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+
+using ostk::mathematics::object::Interval;
+
+using ostk::astrodynamics::access::FlattenedAzimuthElevationMasks;
+using ostk::astrodynamics::access::VisibilityCriterion;
+
+class OpenSpaceToolkit_Astrodynamics_Access_FlattenedAzimuthElevationMasks : public ::testing::Test
+{
+   protected:
+    // Masks with and without breakpoints at 0 deg, and with a steep last segment before the azimuth wrap
+    const Array<VisibilityCriterion::AERMask> defaultAERMasks_ = {
+        VisibilityCriterion::AERMask({{0.0, 10.0}, {90.0, 15.0}, {180.0, 20.0}}, Interval<Real>::Closed(0.0, 1.0e7)),
+        VisibilityCriterion::AERMask({{30.0, 5.0}, {200.0, 25.0}, {300.0, 0.0}}, Interval<Real>::Closed(1.0e5, 3.0e6)),
+        VisibilityCriterion::AERMask(
+            {{0.0, 0.0}, {45.0, 45.0}, {90.0, -5.0}, {359.0, 30.0}}, Interval<Real>::Closed(0.0, 1.0e7)
+        ),
+    };
+    const FlattenedAzimuthElevationMasks defaultMasks_ = {defaultAERMasks_};
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_FlattenedAzimuthElevationMasks, Constructor)
+{
+    EXPECT_NO_THROW(FlattenedAzimuthElevationMasks masks(defaultAERMasks_));
+    EXPECT_NO_THROW(FlattenedAzimuthElevationMasks masks(Array<VisibilityCriterion::AERMask>::Empty()));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_FlattenedAzimuthElevationMasks, GetTargetCount)
+{
+    EXPECT_EQ(defaultAERMasks_.getSize(), defaultMasks_.getTargetCount());
+    EXPECT_EQ(0, FlattenedAzimuthElevationMasks(Array<VisibilityCriterion::AERMask>::Empty()).getTargetCount());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_FlattenedAzimuthElevationMasks, IsSatisfied)
+{
+    const double offset = 1.0e-9;
+    const double range_m = 2.0e6;
+
+    for (Index targetIndex = 0; targetIndex < defaultAERMasks_.getSize(); ++targetIndex)
+    {
+        const VisibilityCriterion::AERMask& aerMask = defaultAERMasks_[targetIndex];
+
+        // Azimuths at, around and between the mask breakpoints, and on both sides of the azimuth wrap
+        Array<double> azimuths_rad = {0.0, offset, 2.0 * M_PI - offset};
+        Array<double> elevations_rad = {-M_PI_2, -offset, 0.0, offset, M_PI_2};
+
+        double previousAzimuth_rad = 0.0;
+
+        for (const auto& [azimuth_rad, elevation_rad] : aerMask.azimuthElevationMask)
+        {
+            for (const double& azimuthOffset_rad : {-offset, 0.0, offset})
+            {
+                const double offsetAzimuth_rad = azimuth_rad + azimuthOffset_rad;
+
+                if ((offsetAzimuth_rad >= 0.0) && (offsetAzimuth_rad < 2.0 * M_PI))
+                {
+                    azimuths_rad.add(offsetAzimuth_rad);
+                }
+            }
+
+            for (const double& elevationOffset_rad : {-offset, 0.0, offset})
+            {
+                elevations_rad.add(elevation_rad + elevationOffset_rad);
+            }
+
+            azimuths_rad.add(0.5 * (previousAzimuth_rad + azimuth_rad));
+            previousAzimuth_rad = azimuth_rad;
+        }
+
+        for (const double& azimuth_rad : azimuths_rad)
+        {
+            for (const double& elevation_rad : elevations_rad)
+            {
+                EXPECT_EQ(
+                    aerMask.isSatisfied(azimuth_rad, elevation_rad, range_m),
+                    defaultMasks_.isSatisfied(targetIndex, azimuth_rad, elevation_rad, range_m)
+                ) << targetIndex
+                  << " " << azimuth_rad << " " << elevation_rad;
+            }
+        }
+
+        // The mask is continuous across the azimuth wrap: an azimuth rounded up to 2pi gives the same answer as 0
+        for (const double& elevation_rad : elevations_rad)
+        {
+            EXPECT_EQ(
+                aerMask.isSatisfied(0.0, elevation_rad, range_m),
+                defaultMasks_.isSatisfied(targetIndex, 2.0 * M_PI, elevation_rad, range_m)
+            ) << targetIndex
+              << " " << elevation_rad;
+        }
+
+        // Range
+        for (const double& testRange_m : {0.0, 5.0e4, 2.0e6, 5.0e6, 2.0e7})
+        {
+            EXPECT_EQ(
+                aerMask.isSatisfied(M_PI, M_PI_2, testRange_m),
+                defaultMasks_.isSatisfied(targetIndex, M_PI, M_PI_2, testRange_m)
+            ) << targetIndex
+              << " " << testRange_m;
+        }
+    }
+}
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
@@ -32,6 +34,7 @@ using ostk::core::filesystem::Path;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::curvefitting::Interpolator;
@@ -59,6 +62,7 @@ using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::Access;
 using ostk::astrodynamics::access::AccessTarget;
+using ostk::astrodynamics::access::Ephemeris;
 using ostk::astrodynamics::access::Generator;
 using ostk::astrodynamics::access::VisibilityCriterion;
 using ostk::astrodynamics::Trajectory;
@@ -352,6 +356,72 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, GetStateFilter)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, GetBatchStateFilter)
+{
+    {
+        EXPECT_EQ(nullptr, defaultGenerator_.getBatchStateFilter());
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().getBatchStateFilter());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, GetThreadCount)
+{
+    {
+        EXPECT_EQ(1, defaultGenerator_.getThreadCount());
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().getThreadCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, GetHorizonPrescreening)
+{
+    {
+        const auto [maximumAltitude, maximumAngularRate] = defaultGenerator_.getHorizonPrescreening();
+
+        EXPECT_FALSE(maximumAltitude.isDefined());
+        EXPECT_FALSE(maximumAngularRate.isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().getHorizonPrescreening());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, IsStatisticsEnabled)
+{
+    {
+        EXPECT_FALSE(defaultGenerator_.isStatisticsEnabled());
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().isStatisticsEnabled());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, GetStatistics)
+{
+    {
+        const Generator::Statistics statistics = defaultGenerator_.getStatistics();
+
+        EXPECT_EQ(0, statistics.computationCount);
+        EXPECT_EQ(0, statistics.sampleCount);
+        EXPECT_EQ(0, statistics.trajectoryEvaluationCount);
+        EXPECT_EQ(0, statistics.crossingCount);
+        EXPECT_EQ(0, statistics.rootSolverIterationCount);
+        EXPECT_EQ(0, statistics.accessCount);
+        EXPECT_EQ(Duration::Zero(), statistics.totalDuration);
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().getStatistics());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, GetConditionFunction)
 {
     const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
@@ -1071,6 +1141,99 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_MultipleTrajectories)
+{
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(6.0);
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Array<Trajectory> toTrajectories = {
+        Orbit(
+            SGP4(TLE(
+                "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+                "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607"
+            )),
+            defaultEarthSPtr_
+        ),
+        Orbit(
+            SGP4(TLE(
+                "1 39419U 13066D   18248.44969859 -.00000394  00000-0 -31796-4 0  9997",
+                "2 39419  97.6313 314.6863 0012643 218.7350 141.2966 14.93878994260975"
+            )),
+            defaultEarthSPtr_
+        ),
+    };
+
+    const VisibilityCriterion visibilityCriterion =
+        VisibilityCriterion::FromElevationInterval(ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0));
+
+    const Array<AccessTarget> accessTargets = {
+        AccessTarget::FromLLA(
+            visibilityCriterion,
+            LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+            defaultEarthSPtr_
+        ),
+        AccessTarget::FromLLA(
+            visibilityCriterion,
+            LLA(Angle::Degrees(78.22702), Angle::Degrees(15.38624), Length::Meters(493)),
+            defaultEarthSPtr_
+        ),
+        AccessTarget::FromLLA(
+            visibilityCriterion,
+            LLA(Angle::Degrees(-52.9351), Angle::Degrees(-70.8713), Length::Meters(23)),
+            defaultEarthSPtr_
+        ),
+    };
+
+    {
+        EXPECT_THROW(
+            defaultGenerator_.computeAccesses(interval, accessTargets, Array<Trajectory>::Empty()),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultGenerator_.computeAccesses(interval, accessTargets, Array<Trajectory> {Trajectory::Undefined()}),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        const Array<Array<Array<Access>>> accessTable =
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectories);
+
+        ASSERT_EQ(accessTable.getSize(), toTrajectories.getSize());
+
+        for (Index i = 0; i < toTrajectories.getSize(); ++i)
+        {
+            const Array<Array<Access>> expectedAccessesPerTarget =
+                defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectories[i]);
+
+            ASSERT_EQ(accessTable[i].getSize(), accessTargets.getSize());
+
+            for (Index j = 0; j < accessTargets.getSize(); ++j)
+            {
+                const Array<Access>& accesses = accessTable[i][j];
+                const Array<Access>& expectedAccesses = expectedAccessesPerTarget[j];
+
+                ASSERT_EQ(accesses.getSize(), expectedAccesses.getSize());
+
+                for (Index k = 0; k < accesses.getSize(); ++k)
+                {
+                    EXPECT_TRUE(accesses[k].getAcquisitionOfSignal().isNear(
+                        expectedAccesses[k].getAcquisitionOfSignal(), Duration::Microseconds(1.0)
+                    ));
+                    EXPECT_TRUE(accesses[k].getTimeOfClosestApproach().isNear(
+                        expectedAccesses[k].getTimeOfClosestApproach(), Duration::Microseconds(1.0)
+                    ));
+                    EXPECT_TRUE(accesses[k].getLossOfSignal().isNear(
+                        expectedAccesses[k].getLossOfSignal(), Duration::Microseconds(1.0)
+                    ));
+                }
+            }
+        }
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_5)
 {
     // Regression test for a bug where elevation intervals were not being correctly computed if the trajectory target
@@ -1384,6 +1547,1272 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, SetStateFilter)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, SetBatchStateFilter)
+{
+    {
+        const auto batchStateFilter = [](const State&, const Array<State>& someFromStates) -> Array<bool>
+        {
+            return Array<bool>(someFromStates.getSize(), true);
+        };
+
+        EXPECT_NO_THROW(defaultGenerator_.setBatchStateFilter(batchStateFilter));
+
+        EXPECT_NE(nullptr, defaultGenerator_.getBatchStateFilter());
+
+        EXPECT_NO_THROW(defaultGenerator_.setBatchStateFilter({}));
+
+        EXPECT_EQ(nullptr, defaultGenerator_.getBatchStateFilter());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, SetThreadCount)
+{
+    {
+        EXPECT_NO_THROW(defaultGenerator_.setThreadCount(4));
+
+        EXPECT_EQ(4, defaultGenerator_.getThreadCount());
+
+        EXPECT_THROW(defaultGenerator_.setThreadCount(0), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, SetHorizonPrescreening)
+{
+    {
+        const Length maximumAltitude = Length::Kilometers(600.0);
+        const Derived maximumAngularRate = Derived(1.3e-3, Derived::Unit::RadianPerSecond());
+
+        EXPECT_NO_THROW(defaultGenerator_.setHorizonPrescreening(maximumAltitude, maximumAngularRate));
+
+        EXPECT_EQ(maximumAltitude, defaultGenerator_.getHorizonPrescreening().first);
+        EXPECT_EQ(maximumAngularRate, defaultGenerator_.getHorizonPrescreening().second);
+
+        EXPECT_THROW(
+            defaultGenerator_.setHorizonPrescreening(
+                maximumAltitude, Derived(0.0, Derived::Unit::RadianPerSecond())
+            ),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_NO_THROW(defaultGenerator_.setHorizonPrescreening(Length::Undefined(), Derived::Undefined()));
+
+        EXPECT_FALSE(defaultGenerator_.getHorizonPrescreening().first.isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, SetStatisticsEnabled)
+{
+    {
+        EXPECT_NO_THROW(defaultGenerator_.setStatisticsEnabled(true));
+
+        EXPECT_TRUE(defaultGenerator_.isStatisticsEnabled());
+
+        EXPECT_NO_THROW(defaultGenerator_.setStatisticsEnabled(false));
+
+        EXPECT_FALSE(defaultGenerator_.isStatisticsEnabled());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ResetStatistics)
+{
+    {
+        EXPECT_NO_THROW(defaultGenerator_.resetStatistics());
+
+        EXPECT_EQ(0, defaultGenerator_.getStatistics().computationCount);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_HorizonPrescreening)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const Orbit toTrajectory = Orbit(SGP4(tle), defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Interval interval = Interval::Closed(startInstant, startInstant + Duration::Hours(12.0));
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+        LLA(Angle::Degrees(71.275), Angle::Degrees(-156.806), Length::Meters(24)),
+    };
+
+    // Tight bounds: the maximum altitude and angular rate of the observer over the interval, with a 1% margin
+    Real maximumAltitude_m = 0.0;
+    Real maximumAngularRate_radps = 0.0;
+
+    for (const Instant& instant : interval.generateGrid(defaultStep_))
+    {
+        const State state_ITRF = toTrajectory.getStateAt(instant).inFrame(Frame::ITRF());
+
+        const Vector3d position_ITRF = state_ITRF.getPosition().accessCoordinates();
+        const Vector3d velocity_ITRF = state_ITRF.getVelocity().accessCoordinates();
+
+        maximumAltitude_m = std::max(
+            maximumAltitude_m, Real(position_ITRF.norm() - defaultEarthSPtr_->getEquatorialRadius().inMeters())
+        );
+        maximumAngularRate_radps = std::max(
+            maximumAngularRate_radps, Real(position_ITRF.cross(velocity_ITRF).norm() / position_ITRF.squaredNorm())
+        );
+    }
+
+    const Array<std::pair<Length, Derived>> prescreeningBounds = {
+        {Length::Kilometers(600.0), Derived(1.3e-3, Derived::Unit::RadianPerSecond())},
+        {Length::Meters(1.01 * maximumAltitude_m),
+         Derived(1.01 * maximumAngularRate_radps, Derived::Unit::RadianPerSecond())},
+    };
+
+    Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+    generator.setStatisticsEnabled(true);
+
+    const Array<VisibilityCriterion> visibilityCriteria = {
+        VisibilityCriterion::FromElevationInterval(ostk::mathematics::object::Interval<Real>::Closed(10.0, 90.0)),
+        VisibilityCriterion::FromAERInterval(
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 360.0),
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0),
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e10)
+        ),
+        VisibilityCriterion::FromAERMask(
+            {{0.0, 5.0}, {180.0, 15.0}, {270.0, 10.0}}, ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e10)
+        ),
+    };
+
+    for (const VisibilityCriterion& visibilityCriterion : visibilityCriteria)
+    {
+        const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+            [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+            {
+                return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+            }
+        );
+
+        generator.setHorizonPrescreening(Length::Undefined(), Derived::Undefined());
+        generator.resetStatistics();
+
+        const Array<Array<Access>> expectedAccessesPerTarget =
+            generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+        const Generator::Statistics expectedStatistics = generator.getStatistics();
+
+        Size expectedAccessCount = 0;
+
+        for (const Array<Access>& expectedAccesses : expectedAccessesPerTarget)
+        {
+            expectedAccessCount += expectedAccesses.getSize();
+        }
+
+        ASSERT_GT(expectedAccessCount, 0);
+
+        for (const auto& [maximumAltitude, maximumAngularRate] : prescreeningBounds)
+        {
+            generator.setHorizonPrescreening(maximumAltitude, maximumAngularRate);
+            generator.resetStatistics();
+
+            const Array<Array<Access>> accessesPerTarget =
+                generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+            // Every window is kept, including with bounds close to the observer altitude and angular rate
+            ASSERT_EQ(accessesPerTarget.getSize(), expectedAccessesPerTarget.getSize());
+
+            for (Index i = 0; i < accessesPerTarget.getSize(); ++i)
+            {
+                ASSERT_EQ(accessesPerTarget[i].getSize(), expectedAccessesPerTarget[i].getSize());
+
+                for (Index j = 0; j < accessesPerTarget[i].getSize(); ++j)
+                {
+                    EXPECT_EQ(
+                        accessesPerTarget[i][j].getAcquisitionOfSignal(),
+                        expectedAccessesPerTarget[i][j].getAcquisitionOfSignal()
+                    );
+                    EXPECT_EQ(
+                        accessesPerTarget[i][j].getLossOfSignal(), expectedAccessesPerTarget[i][j].getLossOfSignal()
+                    );
+                }
+            }
+
+            // The grid steps out of view of every target are skipped, without evaluating the observer trajectory
+            const Generator::Statistics statistics = generator.getStatistics();
+
+            EXPECT_LT(statistics.sampleCount, expectedStatistics.sampleCount);
+            EXPECT_LT(statistics.trajectoryEvaluationCount, expectedStatistics.trajectoryEvaluationCount);
+            EXPECT_LT(statistics.frameTransformCount, expectedStatistics.frameTransformCount);
+            EXPECT_EQ(expectedStatistics.crossingCount, statistics.crossingCount);
+            EXPECT_EQ(expectedStatistics.accessCount, statistics.accessCount);
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_MultipleThreads)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const SGP4 sgp4 = SGP4(tle);
+    const Orbit toTrajectory = Orbit(sgp4, defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(6.0);
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(13.51), Angle::Degrees(144.82), Length::Meters(46)),
+        LLA(Angle::Degrees(42.77), Angle::Degrees(141.62), Length::Meters(100)),
+        LLA(Angle::Degrees(47.2393), Angle::Degrees(-119.88515), Length::Meters(392.5)),
+        LLA(Angle::Degrees(78.22702), Angle::Degrees(15.38624), Length::Meters(493)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+    };
+
+    const auto expectAccessesEqual = [](const Array<Array<Access>>& someAccessesPerTarget,
+                                        const Array<Array<Access>>& someExpectedAccessesPerTarget) -> void
+    {
+        ASSERT_EQ(someAccessesPerTarget.getSize(), someExpectedAccessesPerTarget.getSize());
+
+        for (Index i = 0; i < someAccessesPerTarget.getSize(); ++i)
+        {
+            const Array<Access>& accesses = someAccessesPerTarget.at(i);
+            const Array<Access>& expectedAccesses = someExpectedAccessesPerTarget.at(i);
+
+            ASSERT_EQ(accesses.getSize(), expectedAccesses.getSize());
+
+            for (Index j = 0; j < accesses.getSize(); ++j)
+            {
+                EXPECT_EQ(accesses.at(j).getAcquisitionOfSignal(), expectedAccesses.at(j).getAcquisitionOfSignal());
+                EXPECT_EQ(
+                    accesses.at(j).getTimeOfClosestApproach(), expectedAccesses.at(j).getTimeOfClosestApproach()
+                );
+                EXPECT_EQ(accesses.at(j).getLossOfSignal(), expectedAccesses.at(j).getLossOfSignal());
+            }
+        }
+    };
+
+    Generator parallelGenerator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+    parallelGenerator.setThreadCount(4);
+
+    // Fixed targets
+
+    {
+        const VisibilityCriterion visibilityCriterion = VisibilityCriterion::FromElevationInterval(
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0)
+        );
+
+        const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+            [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+            {
+                return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+            }
+        );
+
+        expectAccessesEqual(
+            parallelGenerator.computeAccesses(interval, accessTargets, toTrajectory),
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory)
+        );
+
+        expectAccessesEqual(
+            parallelGenerator.computeAccesses(interval, accessTargets, toTrajectory, true),
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory, true)
+        );
+
+        // Crossings are refined per coarse interval: check that the output order and the access filter are preserved,
+        // for several thread counts and trajectories
+
+        const std::function<bool(const Access&)> accessFilter = [](const Access& anAccess) -> bool
+        {
+            return anAccess.getDuration() > Duration::Minutes(5.0);
+        };
+
+        const Generator filteredGenerator = {defaultEnvironment_, defaultStep_, defaultTolerance_, accessFilter};
+
+        const Orbit otherToTrajectory = Orbit(
+            SGP4(TLE(
+                "1 39419U 13066D   18248.44969859 -.00000394  00000-0 -31796-4 0  9997",
+                "2 39419  97.6313 314.6863 0012643 218.7350 141.2966 14.93878994260975"
+            )),
+            defaultEarthSPtr_
+        );
+
+        const Array<Trajectory> toTrajectories = {toTrajectory, otherToTrajectory};
+
+        const Array<Array<Array<Access>>> expectedAccessTable =
+            filteredGenerator.computeAccesses(interval, accessTargets, toTrajectories);
+
+        for (const int threadCount : {2, 3, 8})
+        {
+            Generator generator = filteredGenerator;
+            generator.setThreadCount(threadCount);
+
+            const Array<Array<Array<Access>>> accessTable =
+                generator.computeAccesses(interval, accessTargets, toTrajectories);
+
+            ASSERT_EQ(accessTable.getSize(), expectedAccessTable.getSize());
+
+            for (Index i = 0; i < accessTable.getSize(); ++i)
+            {
+                expectAccessesEqual(accessTable[i], expectedAccessTable[i]);
+            }
+        }
+    }
+
+    // Trajectory targets
+
+    {
+        const VisibilityCriterion visibilityCriterion = VisibilityCriterion::FromAERInterval(
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 360.0),
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0),
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e10)
+        );
+
+        const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+            [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+            {
+                return AccessTarget::FromTrajectory(
+                    visibilityCriterion,
+                    Trajectory::Position(Position::Meters(
+                        lla.toCartesian(defaultEarthSPtr_->getEquatorialRadius(), defaultEarthSPtr_->getFlattening()),
+                        Frame::ITRF()
+                    ))
+                );
+            }
+        );
+
+        expectAccessesEqual(
+            parallelGenerator.computeAccesses(interval, accessTargets, toTrajectory),
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_LineOfSight)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const SGP4 sgp4 = SGP4(tle);
+    const Orbit toTrajectory = Orbit(sgp4, defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(12.0);
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(13.51), Angle::Degrees(144.82), Length::Meters(46)),
+        LLA(Angle::Degrees(42.77), Angle::Degrees(141.62), Length::Meters(100)),
+        LLA(Angle::Degrees(47.2393), Angle::Degrees(-119.88515), Length::Meters(392.5)),
+        LLA(Angle::Degrees(78.22702), Angle::Degrees(15.38624), Length::Meters(493)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+    };
+
+    // The targets share a criterion, so they are evaluated together against the environment ellipsoids: the result
+    // must agree with the generic (environment intersection) criterion.
+
+    const VisibilityCriterion visibilityCriterion = VisibilityCriterion::FromLineOfSight(defaultEnvironment_);
+    const VisibilityCriterion::LineOfSight lineOfSight =
+        visibilityCriterion.as<VisibilityCriterion::LineOfSight>().value();
+
+    const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+        [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+        {
+            return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+        }
+    );
+
+    const auto isVisible = [&toTrajectory, &lineOfSight](const AccessTarget& anAccessTarget, const Instant& anInstant
+                           ) -> bool
+    {
+        const Vector3d toPositionCoordinates_ITRF =
+            toTrajectory.getStateAt(anInstant).getPosition().inFrame(Frame::ITRF(), anInstant).getCoordinates();
+
+        return lineOfSight.isSatisfied(
+            anInstant, anAccessTarget.getPosition().getCoordinates(), toPositionCoordinates_ITRF
+        );
+    };
+
+    const Array<Array<Access>> accessesPerTarget =
+        defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory);
+
+    ASSERT_EQ(accessesPerTarget.getSize(), accessTargets.getSize());
+
+    for (Index i = 0; i < accessTargets.getSize(); ++i)
+    {
+        EXPECT_FALSE(accessesPerTarget[i].isEmpty());
+
+        for (const Access& access : accessesPerTarget[i])
+        {
+            if (access.getType() != Access::Type::Complete)
+            {
+                continue;
+            }
+
+            EXPECT_TRUE(isVisible(accessTargets[i], access.getTimeOfClosestApproach()));
+            EXPECT_TRUE(isVisible(accessTargets[i], access.getAcquisitionOfSignal() + Duration::Seconds(1.0)));
+            EXPECT_TRUE(isVisible(accessTargets[i], access.getLossOfSignal() - Duration::Seconds(1.0)));
+            EXPECT_FALSE(isVisible(accessTargets[i], access.getAcquisitionOfSignal() - Duration::Seconds(1.0)));
+            EXPECT_FALSE(isVisible(accessTargets[i], access.getLossOfSignal() + Duration::Seconds(1.0)));
+        }
+    }
+
+    // Trajectory targets use the same evaluation
+
+    {
+        const Array<AccessTarget> trajectoryTargets = LLAs.map<AccessTarget>(
+            [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+            {
+                return AccessTarget::FromTrajectory(
+                    visibilityCriterion,
+                    Trajectory::Position(Position::Meters(
+                        lla.toCartesian(defaultEarthSPtr_->getEquatorialRadius(), defaultEarthSPtr_->getFlattening()),
+                        Frame::ITRF()
+                    ))
+                );
+            }
+        );
+
+        const Array<Array<Access>> trajectoryTargetAccessesPerTarget =
+            defaultGenerator_.computeAccesses(interval, trajectoryTargets, toTrajectory);
+
+        for (Index i = 0; i < accessTargets.getSize(); ++i)
+        {
+            ASSERT_EQ(trajectoryTargetAccessesPerTarget[i].getSize(), accessesPerTarget[i].getSize());
+
+            for (Index j = 0; j < accessesPerTarget[i].getSize(); ++j)
+            {
+                EXPECT_TRUE(trajectoryTargetAccessesPerTarget[i][j].getAcquisitionOfSignal().isNear(
+                    accessesPerTarget[i][j].getAcquisitionOfSignal(), Duration::Milliseconds(1.0)
+                ));
+                EXPECT_TRUE(trajectoryTargetAccessesPerTarget[i][j].getLossOfSignal().isNear(
+                    accessesPerTarget[i][j].getLossOfSignal(), Duration::Milliseconds(1.0)
+                ));
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_StateFilters)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const SGP4 sgp4 = SGP4(tle);
+    const Orbit toTrajectory = Orbit(sgp4, defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(12.0);
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(13.51), Angle::Degrees(144.82), Length::Meters(46)),
+        LLA(Angle::Degrees(42.77), Angle::Degrees(141.62), Length::Meters(100)),
+        LLA(Angle::Degrees(47.2393), Angle::Degrees(-119.88515), Length::Meters(392.5)),
+        LLA(Angle::Degrees(78.22702), Angle::Degrees(15.38624), Length::Meters(493)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+    };
+
+    const VisibilityCriterion visibilityCriterion =
+        VisibilityCriterion::FromElevationInterval(ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0));
+
+    const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+        [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+        {
+            return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+        }
+    );
+
+    const auto expectAccessesEqual = [](const Array<Array<Access>>& someAccessesPerTarget,
+                                        const Array<Array<Access>>& someExpectedAccessesPerTarget) -> void
+    {
+        ASSERT_EQ(someAccessesPerTarget.getSize(), someExpectedAccessesPerTarget.getSize());
+
+        for (Index i = 0; i < someAccessesPerTarget.getSize(); ++i)
+        {
+            const Array<Access>& accesses = someAccessesPerTarget.at(i);
+            const Array<Access>& expectedAccesses = someExpectedAccessesPerTarget.at(i);
+
+            ASSERT_EQ(accesses.getSize(), expectedAccesses.getSize());
+
+            for (Index j = 0; j < accesses.getSize(); ++j)
+            {
+                EXPECT_EQ(accesses.at(j).getAcquisitionOfSignal(), expectedAccesses.at(j).getAcquisitionOfSignal());
+                EXPECT_EQ(accesses.at(j).getLossOfSignal(), expectedAccesses.at(j).getLossOfSignal());
+            }
+        }
+    };
+
+    const Array<Array<Access>> unfilteredAccessesPerTarget =
+        defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory, true);
+
+    // number of (instant, target) samples satisfying the visibility criterion
+    Size visibleSampleCount = 0;
+
+    for (const Array<Access>& accesses : unfilteredAccessesPerTarget)
+    {
+        for (const Access& access : accesses)
+        {
+            visibleSampleCount +=
+                static_cast<Size>(std::round(access.getDuration().inSeconds() / defaultStep_.inSeconds())) + 1;
+        }
+    }
+
+    ASSERT_GT(visibleSampleCount, 0);
+
+    // The state filter is only evaluated for targets satisfying their visibility criterion
+
+    {
+        Size callCount = 0;
+
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStateFilter(
+            [&callCount](const State&, const State&) -> bool
+            {
+                ++callCount;
+
+                return true;
+            }
+        );
+
+        expectAccessesEqual(
+            generator.computeAccesses(interval, accessTargets, toTrajectory, true), unfilteredAccessesPerTarget
+        );
+
+        EXPECT_EQ(callCount, visibleSampleCount);
+    }
+
+    // The batch state filter only receives targets satisfying their visibility criterion, and is not called when
+    // there is none
+
+    {
+        Size callCount = 0;
+        Size stateCount = 0;
+
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setBatchStateFilter(
+            [&callCount, &stateCount](const State&, const Array<State>& someFromStates) -> Array<bool>
+            {
+                EXPECT_FALSE(someFromStates.isEmpty());
+
+                ++callCount;
+                stateCount += someFromStates.getSize();
+
+                return Array<bool>(someFromStates.getSize(), true);
+            }
+        );
+
+        expectAccessesEqual(
+            generator.computeAccesses(interval, accessTargets, toTrajectory, true), unfilteredAccessesPerTarget
+        );
+
+        EXPECT_GT(callCount, 0);
+        EXPECT_LE(callCount, visibleSampleCount);
+        EXPECT_EQ(stateCount, visibleSampleCount);
+    }
+
+    // The batch state filter receives the same states as the state filter, and both give the same accesses
+
+    {
+        const Real maximumRange_m = 2.0e6;
+
+        const auto isWithinRange = [&maximumRange_m](const State& aFromState, const State& aToState) -> bool
+        {
+            EXPECT_EQ(aFromState.accessInstant(), aToState.accessInstant());
+            EXPECT_EQ(*aFromState.accessFrame(), *Frame::GCRF());
+
+            return (aToState.getPosition().getCoordinates() - aFromState.getPosition().getCoordinates()).norm() <
+                   maximumRange_m;
+        };
+
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStateFilter(isWithinRange);
+
+        Generator batchGenerator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        batchGenerator.setBatchStateFilter(
+            [&isWithinRange](const State& aToState, const Array<State>& someFromStates) -> Array<bool>
+            {
+                Array<bool> isRetained = Array<bool>::Empty();
+
+                for (const State& fromState : someFromStates)
+                {
+                    isRetained.add(isWithinRange(fromState, aToState));
+                }
+
+                return isRetained;
+            }
+        );
+
+        const Array<Array<Access>> accessesPerTarget =
+            generator.computeAccesses(interval, accessTargets, toTrajectory, true);
+
+        expectAccessesEqual(
+            batchGenerator.computeAccesses(interval, accessTargets, toTrajectory, true), accessesPerTarget
+        );
+
+        Size filteredSampleCount = 0;
+
+        for (const Array<Access>& accesses : accessesPerTarget)
+        {
+            for (const Access& access : accesses)
+            {
+                filteredSampleCount +=
+                    static_cast<Size>(std::round(access.getDuration().inSeconds() / defaultStep_.inSeconds())) + 1;
+            }
+        }
+
+        EXPECT_LT(filteredSampleCount, visibleSampleCount);
+
+        // both filters combined
+
+        Generator combinedGenerator = batchGenerator;
+        combinedGenerator.setStateFilter(
+            [&startInstant](const State&, const State& aToState) -> bool
+            {
+                return aToState.accessInstant() < (startInstant + Duration::Hours(6.0));
+            }
+        );
+
+        const Array<Array<Access>> combinedAccessesPerTarget =
+            combinedGenerator.computeAccesses(interval, accessTargets, toTrajectory, true);
+
+        for (const Array<Access>& accesses : combinedAccessesPerTarget)
+        {
+            for (const Access& access : accesses)
+            {
+                EXPECT_LT(access.getAcquisitionOfSignal(), startInstant + Duration::Hours(6.0));
+            }
+        }
+    }
+
+    // Trajectory targets
+
+    {
+        const Array<AccessTarget> trajectoryTargets = {AccessTarget::FromTrajectory(
+            visibilityCriterion,
+            Trajectory::Position(Position::Meters(
+                LLAs[0].toCartesian(defaultEarthSPtr_->getEquatorialRadius(), defaultEarthSPtr_->getFlattening()),
+                Frame::ITRF()
+            ))
+        )};
+
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setBatchStateFilter(
+            [](const State&, const Array<State>& someFromStates) -> Array<bool>
+            {
+                EXPECT_EQ(someFromStates.getSize(), 1);
+
+                return Array<bool>(someFromStates.getSize(), false);
+            }
+        );
+
+        const Array<Array<Access>> accessesPerTarget =
+            generator.computeAccesses(interval, trajectoryTargets, toTrajectory);
+
+        ASSERT_EQ(accessesPerTarget.getSize(), 1);
+        EXPECT_TRUE(accessesPerTarget[0].isEmpty());
+
+        // The state filters are only evaluated at instants satisfying the visibility criterion
+
+        const Array<Access> unfilteredAccesses =
+            defaultGenerator_.computeAccesses(interval, trajectoryTargets, toTrajectory)[0];
+
+        ASSERT_FALSE(unfilteredAccesses.isEmpty());
+
+        Array<Instant> filteredInstants = Array<Instant>::Empty();
+
+        Generator filteredGenerator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        filteredGenerator.setStateFilter(
+            [&filteredInstants](const State& aFromState, const State&) -> bool
+            {
+                filteredInstants.add(aFromState.accessInstant());
+
+                return true;
+            }
+        );
+
+        EXPECT_EQ(
+            filteredGenerator.computeAccesses(interval, trajectoryTargets, toTrajectory)[0].getSize(),
+            unfilteredAccesses.getSize()
+        );
+
+        ASSERT_FALSE(filteredInstants.isEmpty());
+
+        for (const Instant& filteredInstant : filteredInstants)
+        {
+            EXPECT_TRUE(std::any_of(
+                unfilteredAccesses.begin(),
+                unfilteredAccesses.end(),
+                [this, &filteredInstant](const Access& anAccess) -> bool
+                {
+                    return ((anAccess.getAcquisitionOfSignal() - defaultTolerance_) <= filteredInstant) &&
+                           (filteredInstant <= (anAccess.getLossOfSignal() + defaultTolerance_));
+                }
+            ));
+        }
+    }
+
+    // Invalid batch state filter output
+
+    {
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setBatchStateFilter(
+            [](const State&, const Array<State>&) -> Array<bool>
+            {
+                return Array<bool>::Empty();
+            }
+        );
+
+        EXPECT_THROW(
+            generator.computeAccesses(interval, accessTargets, toTrajectory, true), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, StreamAccesses)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const SGP4 sgp4 = SGP4(tle);
+    const Orbit toTrajectory = Orbit(sgp4, defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(12.0) + Duration::Seconds(20.0);
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(13.51), Angle::Degrees(144.82), Length::Meters(46)),
+        LLA(Angle::Degrees(42.77), Angle::Degrees(141.62), Length::Meters(100)),
+        LLA(Angle::Degrees(47.2393), Angle::Degrees(-119.88515), Length::Meters(392.5)),
+        LLA(Angle::Degrees(78.22702), Angle::Degrees(15.38624), Length::Meters(493)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+    };
+
+    const VisibilityCriterion visibilityCriterion =
+        VisibilityCriterion::FromElevationInterval(ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0));
+
+    const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+        [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+        {
+            return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+        }
+    );
+
+    const auto streamAccesses = [&](const Generator& aGenerator, const Duration& aWindowDuration, const bool& coarse
+                                ) -> Array<Array<Access>>
+    {
+        Array<Array<Access>> accessesPerTarget = Array<Array<Access>>(accessTargets.getSize(), Array<Access>::Empty());
+
+        aGenerator.streamAccesses(
+            interval,
+            accessTargets,
+            toTrajectory,
+            [&accessesPerTarget](const Index& aTargetIndex, const Access& anAccess) -> void
+            {
+                accessesPerTarget[aTargetIndex].add(anAccess);
+            },
+            aWindowDuration,
+            coarse
+        );
+
+        return accessesPerTarget;
+    };
+
+    const auto expectAccessesEqual = [](const Array<Array<Access>>& someAccessesPerTarget,
+                                        const Array<Array<Access>>& someExpectedAccessesPerTarget) -> void
+    {
+        ASSERT_EQ(someAccessesPerTarget.getSize(), someExpectedAccessesPerTarget.getSize());
+
+        for (Index i = 0; i < someAccessesPerTarget.getSize(); ++i)
+        {
+            const Array<Access>& accesses = someAccessesPerTarget.at(i);
+            const Array<Access>& expectedAccesses = someExpectedAccessesPerTarget.at(i);
+
+            ASSERT_EQ(accesses.getSize(), expectedAccesses.getSize());
+
+            for (Index j = 0; j < accesses.getSize(); ++j)
+            {
+                EXPECT_EQ(accesses.at(j).getType(), expectedAccesses.at(j).getType());
+                EXPECT_EQ(accesses.at(j).getAcquisitionOfSignal(), expectedAccesses.at(j).getAcquisitionOfSignal());
+                EXPECT_EQ(
+                    accesses.at(j).getTimeOfClosestApproach(), expectedAccesses.at(j).getTimeOfClosestApproach()
+                );
+                EXPECT_EQ(accesses.at(j).getLossOfSignal(), expectedAccesses.at(j).getLossOfSignal());
+            }
+        }
+    };
+
+    // Windows shorter than a pass (accesses span several windows), not aligned with the step, and longer than the
+    // interval
+
+    {
+        const Array<Array<Access>> expectedAccessesPerTarget =
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory);
+
+        const Array<Array<Access>> expectedCoarseAccessesPerTarget =
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory, true);
+
+        for (const Duration& windowDuration :
+             {Duration::Minutes(3.0), Duration::Seconds(450.0), Duration::Hours(1.0), Duration::Days(1.0)})
+        {
+            expectAccessesEqual(
+                streamAccesses(defaultGenerator_, windowDuration, false), expectedAccessesPerTarget
+            );
+            expectAccessesEqual(
+                streamAccesses(defaultGenerator_, windowDuration, true), expectedCoarseAccessesPerTarget
+            );
+        }
+    }
+
+    // Multiple threads
+
+    {
+        Generator parallelGenerator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        parallelGenerator.setThreadCount(4);
+
+        expectAccessesEqual(
+            streamAccesses(parallelGenerator, Duration::Minutes(20.0), false),
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory)
+        );
+    }
+
+    // Invalid inputs
+
+    {
+        const auto callback = [](const Index& aTargetIndex, const Access& anAccess) -> void
+        {
+            (void)aTargetIndex;
+            (void)anAccess;
+        };
+
+        EXPECT_THROW(
+            defaultGenerator_.streamAccesses(interval, accessTargets, toTrajectory, {}, Duration::Hours(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultGenerator_.streamAccesses(
+                interval, accessTargets, toTrajectory, callback, Duration::Undefined()
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultGenerator_.streamAccesses(
+                interval, accessTargets, toTrajectory, callback, Duration::Seconds(30.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+
+        const Array<AccessTarget> trajectoryTargets = {AccessTarget::FromTrajectory(
+            visibilityCriterion,
+            Trajectory::Position(Position::Meters(
+                LLAs[0].toCartesian(defaultEarthSPtr_->getEquatorialRadius(), defaultEarthSPtr_->getFlattening()),
+                Frame::ITRF()
+            ))
+        )};
+
+        EXPECT_THROW(
+            defaultGenerator_.streamAccesses(
+                interval, trajectoryTargets, toTrajectory, callback, Duration::Hours(1.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_Ephemeris)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const SGP4 sgp4 = SGP4(tle);
+    const Orbit toTrajectory = Orbit(sgp4, defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(12.0) + Duration::Seconds(20.0);
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(13.51), Angle::Degrees(144.82), Length::Meters(46)),
+        LLA(Angle::Degrees(42.77), Angle::Degrees(141.62), Length::Meters(100)),
+        LLA(Angle::Degrees(47.2393), Angle::Degrees(-119.88515), Length::Meters(392.5)),
+        LLA(Angle::Degrees(78.22702), Angle::Degrees(15.38624), Length::Meters(493)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+    };
+
+    const VisibilityCriterion visibilityCriterion =
+        VisibilityCriterion::FromElevationInterval(ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0));
+
+    const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+        [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+        {
+            return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+        }
+    );
+
+    const auto expectAccessesEqual = [](const Array<Array<Access>>& someAccessesPerTarget,
+                                        const Array<Array<Access>>& someExpectedAccessesPerTarget) -> void
+    {
+        ASSERT_EQ(someAccessesPerTarget.getSize(), someExpectedAccessesPerTarget.getSize());
+
+        for (Index i = 0; i < someAccessesPerTarget.getSize(); ++i)
+        {
+            const Array<Access>& accesses = someAccessesPerTarget.at(i);
+            const Array<Access>& expectedAccesses = someExpectedAccessesPerTarget.at(i);
+
+            ASSERT_EQ(accesses.getSize(), expectedAccesses.getSize());
+
+            for (Index j = 0; j < accesses.getSize(); ++j)
+            {
+                EXPECT_EQ(accesses.at(j).getType(), expectedAccesses.at(j).getType());
+                EXPECT_EQ(accesses.at(j).getAcquisitionOfSignal(), expectedAccesses.at(j).getAcquisitionOfSignal());
+                EXPECT_EQ(
+                    accesses.at(j).getTimeOfClosestApproach(), expectedAccesses.at(j).getTimeOfClosestApproach()
+                );
+                EXPECT_EQ(accesses.at(j).getLossOfSignal(), expectedAccesses.at(j).getLossOfSignal());
+            }
+        }
+    };
+
+    // Generate ephemeris
+
+    const Ephemeris ephemeris = defaultGenerator_.generateEphemeris(interval, toTrajectory);
+
+    {
+        const Array<Instant> instants = interval.generateGrid(defaultStep_);
+
+        ASSERT_TRUE(ephemeris.isDefined());
+        EXPECT_EQ(ephemeris.getSize(), instants.getSize());
+        EXPECT_EQ(ephemeris.accessInstants(), instants);
+        EXPECT_EQ(*ephemeris.accessFrame(), *Frame::ITRF());
+
+        EXPECT_THROW(
+            defaultGenerator_.generateEphemeris(Interval::Undefined(), toTrajectory),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultGenerator_.generateEphemeris(interval, Trajectory::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    // Same accesses as with the trajectory, for several target batches
+
+    {
+        const Array<Array<Access>> expectedAccessesPerTarget =
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory);
+
+        expectAccessesEqual(
+            defaultGenerator_.computeAccesses(interval, accessTargets, ephemeris), expectedAccessesPerTarget
+        );
+
+        expectAccessesEqual(
+            defaultGenerator_.computeAccesses(interval, accessTargets, ephemeris, true),
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory, true)
+        );
+
+        const Array<AccessTarget> firstAccessTargets = {accessTargets[0], accessTargets[1]};
+        const Array<AccessTarget> lastAccessTargets = {accessTargets[4], accessTargets[5]};
+
+        expectAccessesEqual(
+            defaultGenerator_.computeAccesses(interval, firstAccessTargets, ephemeris),
+            {expectedAccessesPerTarget[0], expectedAccessesPerTarget[1]}
+        );
+        expectAccessesEqual(
+            defaultGenerator_.computeAccesses(interval, lastAccessTargets, ephemeris),
+            {expectedAccessesPerTarget[4], expectedAccessesPerTarget[5]}
+        );
+
+        const Array<Array<Array<Access>>> accessTable =
+            defaultGenerator_.computeAccesses(interval, accessTargets, Array<Ephemeris> {ephemeris, ephemeris});
+
+        ASSERT_EQ(accessTable.getSize(), 2);
+
+        expectAccessesEqual(accessTable[0], expectedAccessesPerTarget);
+        expectAccessesEqual(accessTable[1], expectedAccessesPerTarget);
+    }
+
+    // Sub-interval, and grid instants missing from the ephemeris
+
+    {
+        const Interval subInterval = Interval::Closed(startInstant + Duration::Hours(2.0), endInstant);
+
+        expectAccessesEqual(
+            defaultGenerator_.computeAccesses(subInterval, accessTargets, ephemeris),
+            defaultGenerator_.computeAccesses(subInterval, accessTargets, toTrajectory)
+        );
+
+        const Ephemeris sparseEphemeris = {
+            toTrajectory, interval.generateGrid(Duration::Minutes(7.0)), defaultEarthSPtr_->accessFrame()
+        };
+
+        expectAccessesEqual(
+            defaultGenerator_.computeAccesses(interval, accessTargets, sparseEphemeris),
+            defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory)
+        );
+    }
+
+    // State filter
+
+    {
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStateFilter(
+            [&startInstant](const State& aFromState, const State& aToState) -> bool
+            {
+                (void)aFromState;
+
+                return aToState.accessInstant() > (startInstant + Duration::Hours(6.0));
+            }
+        );
+
+        expectAccessesEqual(
+            generator.computeAccesses(interval, accessTargets, ephemeris),
+            generator.computeAccesses(interval, accessTargets, toTrajectory)
+        );
+    }
+
+    // Invalid inputs
+
+    {
+        EXPECT_THROW(
+            defaultGenerator_.computeAccesses(interval, accessTargets, Ephemeris::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultGenerator_.computeAccesses(interval, accessTargets, Array<Ephemeris>::Empty()),
+            ostk::core::error::runtime::Undefined
+        );
+
+        const Ephemeris gcrfEphemeris = {toTrajectory, interval.generateGrid(defaultStep_), Frame::GCRF()};
+
+        EXPECT_THROW(
+            defaultGenerator_.computeAccesses(interval, accessTargets, gcrfEphemeris), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_Statistics)
+{
+    const TLE tle = {
+        "1 60504U 24149AN  24293.10070306  .00000000  00000-0  58313-3 0    08",
+        "2 60504  97.4383   7.6998 0003154 274.9510 182.9597 15.19652001  9607",
+    };
+    const Orbit toTrajectory = Orbit(SGP4(tle), defaultEarthSPtr_);
+
+    const Instant startInstant = Instant::Parse("2024-10-19 02:25:00.744.384", Scale::UTC);
+    const Interval interval = Interval::Closed(startInstant, startInstant + Duration::Hours(12.0));
+
+    const Array<LLA> LLAs = {
+        LLA(Angle::Degrees(53.406), Angle::Degrees(-6.225), Length::Meters(50.5)),
+        LLA(Angle::Degrees(-25.89), Angle::Degrees(27.71), Length::Meters(1562.66)),
+        LLA(Angle::Degrees(71.275), Angle::Degrees(-156.806), Length::Meters(24)),
+    };
+
+    const VisibilityCriterion visibilityCriterion =
+        VisibilityCriterion::FromElevationInterval(ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0));
+
+    const Array<AccessTarget> accessTargets = LLAs.map<AccessTarget>(
+        [&visibilityCriterion, this](const LLA& lla) -> AccessTarget
+        {
+            return AccessTarget::FromLLA(visibilityCriterion, lla, defaultEarthSPtr_);
+        }
+    );
+
+    const Size sampleCount = interval.generateGrid(defaultStep_).getSize();
+
+    const Array<Array<Access>> expectedAccessesPerTarget =
+        defaultGenerator_.computeAccesses(interval, accessTargets, toTrajectory);
+
+    Size expectedAccessCount = 0;
+
+    for (const Array<Access>& accesses : expectedAccessesPerTarget)
+    {
+        expectedAccessCount += accesses.getSize();
+    }
+
+    ASSERT_GT(expectedAccessCount, 0);
+
+    // Disabled by default
+
+    {
+        EXPECT_EQ(0, defaultGenerator_.getStatistics().computationCount);
+    }
+
+    // Fixed targets
+
+    Generator::Statistics serialStatistics;
+
+    {
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStatisticsEnabled(true);
+
+        const Array<Array<Access>> accessesPerTarget = generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+        ASSERT_EQ(accessesPerTarget.getSize(), expectedAccessesPerTarget.getSize());
+
+        for (Index i = 0; i < accessesPerTarget.getSize(); ++i)
+        {
+            ASSERT_EQ(accessesPerTarget[i].getSize(), expectedAccessesPerTarget[i].getSize());
+
+            for (Index j = 0; j < accessesPerTarget[i].getSize(); ++j)
+            {
+                EXPECT_EQ(
+                    accessesPerTarget[i][j].getAcquisitionOfSignal(),
+                    expectedAccessesPerTarget[i][j].getAcquisitionOfSignal()
+                );
+                EXPECT_EQ(
+                    accessesPerTarget[i][j].getLossOfSignal(), expectedAccessesPerTarget[i][j].getLossOfSignal()
+                );
+            }
+        }
+
+        serialStatistics = generator.getStatistics();
+
+        EXPECT_EQ(1, serialStatistics.computationCount);
+        EXPECT_EQ(sampleCount, serialStatistics.sampleCount);
+        EXPECT_EQ(0, serialStatistics.ephemerisLookupCount);
+        EXPECT_EQ(expectedAccessCount, serialStatistics.accessCount);
+        EXPECT_GE(serialStatistics.crossingCount, expectedAccessCount);
+        EXPECT_LE(serialStatistics.crossingCount, 2 * expectedAccessCount);
+        EXPECT_GE(serialStatistics.rootSolverIterationCount, serialStatistics.crossingCount);
+        EXPECT_GT(serialStatistics.closestApproachEvaluationCount, 0);
+        EXPECT_GT(serialStatistics.trajectoryEvaluationCount, sampleCount);
+        EXPECT_GT(serialStatistics.frameTransformCount, sampleCount);
+
+        EXPECT_GT(serialStatistics.samplingDuration, Duration::Zero());
+        EXPECT_GT(serialStatistics.refinementDuration, Duration::Zero());
+        EXPECT_GT(serialStatistics.generationDuration, Duration::Zero());
+        EXPECT_GE(
+            serialStatistics.totalDuration,
+            serialStatistics.samplingDuration + serialStatistics.refinementDuration +
+                serialStatistics.generationDuration
+        );
+
+        // accumulated over computations, until reset
+
+        generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+        EXPECT_EQ(2, generator.getStatistics().computationCount);
+        EXPECT_EQ(2 * sampleCount, generator.getStatistics().sampleCount);
+
+        generator.resetStatistics();
+
+        EXPECT_EQ(0, generator.getStatistics().computationCount);
+        EXPECT_EQ(0, generator.getStatistics().sampleCount);
+        EXPECT_EQ(Duration::Zero(), generator.getStatistics().totalDuration);
+
+        // copies hold their own statistics
+
+        generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+        const Generator generatorCopy = generator;
+
+        generator.resetStatistics();
+
+        EXPECT_EQ(1, generatorCopy.getStatistics().computationCount);
+        EXPECT_EQ(0, generator.getStatistics().computationCount);
+
+        // no collection once disabled
+
+        generator.setStatisticsEnabled(false);
+
+        generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+        EXPECT_EQ(0, generator.getStatistics().computationCount);
+    }
+
+    // Counters do not depend on the thread count
+
+    {
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStatisticsEnabled(true);
+        generator.setThreadCount(4);
+
+        generator.computeAccesses(interval, accessTargets, toTrajectory);
+
+        const Generator::Statistics statistics = generator.getStatistics();
+
+        EXPECT_EQ(serialStatistics.sampleCount, statistics.sampleCount);
+        EXPECT_EQ(serialStatistics.trajectoryEvaluationCount, statistics.trajectoryEvaluationCount);
+        EXPECT_EQ(serialStatistics.frameTransformCount, statistics.frameTransformCount);
+        EXPECT_EQ(serialStatistics.crossingCount, statistics.crossingCount);
+        EXPECT_EQ(serialStatistics.rootSolverIterationCount, statistics.rootSolverIterationCount);
+        EXPECT_EQ(serialStatistics.closestApproachEvaluationCount, statistics.closestApproachEvaluationCount);
+        EXPECT_EQ(serialStatistics.accessCount, statistics.accessCount);
+    }
+
+    // Ephemeris
+
+    {
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStatisticsEnabled(true);
+
+        const Ephemeris ephemeris = generator.generateEphemeris(interval, toTrajectory);
+
+        generator.computeAccesses(interval, accessTargets, ephemeris);
+
+        const Generator::Statistics statistics = generator.getStatistics();
+
+        EXPECT_EQ(sampleCount, statistics.sampleCount);
+        EXPECT_EQ(sampleCount, statistics.ephemerisLookupCount);
+        EXPECT_EQ(serialStatistics.crossingCount, statistics.crossingCount);
+        EXPECT_EQ(serialStatistics.trajectoryEvaluationCount - sampleCount, statistics.trajectoryEvaluationCount);
+    }
+
+    // Trajectory targets
+
+    {
+        Generator generator = {defaultEnvironment_, defaultStep_, defaultTolerance_};
+        generator.setStatisticsEnabled(true);
+
+        const AccessTarget trajectoryTarget = AccessTarget::FromTrajectory(
+            visibilityCriterion,
+            Trajectory::Position(Position::Meters(
+                LLAs[0].toCartesian(defaultEarthSPtr_->getEquatorialRadius(), defaultEarthSPtr_->getFlattening()),
+                Frame::ITRF()
+            ))
+        );
+
+        const Array<Access> accesses = generator.computeAccesses(interval, trajectoryTarget, toTrajectory);
+
+        const Generator::Statistics statistics = generator.getStatistics();
+
+        EXPECT_EQ(1, statistics.computationCount);
+        EXPECT_EQ(sampleCount, statistics.sampleCount);
+        EXPECT_EQ(accesses.getSize(), statistics.accessCount);
+
+        // crossings are refined by the temporal condition solver while sampling
+        EXPECT_GE(statistics.crossingCount, accesses.getSize());
+        EXPECT_LE(statistics.crossingCount, 2 * accesses.getSize());
+        EXPECT_GE(statistics.rootSolverIterationCount, statistics.crossingCount);
+        EXPECT_EQ(Duration::Zero(), statistics.refinementDuration);
+        EXPECT_GT(statistics.samplingDuration, Duration::Zero());
+
+        // two trajectory evaluations per condition evaluation, per range evaluation, and per maximum elevation
+        ASSERT_EQ(0, statistics.trajectoryEvaluationCount % 2);
+
+        const Size conditionEvaluationCount =
+            (statistics.trajectoryEvaluationCount / 2) - statistics.closestApproachEvaluationCount - accesses.getSize();
+
+        EXPECT_GT(conditionEvaluationCount, sampleCount);
+
+        // five frame transforms per condition evaluation (both positions to the body frame, then the AER of the
+        // observer from the target), and two per range evaluation and per maximum elevation
+        EXPECT_EQ(
+            (5 * conditionEvaluationCount) + (2 * (statistics.closestApproachEvaluationCount + accesses.getSize())),
+            statistics.frameTransformCount
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Access_Generator, Undefined)
 {
     {
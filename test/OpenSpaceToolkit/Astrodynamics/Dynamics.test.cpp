@@ -2,8 +2,11 @@
 
 #include <gmock/gmock.h>
 
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 
 #include <Global.test.hpp>
@@ -11,14 +14,17 @@
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::Environment;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::Dynamics;
@@ -44,6 +50,13 @@ class DynamicsMock : public Dynamics
         (const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr),
         (const, override)
     );
+
+    MOCK_METHOD(
+        MatrixXd,
+        computeContributions,
+        (const Instant& anInstant, const MatrixXd& aStateMatrix, const Shared<const Frame>& aFrameSPtr),
+        (const, override)
+    );
 };
 
 class OpenSpaceToolkit_Astrodynamics_Dynamics : public ::testing::Test
@@ -79,6 +92,47 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, Getters)
 {
     {
         EXPECT_EQ(defaultName_, defaultDynamics_.getName());
+        EXPECT_FALSE(defaultDynamics_.isMultiRateEvaluationEnabled());
+        EXPECT_FALSE(defaultDynamics_.getMultiRateMaximumInterval().isDefined());
+        EXPECT_FALSE(defaultDynamics_.getMultiRateTolerance().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, SetMultiRateEvaluation)
+{
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        dynamics.setMultiRateEvaluation(Duration::Minutes(2.0), 1.0e-9);
+
+        EXPECT_TRUE(dynamics.isMultiRateEvaluationEnabled());
+        EXPECT_EQ(Duration::Minutes(2.0), dynamics.getMultiRateMaximumInterval());
+        EXPECT_EQ(1.0e-9, dynamics.getMultiRateTolerance());
+
+        dynamics.disableMultiRateEvaluation();
+
+        EXPECT_FALSE(dynamics.isMultiRateEvaluationEnabled());
+        EXPECT_FALSE(dynamics.getMultiRateMaximumInterval().isDefined());
+        EXPECT_FALSE(dynamics.getMultiRateTolerance().isDefined());
+    }
+
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        EXPECT_THROW(
+            dynamics.setMultiRateEvaluation(Duration::Undefined(), 1.0e-9), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(dynamics.setMultiRateEvaluation(Duration::Zero(), 1.0e-9), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            dynamics.setMultiRateEvaluation(Duration::Seconds(-1.0), 1.0e-9), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            dynamics.setMultiRateEvaluation(Duration::Minutes(2.0), Real::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(dynamics.setMultiRateEvaluation(Duration::Minutes(2.0), 0.0), ostk::core::error::runtime::Wrong);
+
+        EXPECT_FALSE(dynamics.isMultiRateEvaluationEnabled());
     }
 }
 
@@ -88,3 +142,190 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, FromEnvironment)
         EXPECT_NO_THROW(Dynamics::FromEnvironment(Environment::Default()));
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, ComputeContributionInPlace)
+{
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        VectorXd expectedContribution(3);
+        expectedContribution << 1.0, 2.0, 3.0;
+
+        EXPECT_CALL(dynamics, computeContribution(testing::_, testing::_, testing::_))
+            .WillOnce(testing::Return(expectedContribution));
+
+        VectorXd contribution = VectorXd::Zero(5);
+        Dynamics::TransformCache transformCache;
+
+        dynamics.computeContributionInPlace(
+            Instant::J2000(), VectorXd::Ones(6), Frame::GCRF(), contribution.segment(1, 3), transformCache
+        );
+
+        EXPECT_EQ(0.0, contribution[0]);
+        EXPECT_EQ(expectedContribution, contribution.segment(1, 3));
+        EXPECT_EQ(0.0, contribution[4]);
+        EXPECT_EQ(0, transformCache.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, ComputeContributionsInPlace)
+{
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        const MatrixXd expectedContributions = MatrixXd::Constant(4, 3, 2.0);
+
+        EXPECT_CALL(dynamics, computeContributions(testing::_, testing::_, testing::_))
+            .WillOnce(testing::Return(expectedContributions));
+
+        MatrixXd contributions = MatrixXd::Zero(4, 3);
+        Dynamics::TransformCache transformCache;
+
+        dynamics.computeContributionsInPlace(
+            Instant::J2000(), MatrixXd::Ones(4, 6), Frame::GCRF(), contributions, transformCache
+        );
+
+        EXPECT_EQ(expectedContributions, contributions);
+        EXPECT_EQ(0, transformCache.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, ComputeContributionJacobianInPlace)
+{
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        EXPECT_FALSE(dynamics.hasContributionJacobian());
+
+        MatrixXd jacobian = MatrixXd::Zero(3, 3);
+        Dynamics::TransformCache transformCache;
+
+        EXPECT_THROW(
+            dynamics.computeContributionJacobianInPlace(
+                Instant::J2000(), VectorXd::Ones(3), Frame::GCRF(), jacobian, transformCache
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, TransformCache)
+{
+    const Instant instant = Instant::J2000();
+    const Instant anotherInstant = instant + Duration::Minutes(1.0);
+
+    {
+        Dynamics::TransformCache transformCache;
+
+        EXPECT_EQ(0, transformCache.getSize());
+
+        EXPECT_EQ(
+            Frame::GCRF()->getTransformTo(Frame::ITRF(), instant),
+            transformCache.getTransform(Frame::GCRF(), Frame::ITRF(), instant)
+        );
+        EXPECT_EQ(1, transformCache.getSize());
+
+        EXPECT_EQ(
+            Frame::GCRF()->getTransformTo(Frame::ITRF(), instant),
+            transformCache.getTransform(Frame::GCRF(), Frame::ITRF(), instant)
+        );
+        EXPECT_EQ(1, transformCache.getSize());
+
+        EXPECT_EQ(
+            Frame::ITRF()->getTransformTo(Frame::GCRF(), instant),
+            transformCache.getTransform(Frame::ITRF(), Frame::GCRF(), instant)
+        );
+        EXPECT_EQ(2, transformCache.getSize());
+
+        EXPECT_EQ(
+            Frame::GCRF()->getTransformTo(Frame::ITRF(), anotherInstant),
+            transformCache.getTransform(Frame::GCRF(), Frame::ITRF(), anotherInstant)
+        );
+        EXPECT_EQ(1, transformCache.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, MultiRateCache)
+{
+    const Instant startInstant = Instant::J2000();
+
+    // A contribution linear in time, that the two latest samples predict exactly
+    const auto linearContribution = [startInstant](const Instant& anInstant) -> VectorXd
+    {
+        const double time = (anInstant - startInstant).inSeconds();
+
+        VectorXd contribution(3);
+        contribution << 1.0 + 0.5 * time, -2.0 * time, 3.0;
+
+        return contribution;
+    };
+
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        EXPECT_CALL(dynamics, computeContribution(testing::_, testing::_, testing::_))
+            .WillRepeatedly(testing::Invoke(
+                [&linearContribution](const Instant& anInstant, const VectorXd&, const Shared<const Frame>&) -> VectorXd
+                {
+                    return linearContribution(anInstant);
+                }
+            ));
+
+        Dynamics::MultiRateCache multiRateCache = {Duration::Seconds(16.0), 1.0e-9, 3};
+        Dynamics::TransformCache transformCache;
+
+        EXPECT_EQ(Duration::Seconds(2.0), multiRateCache.getInterval());
+        EXPECT_EQ(0, multiRateCache.getEvaluationCount());
+
+        VectorXd contribution = VectorXd::Zero(3);
+        Size callCount = 0;
+
+        for (double time = 0.0; time <= 200.0; time += 0.5)
+        {
+            const Instant instant = startInstant + Duration::Seconds(time);
+
+            multiRateCache.computeContribution(
+                dynamics, instant, time, VectorXd::Zero(6), Frame::GCRF(), contribution, transformCache
+            );
+            ++callCount;
+
+            EXPECT_TRUE(contribution.isApprox(linearContribution(instant), 1e-12));
+        }
+
+        EXPECT_EQ(Duration::Seconds(16.0), multiRateCache.getInterval());
+        EXPECT_LT(multiRateCache.getEvaluationCount(), callCount / 10);
+    }
+
+    {
+        DynamicsMock dynamics = {defaultName_};
+
+        // A contribution oscillating faster than the maximum interval
+        EXPECT_CALL(dynamics, computeContribution(testing::_, testing::_, testing::_))
+            .WillRepeatedly(testing::Invoke(
+                [startInstant](const Instant& anInstant, const VectorXd&, const Shared<const Frame>&) -> VectorXd
+                {
+                    return VectorXd::Constant(3, std::sin((anInstant - startInstant).inSeconds() / 4.0));
+                }
+            ));
+
+        Dynamics::MultiRateCache multiRateCache = {Duration::Seconds(16.0), 1.0e-6, 3};
+        Dynamics::TransformCache transformCache;
+
+        VectorXd contribution = VectorXd::Zero(3);
+
+        for (double time = 0.0; time <= 200.0; time += 0.5)
+        {
+            multiRateCache.computeContribution(
+                dynamics,
+                startInstant + Duration::Seconds(time),
+                time,
+                VectorXd::Zero(6),
+                Frame::GCRF(),
+                contribution,
+                transformCache
+            );
+        }
+
+        EXPECT_LT(multiRateCache.getInterval(), Duration::Seconds(1.0));
+    }
+}
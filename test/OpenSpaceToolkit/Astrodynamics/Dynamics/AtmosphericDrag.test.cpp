@@ -10,6 +10,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
@@ -47,6 +48,7 @@ using ostk::mathematics::geometry::d3::object::Composite;
 using ostk::mathematics::geometry::d3::object::Cuboid;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
@@ -245,3 +247,112 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContribut
     EXPECT_GT(5e-11, -0.0000278707803890 - contribution[1]);
     EXPECT_GT(5e-11, -0.0000000000197640 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContributionInPlace)
+{
+    const AtmosphericDrag atmosphericDrag(earthSPtr_);
+
+    VectorXd stateDerivative = VectorXd::Zero(6);
+    Dynamics::TransformCache transformCache;
+
+    atmosphericDrag.computeContributionInPlace(
+        startInstant_, startStateVector_, Frame::GCRF(), stateDerivative.segment(3, 3), transformCache
+    );
+
+    EXPECT_TRUE(stateDerivative.head(3).isZero());
+    EXPECT_TRUE(stateDerivative.tail(3).isApprox(
+        atmosphericDrag.computeContribution(startInstant_, startStateVector_, Frame::GCRF()), 1e-15
+    ));
+
+    // A second evaluation at the same instant reuses the memoized transform
+    {
+        VectorXd contribution = VectorXd::Zero(3);
+
+        atmosphericDrag.computeContributionInPlace(
+            startInstant_, startStateVector_, Frame::GCRF(), contribution, transformCache
+        );
+
+        EXPECT_EQ(stateDerivative.tail(3), contribution);
+        EXPECT_EQ(1, transformCache.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContributions)
+{
+    const AtmosphericDrag atmosphericDrag(earthSPtr_);
+
+    MatrixXd stateMatrix(3, 9);
+    stateMatrix.row(0) = startStateVector_.transpose();
+    stateMatrix.row(1) = startStateVector_.transpose();
+    stateMatrix.row(2) = startStateVector_.transpose();
+
+    stateMatrix(1, 0) = 6800000.0;
+    stateMatrix(1, 6) = 250.0;
+    stateMatrix(2, 1) = 500000.0;
+    stateMatrix(2, 5) = 1000.0;
+    stateMatrix(2, 8) = 2.0;
+
+    const MatrixXd contributions = atmosphericDrag.computeContributions(startInstant_, stateMatrix, Frame::GCRF());
+
+    ASSERT_EQ(3, contributions.rows());
+    ASSERT_EQ(3, contributions.cols());
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        const VectorXd contribution =
+            atmosphericDrag.computeContribution(startInstant_, stateMatrix.row(i).transpose(), Frame::GCRF());
+
+        EXPECT_TRUE(contributions.row(i).transpose().isApprox(contribution, 1e-12));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContributionJacobian)
+{
+    const AtmosphericDrag atmosphericDrag(earthSPtr_);
+
+    EXPECT_TRUE(atmosphericDrag.hasContributionJacobian());
+
+    VectorXd stateVector = startStateVector_;
+    stateVector.head(6) << 4000000.0, -5000000.0, 2000000.0, 5000.0, 3000.0, 3500.0;
+
+    const MatrixXd jacobian = atmosphericDrag.computeContributionJacobian(startInstant_, stateVector, Frame::GCRF());
+
+    ASSERT_EQ(3, jacobian.rows());
+    ASSERT_EQ(9, jacobian.cols());
+
+    // Central differences of the contribution, with a step scaled to each coordinate
+    const Array<Real> steps = {10.0, 10.0, 10.0, 1e-3, 1e-3, 1e-3, 1e-3, 1e-5, 1e-5};
+
+    for (Index k = 0; k < 9; ++k)
+    {
+        VectorXd stateVectorForward = stateVector;
+        VectorXd stateVectorBackward = stateVector;
+        stateVectorForward[k] += steps[k];
+        stateVectorBackward[k] -= steps[k];
+
+        const VectorXd expectedColumn =
+            (atmosphericDrag.computeContribution(startInstant_, stateVectorForward, Frame::GCRF()) -
+             atmosphericDrag.computeContribution(startInstant_, stateVectorBackward, Frame::GCRF())) /
+            (2.0 * steps[k]);
+
+        EXPECT_TRUE(jacobian.col(k).isApprox(expectedColumn, 1e-4)) << k;
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContributionJacobianInPlace)
+{
+    const AtmosphericDrag atmosphericDrag(earthSPtr_);
+
+    VectorXd stateVector = startStateVector_;
+    stateVector.head(6) << 4000000.0, -5000000.0, 2000000.0, 5000.0, 3000.0, 3500.0;
+
+    MatrixXd jacobian = MatrixXd::Zero(3, 9);
+    Dynamics::TransformCache transformCache;
+
+    atmosphericDrag.computeContributionJacobianInPlace(
+        startInstant_, stateVector, Frame::GCRF(), jacobian, transformCache
+    );
+
+    EXPECT_EQ(atmosphericDrag.computeContributionJacobian(startInstant_, stateVector, Frame::GCRF()), jacobian);
+    EXPECT_EQ(1, transformCache.getSize());
+}
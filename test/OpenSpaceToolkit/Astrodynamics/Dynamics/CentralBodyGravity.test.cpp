@@ -7,6 +7,7 @@
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Analytical.hpp>
@@ -29,10 +30,13 @@
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -193,6 +197,77 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, GetCelestial)
     EXPECT_TRUE(centralBodyGravity.getCelestial() == sphericalEarthSPtr_);
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, SetTruncationTolerance)
+{
+    {
+        CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_);
+
+        EXPECT_FALSE(centralBodyGravity.getTruncationTolerance().isDefined());
+        EXPECT_FALSE(centralBodyGravity.getTruncationDegreeAt(7000000.0).isDefined());
+
+        EXPECT_THROW(centralBodyGravity.setTruncationTolerance(1.0e-9), ostk::core::error::RuntimeError);
+    }
+
+    {
+        CentralBodyGravity centralBodyGravity(std::make_shared<Celestial>(Earth::EGM96(20, 20)));
+
+        EXPECT_THROW(centralBodyGravity.setTruncationTolerance(0.0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(centralBodyGravity.setTruncationTolerance(-1.0e-9), ostk::core::error::runtime::Wrong);
+
+        centralBodyGravity.setTruncationTolerance(1.0e-9);
+
+        EXPECT_EQ(1.0e-9, centralBodyGravity.getTruncationTolerance());
+        EXPECT_THROW(
+            centralBodyGravity.getTruncationDegreeAt(Real::Undefined()), ostk::core::error::runtime::Undefined
+        );
+
+        // The effective degree decreases with the radius, from the full degree in low Earth orbit
+        EXPECT_EQ(20, centralBodyGravity.getTruncationDegreeAt(7000000.0));
+        EXPECT_LT(centralBodyGravity.getTruncationDegreeAt(42164000.0), 20);
+        EXPECT_GE(centralBodyGravity.getTruncationDegreeAt(42164000.0), 2);
+        EXPECT_LE(
+            centralBodyGravity.getTruncationDegreeAt(42164000.0), centralBodyGravity.getTruncationDegreeAt(20000000.0)
+        );
+
+        centralBodyGravity.setTruncationTolerance(Real::Undefined());
+
+        EXPECT_FALSE(centralBodyGravity.getTruncationTolerance().isDefined());
+        EXPECT_FALSE(centralBodyGravity.getTruncationDegreeAt(7000000.0).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContribution_Truncated)
+{
+    const Shared<Celestial> earthSPtr = std::make_shared<Celestial>(Earth::EGM96(20, 20));
+
+    const CentralBodyGravity centralBodyGravity(earthSPtr);
+
+    CentralBodyGravity truncatedCentralBodyGravity(earthSPtr);
+    truncatedCentralBodyGravity.setTruncationTolerance(1.0e-9);
+
+    for (const double& radius : {7000000.0, 20000000.0, 42164000.0})
+    {
+        VectorXd positionCoordinates(3);
+        positionCoordinates << 0.6 * radius, -0.64 * radius, 0.48 * radius;
+
+        const VectorXd contribution =
+            centralBodyGravity.computeContribution(startInstant_, positionCoordinates, Frame::GCRF());
+        const VectorXd truncatedContribution =
+            truncatedCentralBodyGravity.computeContribution(startInstant_, positionCoordinates, Frame::GCRF());
+
+        // Kaula's rule is a statistical estimate, allow for an order of magnitude
+        EXPECT_LT((contribution - truncatedContribution).norm(), 1.0e-8);
+
+        MatrixXd stateMatrix(1, 3);
+        stateMatrix.row(0) = positionCoordinates.transpose();
+
+        EXPECT_TRUE(truncatedCentralBodyGravity.computeContributions(startInstant_, stateMatrix, Frame::GCRF())
+                        .row(0)
+                        .transpose()
+                        .isApprox(truncatedContribution, 1e-12));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, GetReadCoordinateSubsets)
 {
     const CentralBodyGravity centralBodyGravity = CentralBodyGravity(sphericalEarthSPtr_);
@@ -225,3 +300,167 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContri
     EXPECT_GT(1e-15, 0.0 - contribution[1]);
     EXPECT_GT(1e-15, 0.0 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContributionInPlace)
+{
+    for (const Shared<Celestial>& earthSPtr :
+         {sphericalEarthSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Earth::WGS84()))})
+    {
+        const CentralBodyGravity centralBodyGravity(earthSPtr);
+
+        VectorXd positionCoordinates(3);
+        positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+        VectorXd stateDerivative = VectorXd::Zero(6);
+        Dynamics::TransformCache transformCache;
+
+        centralBodyGravity.computeContributionInPlace(
+            startInstant_, positionCoordinates, Frame::GCRF(), stateDerivative.segment(3, 3), transformCache
+        );
+
+        EXPECT_TRUE(stateDerivative.head(3).isZero());
+        EXPECT_TRUE(stateDerivative.tail(3).isApprox(
+            centralBodyGravity.computeContribution(startInstant_, positionCoordinates, Frame::GCRF()), 1e-15
+        ));
+        EXPECT_GT(stateDerivative.tail(3).norm(), 0.0);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeFastContributionInPlace)
+{
+    VectorXd positionCoordinates(3);
+    positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+    {
+        const CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_);
+
+        VectorXd contribution = VectorXd::Zero(3);
+        Dynamics::TransformCache transformCache;
+
+        centralBodyGravity.computeFastContributionInPlace(
+            startInstant_, positionCoordinates, Frame::GCRF(), contribution, transformCache
+        );
+
+        EXPECT_TRUE(contribution.isApprox(
+            centralBodyGravity.computeContribution(startInstant_, positionCoordinates, Frame::GCRF()), 1e-12
+        ));
+    }
+
+    {
+        const CentralBodyGravity centralBodyGravity(std::make_shared<Celestial>(Earth::WGS84()));
+
+        VectorXd contribution = VectorXd::Zero(3);
+        Dynamics::TransformCache transformCache;
+
+        centralBodyGravity.computeFastContributionInPlace(
+            startInstant_, positionCoordinates, Frame::GCRF(), contribution, transformCache
+        );
+
+        const VectorXd fullContribution =
+            centralBodyGravity.computeContribution(startInstant_, positionCoordinates, Frame::GCRF());
+
+        // The remainder holds the higher order terms, dominated by J2
+        EXPECT_GT((fullContribution - contribution).norm(), 0.0);
+        EXPECT_LT((fullContribution - contribution).norm(), 1.0e-2 * fullContribution.norm());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContributions)
+{
+    MatrixXd stateMatrix(4, 3);
+    stateMatrix << 7000000.0, 0.0, 0.0, 0.0, 7100000.0, 0.0, 0.0, 0.0, 6900000.0, 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& earthSPtr :
+         {sphericalEarthSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Earth::WGS84()))})
+    {
+        const CentralBodyGravity centralBodyGravity(earthSPtr);
+
+        const MatrixXd contributions =
+            centralBodyGravity.computeContributions(startInstant_, stateMatrix, Frame::GCRF());
+
+        ASSERT_EQ(4, contributions.rows());
+        ASSERT_EQ(3, contributions.cols());
+
+        for (Index i = 0; i < 4; ++i)
+        {
+            const VectorXd contribution =
+                centralBodyGravity.computeContribution(startInstant_, stateMatrix.row(i).transpose(), Frame::GCRF());
+
+            EXPECT_TRUE(contributions.row(i).transpose().isApprox(contribution, 1e-12));
+        }
+
+        // The in-place evaluation writes into the given matrix and memoizes its transform in the given cache
+        MatrixXd inPlaceContributions = MatrixXd::Zero(4, 3);
+        Dynamics::TransformCache transformCache;
+
+        centralBodyGravity.computeContributionsInPlace(
+            startInstant_, stateMatrix, Frame::GCRF(), inPlaceContributions, transformCache
+        );
+
+        EXPECT_EQ(contributions, inPlaceContributions);
+        EXPECT_EQ(1, transformCache.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContributionJacobian)
+{
+    VectorXd positionCoordinates(3);
+    positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& earthSPtr :
+         {sphericalEarthSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Earth::WGS84()))})
+    {
+        const CentralBodyGravity centralBodyGravity(earthSPtr);
+
+        EXPECT_TRUE(centralBodyGravity.hasContributionJacobian());
+
+        const MatrixXd jacobian =
+            centralBodyGravity.computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF());
+
+        ASSERT_EQ(3, jacobian.rows());
+        ASSERT_EQ(3, jacobian.cols());
+
+        // Central differences of the contribution, with a 1 m step
+        MatrixXd expectedJacobian(3, 3);
+
+        for (Index k = 0; k < 3; ++k)
+        {
+            VectorXd positionCoordinatesForward = positionCoordinates;
+            VectorXd positionCoordinatesBackward = positionCoordinates;
+            positionCoordinatesForward[k] += 1.0;
+            positionCoordinatesBackward[k] -= 1.0;
+
+            expectedJacobian.col(k) =
+                (centralBodyGravity.computeContribution(startInstant_, positionCoordinatesForward, Frame::GCRF()) -
+                 centralBodyGravity.computeContribution(startInstant_, positionCoordinatesBackward, Frame::GCRF())) /
+                2.0;
+        }
+
+        // Only point mass and J2 partials are provided, higher order zonal terms are neglected
+        EXPECT_TRUE(jacobian.isApprox(expectedJacobian, 1e-5));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContributionJacobianInPlace)
+{
+    VectorXd positionCoordinates(3);
+    positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& earthSPtr :
+         {sphericalEarthSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Earth::WGS84()))})
+    {
+        const CentralBodyGravity centralBodyGravity(earthSPtr);
+
+        MatrixXd jacobian = MatrixXd::Zero(3, 3);
+        Dynamics::TransformCache transformCache;
+
+        centralBodyGravity.computeContributionJacobianInPlace(
+            startInstant_, positionCoordinates, Frame::GCRF(), jacobian, transformCache
+        );
+
+        EXPECT_EQ(
+            centralBodyGravity.computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF()), jacobian
+        );
+        EXPECT_EQ(1, transformCache.getSize());
+    }
+}
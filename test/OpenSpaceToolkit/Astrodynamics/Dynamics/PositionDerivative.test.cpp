@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
@@ -18,6 +19,7 @@
 using ostk::core::container::Array;
 using ostk::core::type::Shared;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -108,3 +110,26 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_PositionDerivative, ComputeContri
     EXPECT_EQ(startStateVector_[4], contribution[1]);
     EXPECT_EQ(startStateVector_[5], contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_PositionDerivative, ComputeContributions)
+{
+    MatrixXd stateMatrix(2, 3);
+    stateMatrix.row(0) = startStateVector_.segment(3, 3).transpose();
+    stateMatrix.row(1) = -startStateVector_.segment(3, 3).transpose();
+
+    const MatrixXd contributions =
+        positionDerivative_.computeContributions(startInstant_, stateMatrix, Frame::Undefined());
+
+    EXPECT_EQ(stateMatrix, contributions);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_PositionDerivative, ComputeContributionJacobian)
+{
+    EXPECT_TRUE(positionDerivative_.hasContributionJacobian());
+
+    const MatrixXd jacobian = positionDerivative_.computeContributionJacobian(
+        startInstant_, startStateVector_.segment(3, 3), Frame::Undefined()
+    );
+
+    EXPECT_EQ(MatrixXd::Identity(3, 3), jacobian);
+}
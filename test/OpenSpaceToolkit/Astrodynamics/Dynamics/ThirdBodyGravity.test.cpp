@@ -7,6 +7,7 @@
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Analytical.hpp>
@@ -14,7 +15,9 @@
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -34,6 +37,7 @@ using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -43,7 +47,9 @@ using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::environment::object::celestial::Moon;
 using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
@@ -56,6 +62,7 @@ using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::dynamics::thirdbodygravity::ChebyshevEphemeris;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
@@ -155,6 +162,34 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, Constructor)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ConstructorWithEphemeris)
+{
+    const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0));
+
+    {
+        EXPECT_NO_THROW(ThirdBodyGravity thirdBodyGravity(
+            sphericalMoonSPtr_, std::make_shared<ChebyshevEphemeris>(sphericalMoonSPtr_, interval)
+        ));
+    }
+
+    {
+        EXPECT_THROW(
+            ThirdBodyGravity thirdBodyGravity(sphericalMoonSPtr_, Shared<const ChebyshevEphemeris>(nullptr)),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        const Shared<Celestial> sunSPtr = std::make_shared<Celestial>(Sun::Spherical());
+        const Shared<const ChebyshevEphemeris> sunEphemerisSPtr =
+            std::make_shared<ChebyshevEphemeris>(sunSPtr, interval);
+
+        EXPECT_THROW(
+            ThirdBodyGravity thirdBodyGravity(sphericalMoonSPtr_, sunEphemerisSPtr), ostk::core::error::RuntimeError
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, IsDefined)
 {
     {
@@ -209,6 +244,21 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, GetCelestial)
     EXPECT_TRUE(defaultThirdBodyGravity_.getCelestial() == sphericalMoonSPtr_);
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, GetEphemeris)
+{
+    {
+        EXPECT_EQ(nullptr, defaultThirdBodyGravity_.getEphemeris());
+    }
+
+    {
+        const Shared<const ChebyshevEphemeris> ephemerisSPtr = std::make_shared<ChebyshevEphemeris>(
+            sphericalMoonSPtr_, Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0))
+        );
+
+        EXPECT_EQ(ephemerisSPtr, ThirdBodyGravity(sphericalMoonSPtr_, ephemerisSPtr).getEphemeris());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, GetReadCoordinateSubsets)
 {
     const Array<Shared<const CoordinateSubset>> subsets = defaultThirdBodyGravity_.getReadCoordinateSubsets();
@@ -235,3 +285,158 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContribu
     EXPECT_GT(1e-15, 2.948717888154649e-07 - contribution[1]);
     EXPECT_GT(1e-15, 1.301648617451192e-07 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContributionInPlace)
+{
+    VectorXd positionCoordinates(3);
+    positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+    VectorXd stateDerivative = VectorXd::Zero(6);
+    Dynamics::TransformCache transformCache;
+
+    defaultThirdBodyGravity_.computeContributionInPlace(
+        startInstant_, positionCoordinates, Frame::GCRF(), stateDerivative.segment(3, 3), transformCache
+    );
+
+    EXPECT_TRUE(stateDerivative.head(3).isZero());
+    EXPECT_TRUE(stateDerivative.tail(3).isApprox(
+        defaultThirdBodyGravity_.computeContribution(startInstant_, positionCoordinates, Frame::GCRF()), 1e-15
+    ));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContributions)
+{
+    MatrixXd stateMatrix(4, 3);
+    stateMatrix << 7000000.0, 0.0, 0.0, 0.0, 7100000.0, 0.0, 0.0, 0.0, 6900000.0, 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& celestialSPtr :
+         {sphericalMoonSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Sun::Spherical()))})
+    {
+        const ThirdBodyGravity thirdBodyGravity(celestialSPtr);
+
+        const MatrixXd contributions = thirdBodyGravity.computeContributions(startInstant_, stateMatrix, Frame::GCRF());
+
+        ASSERT_EQ(4, contributions.rows());
+        ASSERT_EQ(3, contributions.cols());
+
+        for (Index i = 0; i < 4; ++i)
+        {
+            const VectorXd contribution =
+                thirdBodyGravity.computeContribution(startInstant_, stateMatrix.row(i).transpose(), Frame::GCRF());
+
+            EXPECT_TRUE(contributions.row(i).transpose().isApprox(contribution, 1e-9));
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContributionWithEphemeris)
+{
+    const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0));
+
+    MatrixXd stateMatrix(4, 3);
+    stateMatrix << 7000000.0, 0.0, 0.0, 0.0, 7100000.0, 0.0, 0.0, 0.0, 6900000.0, 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& celestialSPtr :
+         {sphericalMoonSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Sun::Spherical()))})
+    {
+        const ThirdBodyGravity thirdBodyGravity(celestialSPtr);
+        const ThirdBodyGravity interpolatedThirdBodyGravity(
+            celestialSPtr, std::make_shared<ChebyshevEphemeris>(celestialSPtr, interval)
+        );
+
+        for (const Instant& instant : interval.generateGrid(Duration::Seconds(7919.0)))
+        {
+            const MatrixXd contributions =
+                interpolatedThirdBodyGravity.computeContributions(instant, stateMatrix, Frame::GCRF());
+
+            for (Index i = 0; i < 4; ++i)
+            {
+                const VectorXd expectedContribution =
+                    thirdBodyGravity.computeContribution(instant, stateMatrix.row(i).transpose(), Frame::GCRF());
+
+                EXPECT_TRUE(interpolatedThirdBodyGravity
+                                .computeContribution(instant, stateMatrix.row(i).transpose(), Frame::GCRF())
+                                .isApprox(expectedContribution, 1e-6));
+                EXPECT_TRUE(contributions.row(i).transpose().isApprox(expectedContribution, 1e-6));
+            }
+        }
+
+        // Outside of the ephemeris interval, or in another frame, the full ephemeris path is used
+        {
+            const Instant instant = interval.accessEnd() + Duration::Hours(1.0);
+
+            EXPECT_EQ(
+                thirdBodyGravity.computeContribution(instant, startStateVector_.head(3), Frame::GCRF()),
+                interpolatedThirdBodyGravity.computeContribution(instant, startStateVector_.head(3), Frame::GCRF())
+            );
+            EXPECT_EQ(
+                thirdBodyGravity.computeContribution(startInstant_, startStateVector_.head(3), Frame::ITRF()),
+                interpolatedThirdBodyGravity.computeContribution(
+                    startInstant_, startStateVector_.head(3), Frame::ITRF()
+                )
+            );
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContributionJacobian)
+{
+    VectorXd positionCoordinates(3);
+    positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& celestialSPtr :
+         {sphericalMoonSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Sun::Spherical()))})
+    {
+        const ThirdBodyGravity thirdBodyGravity(celestialSPtr);
+
+        EXPECT_TRUE(thirdBodyGravity.hasContributionJacobian());
+
+        const MatrixXd jacobian =
+            thirdBodyGravity.computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF());
+
+        ASSERT_EQ(3, jacobian.rows());
+        ASSERT_EQ(3, jacobian.cols());
+
+        // Central differences of the contribution, with a 1 km step
+        MatrixXd expectedJacobian(3, 3);
+
+        for (Index k = 0; k < 3; ++k)
+        {
+            VectorXd positionCoordinatesForward = positionCoordinates;
+            VectorXd positionCoordinatesBackward = positionCoordinates;
+            positionCoordinatesForward[k] += 1000.0;
+            positionCoordinatesBackward[k] -= 1000.0;
+
+            expectedJacobian.col(k) =
+                (thirdBodyGravity.computeContribution(startInstant_, positionCoordinatesForward, Frame::GCRF()) -
+                 thirdBodyGravity.computeContribution(startInstant_, positionCoordinatesBackward, Frame::GCRF())) /
+                2000.0;
+        }
+
+        EXPECT_TRUE(jacobian.isApprox(expectedJacobian, 1e-6));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContributionJacobianInPlace)
+{
+    VectorXd positionCoordinates(3);
+    positionCoordinates << 4000000.0, -5000000.0, 3000000.0;
+
+    for (const Shared<Celestial>& celestialSPtr :
+         {sphericalMoonSPtr_, Shared<Celestial>(std::make_shared<Celestial>(Sun::Spherical()))})
+    {
+        const ThirdBodyGravity thirdBodyGravity(celestialSPtr);
+
+        MatrixXd jacobian = MatrixXd::Zero(3, 3);
+        Dynamics::TransformCache transformCache;
+
+        thirdBodyGravity.computeContributionJacobianInPlace(
+            startInstant_, positionCoordinates, Frame::GCRF(), jacobian, transformCache
+        );
+
+        EXPECT_EQ(
+            thirdBodyGravity.computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF()), jacobian
+        );
+        EXPECT_EQ(1, transformCache.getSize());
+    }
+}
@@ -0,0 +1,157 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity/ChebyshevEphemeris.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Moon;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::dynamics::thirdbodygravity::ChebyshevEphemeris;
+
+class OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris : public ::testing::Test
+{
+   protected:
+    const Instant startInstant_ = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Days(2.0));
+
+    const Shared<const Celestial> moonSPtr_ = std::make_shared<Celestial>(Moon::Spherical());
+    const Shared<const Celestial> sunSPtr_ = std::make_shared<Celestial>(Sun::Spherical());
+
+    const ChebyshevEphemeris moonEphemeris_ = {moonSPtr_, interval_};
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris, Constructor)
+{
+    {
+        EXPECT_NO_THROW(ChebyshevEphemeris(moonSPtr_, interval_));
+        EXPECT_NO_THROW(ChebyshevEphemeris(sunSPtr_, interval_, Length::Meters(10.0), Frame::GCRF(), 8));
+    }
+
+    {
+        EXPECT_NO_THROW(ChebyshevEphemeris(moonSPtr_, Interval::Closed(startInstant_, startInstant_)));
+    }
+
+    {
+        EXPECT_THROW(ChebyshevEphemeris(nullptr, interval_), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(ChebyshevEphemeris(moonSPtr_, Interval::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            ChebyshevEphemeris(moonSPtr_, interval_, Length::Meters(1.0), Frame::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            ChebyshevEphemeris(moonSPtr_, interval_, Length::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(ChebyshevEphemeris(moonSPtr_, interval_, Length::Meters(0.0)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            ChebyshevEphemeris(moonSPtr_, interval_, Length::Meters(1.0), Frame::GCRF(), 0),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris, Accessors)
+{
+    {
+        EXPECT_TRUE(moonEphemeris_.isDefined());
+        EXPECT_EQ(moonSPtr_, moonEphemeris_.accessCelestial());
+        EXPECT_EQ(interval_, moonEphemeris_.accessInterval());
+        EXPECT_EQ(*Frame::GCRF(), *moonEphemeris_.accessFrame());
+        EXPECT_EQ(Length::Meters(1.0), moonEphemeris_.getTolerance());
+        EXPECT_EQ(12, moonEphemeris_.getDegree());
+        EXPECT_LE(1, moonEphemeris_.getSegmentCount());
+    }
+
+    {
+        const ChebyshevEphemeris tighterEphemeris = {moonSPtr_, interval_, Length::Meters(1e-3)};
+
+        EXPECT_GE(tighterEphemeris.getSegmentCount(), moonEphemeris_.getSegmentCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris, Contains)
+{
+    {
+        EXPECT_TRUE(moonEphemeris_.contains(startInstant_));
+        EXPECT_TRUE(moonEphemeris_.contains(startInstant_ + Duration::Days(1.0)));
+        EXPECT_TRUE(moonEphemeris_.contains(startInstant_ + Duration::Days(2.0)));
+    }
+
+    {
+        EXPECT_FALSE(moonEphemeris_.contains(startInstant_ - Duration::Seconds(1.0)));
+        EXPECT_FALSE(moonEphemeris_.contains(startInstant_ + Duration::Days(3.0)));
+        EXPECT_FALSE(moonEphemeris_.contains(Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity_ChebyshevEphemeris, ComputePositionAt)
+{
+    for (const Shared<const Celestial>& celestialSPtr : {moonSPtr_, sunSPtr_})
+    {
+        for (const double& tolerance : {1.0, 1e-3})
+        {
+            const ChebyshevEphemeris ephemeris = {celestialSPtr, interval_, Length::Meters(tolerance)};
+
+            // Off-node instants, including both bounds
+            Array<Instant> instants = interval_.generateGrid(Duration::Seconds(3541.0));
+            instants.add(interval_.accessEnd());
+
+            for (const Instant& instant : instants)
+            {
+                const Vector3d expectedPosition =
+                    celestialSPtr->getPositionIn(Frame::GCRF(), instant).inMeters().getCoordinates();
+
+                // The fit is only checked at discrete points, allow some margin in between
+                EXPECT_LT((ephemeris.computePositionAt(instant) - expectedPosition).norm(), 2.0 * tolerance);
+            }
+        }
+    }
+
+    {
+        const ChebyshevEphemeris ephemeris = {moonSPtr_, Interval::Closed(startInstant_, startInstant_)};
+
+        EXPECT_LT(
+            (ephemeris.computePositionAt(startInstant_) -
+             moonSPtr_->getPositionIn(Frame::GCRF(), startInstant_).inMeters().getCoordinates())
+                .norm(),
+            1e-6
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            moonEphemeris_.computePositionAt(startInstant_ + Duration::Days(3.0)), ostk::core::error::RuntimeError
+        );
+    }
+}
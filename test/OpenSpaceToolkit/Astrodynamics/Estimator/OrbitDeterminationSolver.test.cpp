@@ -217,6 +217,15 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_OrbitDeterminationSolver, Accessors
         EXPECT_TRUE(odSolver.accessPropagator().isDefined());
         EXPECT_NO_THROW(odSolver.accessSolver());
         EXPECT_EQ(odSolver.accessEstimationFrame()->getName(), "GCRF");
+        EXPECT_FALSE(odSolver.isStateTransitionMatrixPropagated());
+    }
+
+    {
+        const OrbitDeterminationSolver odSolver(
+            environment_, numericalSolver_, leastSquaresSolver_, estimationFrame_, true
+        );
+
+        EXPECT_TRUE(odSolver.isStateTransitionMatrixPropagated());
     }
 }
 
@@ -283,6 +292,30 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_OrbitDeterminationSolver, Estimate)
         EXPECT_EQ(analysis.solverAnalysis.terminationCriteria, "RMS Update Threshold");
         EXPECT_LT(analysis.solverAnalysis.rmsError, 2.0);
     }
+
+    // Test with the state transition matrix propagated alongside the state
+    {
+        const OrbitDeterminationSolver odSolver = {
+            environment_, numericalSolver_, leastSquaresSolver_, estimationFrame_, true
+        };
+
+        const OrbitDeterminationSolver::Analysis analysis =
+            odSolver.estimate(observationStates_[0], observationStates_);
+
+        EXPECT_EQ(*estimationFrame_, *analysis.estimatedState.accessFrame());
+        EXPECT_EQ(analysis.solverAnalysis.terminationCriteria, "RMS Update Threshold");
+        EXPECT_LT(analysis.solverAnalysis.rmsError, 2.0);
+
+        const OrbitDeterminationSolver::Analysis finiteDifferenceAnalysis =
+            odSolver_.estimate(observationStates_[0], observationStates_);
+
+        EXPECT_LT(
+            (analysis.estimatedState.getPosition().getCoordinates() -
+             finiteDifferenceAnalysis.estimatedState.getPosition().getCoordinates())
+                .norm(),
+            1.0
+        );
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_OrbitDeterminationSolver, Estimate_Failures)
@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <numeric>
+#include <thread>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
@@ -67,6 +68,7 @@ using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 using ostk::astrodynamics::trajectory::orbit::model::Propagated;
+using ostk::astrodynamics::trajectory::orbit::model::propagated::CheckpointStore;
 using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
@@ -826,3 +828,137 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, ToTabul
         );
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, Checkpointing)
+{
+    // Spans 24 segments of 10 minutes
+    const Array<Instant> instants =
+        Interval::Closed(
+            defaultInstant_ - Duration::Hours(1.0), defaultInstant_ + Duration::Hours(3.0) - Duration::Seconds(1.0)
+        )
+            .generateGrid(Duration::Seconds(47.0));
+
+    const Array<State> referenceStates = Propagated(propagator_, defaultState_).calculateStatesAt(instants);
+
+    const auto validateStates = [&instants, &referenceStates](const Array<State>& aStateArray) -> void
+    {
+        ASSERT_EQ(referenceStates.getSize(), aStateArray.getSize());
+
+        for (Size k = 0; k < aStateArray.getSize(); ++k)
+        {
+            EXPECT_EQ(instants[k], aStateArray[k].accessInstant());
+            EXPECT_LT(
+                (aStateArray[k].getPosition().getCoordinates() - referenceStates[k].getPosition().getCoordinates())
+                    .norm(),
+                1e-3
+            );
+            EXPECT_LT(
+                (aStateArray[k].getVelocity().getCoordinates() - referenceStates[k].getVelocity().getCoordinates())
+                    .norm(),
+                1e-6
+            );
+        }
+    };
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        EXPECT_FALSE(propagatedModel.isCheckpointingEnabled());
+        EXPECT_THROW(propagatedModel.accessCheckpointStore(), ostk::core::error::runtime::Undefined);
+
+        propagatedModel.enableCheckpointing(Duration::Minutes(10.0), 64000000);
+
+        EXPECT_TRUE(propagatedModel.isCheckpointingEnabled());
+        EXPECT_EQ(Duration::Minutes(10.0), propagatedModel.accessCheckpointStore().getSegmentDuration());
+        EXPECT_EQ(defaultInstant_, propagatedModel.accessCheckpointStore().accessEpoch());
+
+        const Array<State> states = propagatedModel.calculateStatesAt(instants);
+
+        validateStates(states);
+
+        // The 5 segments between the epoch and the first instant are propagated to derive its checkpoint
+        EXPECT_EQ(24, propagatedModel.accessCheckpointStore().getSegmentCount());
+        EXPECT_EQ(19, propagatedModel.accessCheckpointStore().getMissCount());
+
+        // Random-access queries over the same span are answered by interpolation
+        for (Size k = instants.getSize(); k-- > 0;)
+        {
+            EXPECT_EQ(states[k], propagatedModel.calculateStateAt(instants[k]));
+        }
+
+        EXPECT_EQ(19, propagatedModel.accessCheckpointStore().getMissCount());
+
+        propagatedModel.disableCheckpointing();
+
+        EXPECT_FALSE(propagatedModel.isCheckpointingEnabled());
+    }
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        propagatedModel.enableCheckpointing(Duration::Minutes(10.0), 1, CheckpointStore::EvictionPolicy::Farthest);
+
+        validateStates(propagatedModel.calculateStatesAt(instants));
+
+        EXPECT_EQ(1, propagatedModel.accessCheckpointStore().getSegmentCount());
+        EXPECT_EQ(
+            CheckpointStore::EvictionPolicy::Farthest, propagatedModel.accessCheckpointStore().getEvictionPolicy()
+        );
+    }
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        propagatedModel.enableCheckpointing(Duration::Minutes(10.0), 64000000);
+        propagatedModel.calculateStateAt(defaultInstant_ + Duration::Hours(1.0));
+
+        // Along with the 6 segments propagated from the epoch to derive its checkpoint
+        EXPECT_EQ(7, propagatedModel.accessCheckpointStore().getSegmentCount());
+
+        // Segments are dropped along with the cached states they were propagated from
+        propagatedModel.setCachedStateArray({defaultState_});
+
+        EXPECT_TRUE(propagatedModel.isCheckpointingEnabled());
+        EXPECT_EQ(0, propagatedModel.accessCheckpointStore().getSegmentCount());
+    }
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        propagatedModel.enableCheckpointing(Duration::Minutes(10.0), 64000000);
+
+        Array<Array<State>> stateArrays = Array<Array<State>>(4, Array<State>::Empty());
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (Size i = 0; i < stateArrays.getSize(); ++i)
+        {
+            threads.add(std::thread(
+                [&propagatedModel, &instants, &stateArrays, i]() -> void
+                {
+                    stateArrays[i] = propagatedModel.calculateStatesAt(instants);
+                }
+            ));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const Array<State>& states : stateArrays)
+        {
+            validateStates(states);
+        }
+
+        EXPECT_EQ(24, propagatedModel.accessCheckpointStore().getSegmentCount());
+    }
+
+    {
+        Propagated propagatedModel = {Propagator::Undefined(), defaultState_};
+
+        EXPECT_THROW(
+            propagatedModel.enableCheckpointing(Duration::Minutes(10.0), 64000000),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
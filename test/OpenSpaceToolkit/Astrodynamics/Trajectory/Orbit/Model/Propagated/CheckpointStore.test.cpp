@@ -0,0 +1,534 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <thread>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated/CheckpointStore.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::orbit::model::propagated::CheckpointStore;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore : public ::testing::Test
+{
+   protected:
+    // Circular orbit, so that the expected states are known exactly
+    State calculateExactStateAt(const Instant& anInstant) const
+    {
+        const double angle = angularRate_ * (anInstant - epoch_).inSeconds();
+
+        return {
+            anInstant,
+            Position::Meters({radius_ * std::cos(angle), radius_ * std::sin(angle), 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond(
+                {-radius_ * angularRate_ * std::sin(angle), radius_ * angularRate_ * std::cos(angle), 0.0},
+                Frame::GCRF()
+            ),
+        };
+    }
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Duration segmentDuration_ = Duration::Minutes(10.0);
+    const double radius_ = 7000000.0;
+    const double angularRate_ = 0.0010780;
+
+    Size propagationCount_ = 0;
+
+    const CheckpointStore::PropagationFunction propagationFunction_ =
+        [this](const Array<Instant>& anInstantArray, [[maybe_unused]] const State& aBoundaryState) -> Array<State>
+    {
+        ++propagationCount_;
+
+        return anInstantArray.map<State>(
+            [this](const Instant& anInstant) -> State
+            {
+                return this->calculateExactStateAt(anInstant);
+            }
+        );
+    };
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, Constructor)
+{
+    {
+        EXPECT_NO_THROW(CheckpointStore(epoch_, segmentDuration_, 1000000));
+        EXPECT_NO_THROW(
+            CheckpointStore(epoch_, segmentDuration_, 1000000, CheckpointStore::EvictionPolicy::Farthest, 8)
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            CheckpointStore(Instant::Undefined(), segmentDuration_, 1000000), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(CheckpointStore(epoch_, Duration::Undefined(), 1000000), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(CheckpointStore(epoch_, Duration::Zero(), 1000000), ostk::core::error::RuntimeError);
+        EXPECT_THROW(CheckpointStore(epoch_, segmentDuration_, 0), ostk::core::error::RuntimeError);
+        EXPECT_THROW(
+            CheckpointStore(epoch_, segmentDuration_, 1000000, CheckpointStore::EvictionPolicy::Farthest, 0),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            CheckpointStore(
+                epoch_, segmentDuration_, 1000000, CheckpointStore::EvictionPolicy::Farthest, 16, Real::Undefined()
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            CheckpointStore(epoch_, segmentDuration_, 1000000, CheckpointStore::EvictionPolicy::Farthest, 16, 0.0),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, Getters)
+{
+    {
+        const CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        EXPECT_EQ(epoch_, checkpointStore.accessEpoch());
+        EXPECT_EQ(segmentDuration_, checkpointStore.getSegmentDuration());
+        EXPECT_EQ(1000000, checkpointStore.getMemoryBudget());
+        EXPECT_EQ(CheckpointStore::EvictionPolicy::LeastRecentlyUsed, checkpointStore.getEvictionPolicy());
+        EXPECT_EQ(16, checkpointStore.getDegree());
+        EXPECT_EQ(1e-12, checkpointStore.getTolerance());
+        EXPECT_EQ(0, checkpointStore.getSegmentCount());
+        EXPECT_EQ(0, checkpointStore.getMemoryUsage());
+        EXPECT_EQ(0, checkpointStore.getHitCount());
+        EXPECT_EQ(0, checkpointStore.getMissCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, CalculateStateAt)
+{
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        // Off-node instants, on both sides of the epoch
+        const Array<Instant> instants =
+            Interval::Closed(epoch_ - Duration::Hours(1.0), epoch_ + Duration::Hours(1.0) - Duration::Seconds(1.0))
+                .generateGrid(Duration::Seconds(37.0));
+
+        for (const Instant& instant : instants)
+        {
+            const State state = checkpointStore.calculateStateAt(instant, propagationFunction_);
+            const State expectedState = this->calculateExactStateAt(instant);
+
+            EXPECT_EQ(instant, state.accessInstant());
+            EXPECT_LT(
+                (state.getPosition().getCoordinates() - expectedState.getPosition().getCoordinates()).norm(), 1e-6
+            );
+            EXPECT_LT(
+                (state.getVelocity().getCoordinates() - expectedState.getVelocity().getCoordinates()).norm(), 1e-9
+            );
+        }
+
+        // 12 segments over 2 hours, each propagated once. The 5 segments between the epoch and the first query are
+        // propagated to derive its checkpoint, and are then hits.
+        EXPECT_EQ(12, propagationCount_);
+        EXPECT_EQ(12, checkpointStore.getSegmentCount());
+        EXPECT_EQ(7, checkpointStore.getMissCount());
+        EXPECT_EQ(instants.getSize() - 7, checkpointStore.getHitCount());
+        EXPECT_LT(0, checkpointStore.getMemoryUsage());
+
+        // Repeated queries are answered from the stored segments
+        for (const Instant& instant : instants)
+        {
+            checkpointStore.calculateStateAt(instant, propagationFunction_);
+        }
+
+        EXPECT_EQ(12, propagationCount_);
+        EXPECT_EQ(7, checkpointStore.getMissCount());
+
+        checkpointStore.clear();
+
+        EXPECT_EQ(0, checkpointStore.getSegmentCount());
+        EXPECT_EQ(0, checkpointStore.getMemoryUsage());
+        EXPECT_EQ(0, checkpointStore.getMissCount());
+    }
+
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        // Nodes include the segment bounds, which are returned as propagated
+        const State state = checkpointStore.calculateStateAt(epoch_ + segmentDuration_, propagationFunction_);
+
+        EXPECT_EQ(this->calculateExactStateAt(epoch_ + segmentDuration_), state);
+    }
+
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        EXPECT_THROW(
+            checkpointStore.calculateStateAt(Instant::Undefined(), propagationFunction_),
+            ostk::core::error::runtime::Undefined
+        );
+
+        const CheckpointStore::PropagationFunction wrongPropagationFunction =
+            []([[maybe_unused]] const Array<Instant>& anInstantArray,
+               [[maybe_unused]] const State& aBoundaryState) -> Array<State>
+        {
+            return Array<State>::Empty();
+        };
+
+        EXPECT_THROW(
+            checkpointStore.calculateStateAt(epoch_, wrongPropagationFunction), ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, BoundaryState)
+{
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        Array<State> boundaryStates = Array<State>::Empty();
+
+        const CheckpointStore::PropagationFunction recordingPropagationFunction =
+            [this, &boundaryStates](const Array<Instant>& anInstantArray, const State& aBoundaryState) -> Array<State>
+        {
+            boundaryStates.add(aBoundaryState);
+
+            return propagationFunction_(anInstantArray, aBoundaryState);
+        };
+
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(5.0), recordingPropagationFunction);
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(15.0), recordingPropagationFunction);
+        checkpointStore.calculateStateAt(epoch_ - Duration::Minutes(5.0), recordingPropagationFunction);
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(35.0), recordingPropagationFunction);
+
+        // The segment at 25 minutes is propagated to derive the checkpoint of the one at 35 minutes
+        ASSERT_EQ(5, boundaryStates.getSize());
+
+        EXPECT_FALSE(boundaryStates[0].isDefined());
+        EXPECT_EQ(epoch_ + segmentDuration_, boundaryStates[1].accessInstant());
+        EXPECT_FALSE(boundaryStates[2].isDefined());
+        EXPECT_EQ(epoch_ + (segmentDuration_ * 2.0), boundaryStates[3].accessInstant());
+        EXPECT_EQ(epoch_ + (segmentDuration_ * 3.0), boundaryStates[4].accessInstant());
+    }
+
+    {
+        // Each propagation drifts by 1 m from its checkpoint, the states must not depend on the order of the queries
+        const CheckpointStore::PropagationFunction driftingPropagationFunction =
+            [this](const Array<Instant>& anInstantArray, const State& aBoundaryState) -> Array<State>
+        {
+            double drift = 0.0;
+
+            if (aBoundaryState.isDefined())
+            {
+                const State exactBoundaryState = this->calculateExactStateAt(aBoundaryState.accessInstant());
+
+                drift = aBoundaryState.getPosition().getCoordinates().x() -
+                        exactBoundaryState.getPosition().getCoordinates().x() + 1.0;
+            }
+
+            return anInstantArray.map<State>(
+                [this, drift](const Instant& anInstant) -> State
+                {
+                    const State state = this->calculateExactStateAt(anInstant);
+
+                    return {
+                        anInstant,
+                        Position::Meters(
+                            state.getPosition().getCoordinates() + Vector3d(drift, 0.0, 0.0), Frame::GCRF()
+                        ),
+                        state.getVelocity(),
+                    };
+                }
+            );
+        };
+
+        const Array<Instant> instants = {
+            epoch_ - Duration::Minutes(25.0),
+            epoch_ - Duration::Minutes(5.0),
+            epoch_ + Duration::Minutes(5.0),
+            epoch_ + Duration::Minutes(35.0),
+        };
+
+        CheckpointStore forwardCheckpointStore = {epoch_, segmentDuration_, 1000000};
+        CheckpointStore backwardCheckpointStore = {epoch_, segmentDuration_, 1000000};
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            forwardCheckpointStore.calculateStateAt(instants[i], driftingPropagationFunction);
+            backwardCheckpointStore.calculateStateAt(
+                instants[instants.getSize() - 1 - i], driftingPropagationFunction
+            );
+        }
+
+        for (const Instant& instant : instants)
+        {
+            EXPECT_EQ(
+                forwardCheckpointStore.calculateStateAt(instant, driftingPropagationFunction),
+                backwardCheckpointStore.calculateStateAt(instant, driftingPropagationFunction)
+            );
+        }
+
+        const State state =
+            backwardCheckpointStore.calculateStateAt(instants.accessLast(), driftingPropagationFunction);
+
+        EXPECT_NEAR(
+            3.0,
+            state.getPosition().getCoordinates().x() -
+                this->calculateExactStateAt(instants.accessLast()).getPosition().getCoordinates().x(),
+            1e-6
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, Subdivision)
+{
+    // About 5 revolutions per segment, which a single polynomial of degree 16 cannot interpolate
+    const double angularRate = 0.05;
+
+    Array<Size> nodeCounts = Array<Size>::Empty();
+
+    const CheckpointStore::PropagationFunction fastPropagationFunction =
+        [this, angularRate, &nodeCounts](
+            const Array<Instant>& anInstantArray, [[maybe_unused]] const State& aBoundaryState
+        ) -> Array<State>
+    {
+        nodeCounts.add(anInstantArray.getSize());
+
+        return anInstantArray.map<State>(
+            [this, angularRate](const Instant& anInstant) -> State
+            {
+                const double angle = angularRate * (anInstant - epoch_).inSeconds();
+
+                return {
+                    anInstant,
+                    Position::Meters({radius_ * std::cos(angle), radius_ * std::sin(angle), 0.0}, Frame::GCRF()),
+                    Velocity::MetersPerSecond(
+                        {-radius_ * angularRate * std::sin(angle), radius_ * angularRate * std::cos(angle), 0.0},
+                        Frame::GCRF()
+                    ),
+                };
+            }
+        );
+    };
+
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch_, epoch_ + segmentDuration_ - Duration::Seconds(1.0))
+                .generateGrid(Duration::Seconds(7.0));
+
+        for (const Instant& instant : instants)
+        {
+            const State state = checkpointStore.calculateStateAt(instant, fastPropagationFunction);
+            const double angle = angularRate * (instant - epoch_).inSeconds();
+
+            EXPECT_LT(
+                (state.getPosition().getCoordinates() -
+                 Vector3d(radius_ * std::cos(angle), radius_ * std::sin(angle), 0.0))
+                    .norm(),
+                1e-4
+            );
+        }
+
+        // The segment is split in halves until the error estimate meets the tolerance
+        ASSERT_EQ(4, nodeCounts.getSize());
+        EXPECT_EQ(17, nodeCounts[0]);
+        EXPECT_EQ(33, nodeCounts[1]);
+        EXPECT_EQ(65, nodeCounts[2]);
+        EXPECT_EQ(129, nodeCounts[3]);
+        EXPECT_EQ(1, checkpointStore.getSegmentCount());
+    }
+
+    {
+        nodeCounts = Array<Size>::Empty();
+
+        CheckpointStore checkpointStore = {
+            epoch_, segmentDuration_, 1000000, CheckpointStore::EvictionPolicy::LeastRecentlyUsed, 16, 1e-30
+        };
+
+        checkpointStore.calculateStateAt(epoch_, fastPropagationFunction);
+
+        // The subdivision stops at 64 pieces
+        EXPECT_EQ((64 * 16) + 1, nodeCounts.accessLast());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, Eviction)
+{
+    const Array<Instant> instants = {
+        epoch_ + Duration::Minutes(5.0),
+        epoch_ + Duration::Minutes(15.0),
+        epoch_ + Duration::Minutes(25.0),
+        epoch_ + Duration::Minutes(5.0),
+        epoch_ + Duration::Minutes(35.0),
+    };
+
+    // Measure the memory used by a single segment and the checkpoint on its outer bound
+    Size segmentMemoryUsage = 0;
+
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+        checkpointStore.calculateStateAt(epoch_, propagationFunction_);
+
+        segmentMemoryUsage = checkpointStore.getMemoryUsage();
+    }
+
+    // Room for the 4 checkpoints, which are never evicted, and for 3 of the 4 segments
+    const Size memoryBudget = (4 * segmentMemoryUsage) - 1;
+
+    {
+        CheckpointStore checkpointStore = {
+            epoch_, segmentDuration_, memoryBudget, CheckpointStore::EvictionPolicy::LeastRecentlyUsed
+        };
+
+        for (const Instant& instant : instants)
+        {
+            checkpointStore.calculateStateAt(instant, propagationFunction_);
+        }
+
+        EXPECT_EQ(3, checkpointStore.getSegmentCount());
+        EXPECT_LE(checkpointStore.getMemoryUsage(), checkpointStore.getMemoryBudget());
+
+        // The segment at 15 minutes was the least recently used one
+        const Size missCount = checkpointStore.getMissCount();
+
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(5.0), propagationFunction_);
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(25.0), propagationFunction_);
+        EXPECT_EQ(missCount, checkpointStore.getMissCount());
+
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(15.0), propagationFunction_);
+        EXPECT_EQ(missCount + 1, checkpointStore.getMissCount());
+    }
+
+    {
+        CheckpointStore checkpointStore = {
+            epoch_, segmentDuration_, memoryBudget, CheckpointStore::EvictionPolicy::Farthest
+        };
+
+        for (const Instant& instant : instants)
+        {
+            checkpointStore.calculateStateAt(instant, propagationFunction_);
+        }
+
+        EXPECT_EQ(3, checkpointStore.getSegmentCount());
+
+        // The segment at 5 minutes was the farthest from the one at 35 minutes
+        const Size missCount = checkpointStore.getMissCount();
+
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(15.0), propagationFunction_);
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(25.0), propagationFunction_);
+        EXPECT_EQ(missCount, checkpointStore.getMissCount());
+
+        checkpointStore.calculateStateAt(epoch_ + Duration::Minutes(5.0), propagationFunction_);
+        EXPECT_EQ(missCount + 1, checkpointStore.getMissCount());
+    }
+
+    {
+        // At least one segment is always kept
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1};
+
+        for (const Instant& instant : instants)
+        {
+            checkpointStore.calculateStateAt(instant, propagationFunction_);
+        }
+
+        EXPECT_EQ(1, checkpointStore.getSegmentCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, ConcurrentQueries)
+{
+    {
+        CheckpointStore checkpointStore = {epoch_, segmentDuration_, 1000000};
+
+        const CheckpointStore::PropagationFunction propagationFunction =
+            [this](const Array<Instant>& anInstantArray, [[maybe_unused]] const State& aBoundaryState) -> Array<State>
+        {
+            return anInstantArray.map<State>(
+                [this](const Instant& anInstant) -> State
+                {
+                    return this->calculateExactStateAt(anInstant);
+                }
+            );
+        };
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch_, epoch_ + Duration::Hours(2.0) - Duration::Seconds(1.0))
+                .generateGrid(Duration::Seconds(11.0));
+
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (Size i = 0; i < 4; ++i)
+        {
+            threads.add(std::thread(
+                [&checkpointStore, &instants, &propagationFunction]() -> void
+                {
+                    for (const Instant& instant : instants)
+                    {
+                        checkpointStore.calculateStateAt(instant, propagationFunction);
+                    }
+                }
+            ));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(12, checkpointStore.getSegmentCount());
+        EXPECT_EQ(4 * instants.getSize(), checkpointStore.getHitCount() + checkpointStore.getMissCount());
+
+        for (const Instant& instant : instants)
+        {
+            const State state = checkpointStore.calculateStateAt(instant, propagationFunction);
+
+            EXPECT_LT(
+                (state.getPosition().getCoordinates() -
+                 this->calculateExactStateAt(instant).getPosition().getCoordinates())
+                    .norm(),
+                1e-6
+            );
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated_CheckpointStore, StringFromEvictionPolicy)
+{
+    {
+        EXPECT_EQ(
+            "LeastRecentlyUsed",
+            CheckpointStore::StringFromEvictionPolicy(CheckpointStore::EvictionPolicy::LeastRecentlyUsed)
+        );
+        EXPECT_EQ("Farthest", CheckpointStore::StringFromEvictionPolicy(CheckpointStore::EvictionPolicy::Farthest));
+    }
+}
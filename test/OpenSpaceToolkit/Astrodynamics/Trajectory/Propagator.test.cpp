@@ -1,12 +1,15 @@
 /// Apache License 2.0
 
 #include <numeric>
+#include <thread>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
@@ -61,11 +64,13 @@
 #include <Global.test.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::container::Table;
 using ostk::core::container::Tuple;
 using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
@@ -752,6 +757,19 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Calcula
         EXPECT_FALSE(propagator.calculateStateToCondition(state, endInstant, failureCondition).conditionIsSatisfied);
     }
 
+    {
+        Array<State> observedStates = Array<State>::Empty();
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            propagator.calculateStateToCondition(state, endInstant, condition, observedStates);
+
+        EXPECT_EQ(propagator.calculateStateToCondition(state, endInstant, condition).state, conditionSolution.state);
+
+        ASSERT_FALSE(observedStates.isEmpty());
+        EXPECT_EQ(conditionSolution.state.accessInstant(), observedStates.accessLast().accessInstant());
+        EXPECT_TRUE(propagator.accessNumericalSolver().accessObservedStates().isEmpty());
+    }
+
     {
         const NumericalSolver::ConditionSolution conditionSolutionGCRF =
             propagator.calculateStateToCondition(state, endInstant, condition);
@@ -1201,6 +1219,541 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Calcula
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateEnsembleStatesAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < 7; ++i)
+    {
+        const double radius_m = 7000000.0 + 50000.0 * i;
+        const double speed_mps = std::sqrt(3.986004418e14 / radius_m);
+
+        states.add({
+            startInstant + Duration::Minutes(i),
+            Position::Meters({radius_m, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, speed_mps * std::cos(0.1 * i), speed_mps * std::sin(0.1 * i)}, gcrfSPtr_),
+        });
+    }
+
+    const Instant endInstant = startInstant + Duration::Hours(1.0);
+
+    const Array<Instant> instants = {
+        startInstant - Duration::Minutes(10.0),
+        startInstant + Duration::Minutes(30.0),
+        endInstant,
+    };
+
+    // Matches the single state propagation, for any thread count
+
+    for (const Size threadCount : {1, 3, 0})
+    {
+        {
+            const Array<State> ensembleStates =
+                defaultPropagator_.calculateEnsembleStateAt(states, endInstant, threadCount);
+
+            ASSERT_EQ(states.getSize(), ensembleStates.getSize());
+
+            for (Size i = 0; i < states.getSize(); ++i)
+            {
+                EXPECT_EQ(defaultPropagator_.calculateStateAt(states[i], endInstant), ensembleStates[i]);
+            }
+        }
+
+        {
+            const Array<Array<State>> ensembleStates =
+                defaultPropagator_.calculateEnsembleStatesAt(states, instants, threadCount);
+
+            ASSERT_EQ(states.getSize(), ensembleStates.getSize());
+
+            for (Size i = 0; i < states.getSize(); ++i)
+            {
+                const Array<State> expectedStates = defaultPropagator_.calculateStatesAt(states[i], instants);
+
+                ASSERT_EQ(expectedStates.getSize(), ensembleStates[i].getSize());
+
+                for (Size j = 0; j < expectedStates.getSize(); ++j)
+                {
+                    EXPECT_EQ(expectedStates[j], ensembleStates[i][j]);
+                }
+            }
+        }
+    }
+
+    // Per-member instants
+
+    {
+        Array<Array<Instant>> instantArrays = Array<Array<Instant>>::Empty();
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            instantArrays.add(
+                (i == 0) ? Array<Instant>::Empty() : Array<Instant> {endInstant + Duration::Minutes(i)}
+            );
+        }
+
+        const Array<Array<State>> ensembleStates =
+            defaultPropagator_.calculateEnsembleStatesAt(states, instantArrays, 4);
+
+        ASSERT_EQ(states.getSize(), ensembleStates.getSize());
+
+        EXPECT_TRUE(ensembleStates[0].isEmpty());
+
+        for (Size i = 1; i < states.getSize(); ++i)
+        {
+            ASSERT_EQ(1, ensembleStates[i].getSize());
+
+            EXPECT_EQ(defaultPropagator_.calculateStatesAt(states[i], instantArrays[i])[0], ensembleStates[i][0]);
+        }
+    }
+
+    // Empty ensemble
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateEnsembleStateAt(Array<State>::Empty(), endInstant).isEmpty());
+        EXPECT_TRUE(defaultPropagator_.calculateEnsembleStatesAt(Array<State>::Empty(), instants).isEmpty());
+    }
+
+    // Errors
+
+    {
+        EXPECT_THROW(
+            Propagator::Undefined().calculateEnsembleStateAt(states, endInstant), ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateEnsembleStateAt({states[0], State::Undefined()}, endInstant),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateEnsembleStatesAt(states, Array<Array<Instant>> {instants}),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateEnsembleStatesAt(states, Array<Instant> {endInstant, startInstant}),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStateAt_Concurrent)
+{
+    const Shared<Celestial> earthSPtr = std::make_shared<Earth>(Earth::FromModels(
+        std::make_shared<EarthGravitationalModel>(EarthGravitationalModel::Type::Spherical),
+        std::make_shared<EarthMagneticModel>(EarthMagneticModel::Type::Undefined),
+        std::make_shared<EarthAtmosphericModel>(EarthAtmosphericModel::Type::Exponential)
+    ));
+
+    const Array<Propagator> propagators = {
+        defaultPropagator_,
+        {
+            defaultNumericalSolver_,
+            {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(earthSPtr),
+                std::make_shared<AtmosphericDrag>(earthSPtr),
+            },
+        },
+    };
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    VectorXd coordinates(9);
+    coordinates << 6928000.0, 0.0, 0.0, 0.0, 7585.0, 0.0, 100.0, 1.0, 2.2;
+
+    const State state = {
+        startInstant,
+        coordinates,
+        gcrfSPtr_,
+        {
+            CartesianPosition::Default(),
+            CartesianVelocity::Default(),
+            CoordinateSubset::Mass(),
+            CoordinateSubset::SurfaceArea(),
+            CoordinateSubset::DragCoefficient(),
+        },
+    };
+
+    const Size callCount = 16;
+    const Size threadCount = 4;
+
+    Array<Instant> endInstants = Array<Instant>::Empty();
+
+    for (Index k = 0; k < callCount; ++k)
+    {
+        endInstants.add(startInstant + Duration::Minutes((k % 2 == 0) ? (5.0 * k + 5.0) : (-5.0 * k)));
+    }
+
+    for (const Propagator& propagator : propagators)
+    {
+        const Array<State> expectedStates = endInstants.map<State>(
+            [&propagator, &state](const Instant& anEndInstant) -> State
+            {
+                return propagator.calculateStateAt(state, anEndInstant);
+            }
+        );
+
+        Array<State> states = Array<State>(callCount, State::Undefined());
+        Array<Array<State>> statesArrays = Array<Array<State>>(callCount, Array<State>::Empty());
+        Array<Instant> observedEndInstants = Array<Instant>(callCount, Instant::Undefined());
+
+        // Each thread shares the same propagator, and interleaves single and multiple instant calls
+        std::vector<std::thread> threads;
+
+        for (Index threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]() -> void
+                {
+                    for (Index k = threadIndex; k < callCount; k += threadCount)
+                    {
+                        Array<State> observedStates = Array<State>::Empty();
+
+                        states[k] = propagator.calculateStateAt(state, endInstants[k], observedStates);
+
+                        observedEndInstants[k] = observedStates.accessLast().accessInstant();
+
+                        statesArrays[k] = propagator.calculateStatesAt(state, {endInstants[k]});
+                    }
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Index k = 0; k < callCount; ++k)
+        {
+            EXPECT_EQ(expectedStates[k], states[k]);
+            EXPECT_EQ(endInstants[k], observedEndInstants[k]);
+
+            ASSERT_EQ(1, statesArrays[k].getSize());
+            EXPECT_EQ(expectedStates[k], statesArrays[k][0]);
+        }
+
+        // The propagator keeps no state from any of the calls
+        EXPECT_TRUE(propagator.accessNumericalSolver().accessObservedStates().isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateBatchStatesAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < 7; ++i)
+    {
+        const double radius_m = 7000000.0 + 50000.0 * i;
+        const double speed_mps = std::sqrt(3.986004418e14 / radius_m);
+
+        states.add({
+            startInstant,
+            Position::Meters({radius_m, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, speed_mps * std::cos(0.1 * i), speed_mps * std::sin(0.1 * i)}, gcrfSPtr_),
+        });
+    }
+
+    // members may be expressed in different frames
+    states[3] = states[3].inFrame(Frame::ITRF());
+
+    const Instant endInstant = startInstant + Duration::Hours(1.0);
+
+    const Array<Instant> instants = {
+        startInstant - Duration::Minutes(10.0),
+        startInstant,
+        startInstant + Duration::Minutes(30.0),
+        endInstant,
+    };
+
+    // Matches the single state propagation, within the integration tolerances
+
+    {
+        const Array<State> batchStates = defaultPropagator_.calculateBatchStateAt(states, endInstant);
+
+        ASSERT_EQ(states.getSize(), batchStates.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            const State expectedState = defaultPropagator_.calculateStateAt(states[i], endInstant);
+
+            EXPECT_EQ(expectedState.getInstant(), batchStates[i].getInstant());
+            EXPECT_EQ(expectedState.accessFrame(), batchStates[i].accessFrame());
+            EXPECT_TRUE(expectedState.getCoordinates().isApprox(batchStates[i].getCoordinates(), 1e-9));
+        }
+    }
+
+    {
+        const Array<Array<State>> batchStates = defaultPropagator_.calculateBatchStatesAt(states, instants);
+
+        ASSERT_EQ(states.getSize(), batchStates.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            const Array<State> expectedStates = defaultPropagator_.calculateStatesAt(states[i], instants);
+
+            ASSERT_EQ(expectedStates.getSize(), batchStates[i].getSize());
+
+            for (Size j = 0; j < expectedStates.getSize(); ++j)
+            {
+                EXPECT_EQ(expectedStates[j].getInstant(), batchStates[i][j].getInstant());
+                EXPECT_TRUE(expectedStates[j].getCoordinates().isApprox(batchStates[i][j].getCoordinates(), 1e-9));
+            }
+        }
+    }
+
+    // Fixed step: all members take the same steps as when propagated alone
+
+    {
+        const Propagator propagator = {
+            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 10.0), defaultDynamics_
+        };
+
+        const Array<State> batchStates = propagator.calculateBatchStateAt(states, endInstant);
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_TRUE(propagator.calculateStateAt(states[i], endInstant)
+                            .getCoordinates()
+                            .isApprox(batchStates[i].getCoordinates(), 1e-12));
+        }
+    }
+
+    // Empty batch and instants
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateBatchStateAt(Array<State>::Empty(), endInstant).isEmpty());
+
+        const Array<Array<State>> batchStates =
+            defaultPropagator_.calculateBatchStatesAt(states, Array<Instant>::Empty());
+
+        ASSERT_EQ(states.getSize(), batchStates.getSize());
+
+        for (const Array<State>& memberStates : batchStates)
+        {
+            EXPECT_TRUE(memberStates.isEmpty());
+        }
+    }
+
+    // Errors
+
+    {
+        EXPECT_THROW(
+            Propagator::Undefined().calculateBatchStateAt(states, endInstant), ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateBatchStateAt({states[0], State::Undefined()}, endInstant),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateBatchStateAt(
+                {states[0], defaultPropagator_.calculateStateAt(states[1], endInstant)}, endInstant
+            ),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateBatchStatesAt(states, Array<Instant> {endInstant, startInstant}),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAndStateTransitionMatricesAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const Array<Instant> instants = {
+        startInstant - Duration::Minutes(10.0),
+        startInstant,
+        startInstant + Duration::Minutes(30.0),
+        startInstant + Duration::Hours(1.0),
+    };
+
+    {
+        EXPECT_TRUE(defaultPropagator_.canCalculateStateTransitionMatrices());
+
+        const auto [states, stateTransitionMatrices] =
+            defaultPropagator_.calculateStatesAndStateTransitionMatricesAt(state, instants);
+
+        ASSERT_EQ(instants.getSize(), states.getSize());
+        ASSERT_EQ(instants.getSize(), stateTransitionMatrices.getSize());
+
+        // States match the regular propagation, within the integration tolerances
+        const Array<State> expectedStates = defaultPropagator_.calculateStatesAt(state, instants);
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], states[i].accessInstant());
+            EXPECT_TRUE(states[i].getCoordinates().isApprox(expectedStates[i].getCoordinates(), 1e-10));
+        }
+
+        EXPECT_TRUE(stateTransitionMatrices[1].isApprox(MatrixXd::Identity(6, 6), 1e-12));
+
+        // State transition matrices match central differences of the propagated states
+        const Array<double> steps = {1.0, 1.0, 1.0, 1e-3, 1e-3, 1e-3};
+
+        for (Size j = 0; j < 6; ++j)
+        {
+            VectorXd coordinatesForward = state.getCoordinates();
+            VectorXd coordinatesBackward = state.getCoordinates();
+            coordinatesForward[j] += steps[j];
+            coordinatesBackward[j] -= steps[j];
+
+            const Array<State> statesForward = defaultPropagator_.calculateStatesAt(
+                {startInstant, coordinatesForward, gcrfSPtr_, state.getCoordinateSubsets()}, instants
+            );
+            const Array<State> statesBackward = defaultPropagator_.calculateStatesAt(
+                {startInstant, coordinatesBackward, gcrfSPtr_, state.getCoordinateSubsets()}, instants
+            );
+
+            for (Size i = 0; i < instants.getSize(); ++i)
+            {
+                const VectorXd expectedColumn =
+                    (statesForward[i].getCoordinates() - statesBackward[i].getCoordinates()) / (2.0 * steps[j]);
+
+                EXPECT_TRUE(stateTransitionMatrices[i].col(j).isApprox(expectedColumn, 1e-5)) << i << " " << j;
+            }
+        }
+    }
+
+    {
+        EXPECT_FALSE(defaultPropagatorWithManeuvers_.canCalculateStateTransitionMatrices());
+
+        EXPECT_THROW(
+            defaultPropagatorWithManeuvers_.calculateStatesAndStateTransitionMatricesAt(state, instants),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_FALSE(Propagator::Undefined().canCalculateStateTransitionMatrices());
+
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStatesAndStateTransitionMatricesAt(state, instants),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStateAt_MultiRate)
+{
+    const Shared<Celestial> earthSPtr = std::make_shared<Celestial>(Earth::WGS84());
+
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+    const Instant endInstant = state.accessInstant() + Duration::Hours(3.0);
+
+    const Propagator propagator = {
+        defaultRKD5_, {std::make_shared<PositionDerivative>(), std::make_shared<CentralBodyGravity>(earthSPtr)}
+    };
+
+    const Shared<Dynamics> multiRateCentralBodyGravitySPtr = std::make_shared<CentralBodyGravity>(earthSPtr);
+    multiRateCentralBodyGravitySPtr->setMultiRateEvaluation(Duration::Minutes(2.0), 1.0e-9);
+
+    const Propagator multiRatePropagator = {
+        defaultRKD5_, {std::make_shared<PositionDerivative>(), multiRateCentralBodyGravitySPtr}
+    };
+
+    {
+        const State endState = propagator.calculateStateAt(state, endInstant);
+        const State multiRateEndState = multiRatePropagator.calculateStateAt(state, endInstant);
+
+        EXPECT_LT(
+            (endState.getPosition().getCoordinates() - multiRateEndState.getPosition().getCoordinates()).norm(), 1.0
+        );
+        EXPECT_LT(
+            (endState.getVelocity().getCoordinates() - multiRateEndState.getVelocity().getCoordinates()).norm(),
+            1.0e-3
+        );
+    }
+
+    // Each propagation starts from a fresh cache, so that repeated calls agree
+    {
+        EXPECT_EQ(
+            multiRatePropagator.calculateStateAt(state, endInstant),
+            multiRatePropagator.calculateStateAt(state, endInstant)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Profile)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const Shared<NumericalSolver::Profile> profileSPtr = std::make_shared<NumericalSolver::Profile>();
+
+    NumericalSolver numericalSolver = defaultRKD5_;
+    numericalSolver.setProfile(profileSPtr);
+
+    const Propagator propagator = {numericalSolver, defaultDynamics_};
+
+    {
+        propagator.calculateStateAt(state, state.accessInstant() + Duration::Minutes(10.0));
+
+        EXPECT_EQ(1, profileSPtr->getSolveCount());
+        EXPECT_GT(profileSPtr->getEvaluationCount(), 0);
+        EXPECT_GT(profileSPtr->getAcceptedStepCount(), 0);
+    }
+
+    {
+        propagator.calculateStateToCondition(
+            state,
+            state.accessInstant() + Duration::Minutes(10.0),
+            InstantCondition(
+                InstantCondition::Criterion::StrictlyPositive, state.accessInstant() + Duration::Minutes(5.0)
+            )
+        );
+
+        EXPECT_EQ(2, profileSPtr->getSolveCount());
+    }
+
+    // Each dynamics is timed under its name
+    {
+        const Array<Pair<String, Duration>> contributionDurations = profileSPtr->getContributionDurations();
+
+        ASSERT_EQ(defaultDynamics_.getSize(), contributionDurations.getSize());
+
+        Duration contributionDuration = Duration::Zero();
+
+        for (Index i = 0; i < defaultDynamics_.getSize(); ++i)
+        {
+            EXPECT_EQ(defaultDynamics_[i]->getName(), contributionDurations[i].first);
+            EXPECT_GT(contributionDurations[i].second, Duration::Zero());
+
+            contributionDuration += contributionDurations[i].second;
+        }
+
+        EXPECT_LE(contributionDuration, profileSPtr->getEvaluationDuration());
+        EXPECT_LE(profileSPtr->getEvaluationDuration(), profileSPtr->getDuration());
+    }
+
+    // Profiling is off by default
+    {
+        EXPECT_EQ(nullptr, defaultPropagator_.accessNumericalSolver().getProfile());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Default)
 {
     {
@@ -1,14 +1,20 @@
 /// Apache License 2.0
 
+#include <numeric>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/InstantCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/LogicalCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
@@ -21,9 +27,11 @@
 
 using ostk::core::container::Array;
 using ostk::core::container::Tuple;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::VectorXd;
@@ -32,6 +40,7 @@ using ostk::physics::coordinate::Frame;
 using ostk::physics::time::DateTime;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 
 using ostk::astrodynamics::EventCondition;
@@ -151,6 +160,21 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Getters)
         solver.setMaxStepSize(10.0);
         EXPECT_EQ(solver.getMaxStepSize(), 10.0);
     }
+
+    {
+        EXPECT_FALSE(defaultRKD5_.isDenseOutputEnabled());
+        EXPECT_THROW(NumericalSolver::Undefined().isDenseOutputEnabled(), ostk::core::error::runtime::Undefined);
+
+        NumericalSolver solver = defaultRKD5_;
+        solver.setDenseOutputEnabled(true);
+        EXPECT_TRUE(solver.isDenseOutputEnabled());
+        solver.setDenseOutputEnabled(false);
+        EXPECT_FALSE(solver.isDenseOutputEnabled());
+
+        NumericalSolver anotherSolver = defaultRK54_;
+        EXPECT_THROW(anotherSolver.setDenseOutputEnabled(true), ostk::core::error::RuntimeError);
+        EXPECT_NO_THROW(anotherSolver.setDenseOutputEnabled(false));
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Accessors)
@@ -222,6 +246,632 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Integrat
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Array_DenseOutput)
+{
+    for (const NumericalSolver::StepperType &stepperType :
+         {NumericalSolver::StepperType::RungeKuttaDopri5, NumericalSolver::StepperType::BulirschStoer})
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            stepperType,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+        numericalSolver.setDenseOutputEnabled(true);
+
+        // Unsorted instants, on both sides of the initial state
+        {
+            const Array<Instant> instants = {
+                defaultState_.accessInstant() + Duration::Seconds(4.0),
+                defaultState_.accessInstant() + Duration::Seconds(-7.0),
+                defaultState_.accessInstant(),
+                defaultState_.accessInstant() + Duration::Seconds(1.0),
+                defaultState_.accessInstant() + Duration::Seconds(10.0),
+                defaultState_.accessInstant() + Duration::Seconds(-1.0),
+                defaultState_.accessInstant() + Duration::Seconds(4.0),
+            };
+
+            const Array<State> propagatedStates =
+                numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_);
+
+            ASSERT_EQ(instants.getSize(), propagatedStates.getSize());
+
+            for (Index i = 0; i < instants.getSize(); ++i)
+            {
+                EXPECT_EQ(instants[i], propagatedStates[i].accessInstant());
+            }
+
+            validatePropagatedStates(instants, propagatedStates, 1e-9);
+        }
+
+        // The output cadence does not change the number of steps
+        {
+            Size evaluationCount = 0;
+
+            const NumericalSolver::SystemOfEquationsWrapper countingSystemOfEquations =
+                [this, &evaluationCount](
+                    const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t
+                ) -> void
+            {
+                ++evaluationCount;
+                systemOfEquations_(x, dxdt, t);
+            };
+
+            Array<Size> evaluationCounts = Array<Size>::Empty();
+
+            for (const Duration &cadence : {Duration::Seconds(2.5), Duration::Milliseconds(10.0)})
+            {
+                const Array<Instant> instants = Interval::Closed(
+                                                    defaultState_.accessInstant() + cadence,
+                                                    defaultState_.accessInstant() + defaultDuration_
+                )
+                                                    .generateGrid(cadence);
+
+                evaluationCount = 0;
+
+                const Array<State> propagatedStates =
+                    numericalSolver.integrateTime(defaultState_, instants, countingSystemOfEquations);
+
+                validatePropagatedStates(instants, propagatedStates, 1e-9);
+
+                evaluationCounts.add(evaluationCount);
+            }
+
+            EXPECT_EQ(evaluationCounts[0], evaluationCounts[1]);
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_FixedSize)
+{
+    // Three uncoupled harmonic oscillators, with position and velocity laid out as in a cartesian state
+    VectorXd stateVector(6);
+    stateVector << 0.0, 0.0, 0.0, 1.0, 1.0, 1.0;
+
+    const State state = {
+        defaultStartInstant_,
+        stateVector,
+        gcrfSPtr_,
+        std::make_shared<CoordinateBroker>(CoordinateBroker({std::make_shared<CoordinateSubset>("Test", 6)})),
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        [](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double) -> void
+    {
+        dxdt.head<3>() = x.tail<3>();
+        dxdt.tail<3>() = -x.head<3>();
+    };
+
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6> fixedSizeSystemOfEquations =
+        [](const NumericalSolver::FixedSizeStateVector<6> &x,
+           NumericalSolver::FixedSizeStateVector<6> &dxdt,
+           const double) -> void
+    {
+        dxdt.head<3>() = x.tail<3>();
+        dxdt.tail<3>() = -x.head<3>();
+    };
+
+    const Array<Instant> instants = {
+        defaultStartInstant_ + Duration::Seconds(4.0),
+        defaultStartInstant_ + Duration::Seconds(-7.0),
+        defaultStartInstant_,
+        defaultStartInstant_ + Duration::Seconds(1.0),
+        defaultStartInstant_ + Duration::Seconds(10.0),
+        defaultStartInstant_ + Duration::Seconds(-1.0),
+    };
+
+    const auto validateState = [this](const State &aState, const double &aTolerance) -> void
+    {
+        const double time = (aState.accessInstant() - defaultStartInstant_).inSeconds();
+
+        for (Index i = 0; i < 3; ++i)
+        {
+            EXPECT_GT(aTolerance, std::abs(aState.accessCoordinates()[i] - std::sin(time)));
+            EXPECT_GT(aTolerance, std::abs(aState.accessCoordinates()[i + 3] - std::cos(time)));
+        }
+    };
+
+    // The fixed size path matches the generic path, for every stepper it specializes
+    {
+        for (const NumericalSolver::StepperType &stepperType : {
+                 NumericalSolver::StepperType::RungeKutta4,
+                 NumericalSolver::StepperType::RungeKuttaCashKarp54,
+                 NumericalSolver::StepperType::RungeKuttaFehlberg78,
+                 NumericalSolver::StepperType::RungeKuttaDopri5,
+                 NumericalSolver::StepperType::BulirschStoer,
+             })
+        {
+            NumericalSolver numericalSolver = {
+                NumericalSolver::LogType::NoLog,
+                stepperType,
+                1e-3,
+                1.0e-12,
+                1.0e-12,
+            };
+
+            // Unsorted instants, on both sides of the initial state
+            {
+                const Array<State> fixedSizeStates =
+                    numericalSolver.integrateTime<6>(state, instants, fixedSizeSystemOfEquations);
+
+                ASSERT_EQ(instants.getSize(), fixedSizeStates.getSize());
+
+                for (Index i = 0; i < instants.getSize(); ++i)
+                {
+                    EXPECT_EQ(instants[i], fixedSizeStates[i].accessInstant());
+                    EXPECT_EQ(state.accessCoordinateBroker(), fixedSizeStates[i].accessCoordinateBroker());
+
+                    validateState(fixedSizeStates[i], 1e-8);
+                }
+            }
+
+            for (const double &direction : {1.0, -1.0})
+            {
+                const Array<Instant> sortedInstants = {
+                    defaultStartInstant_ + Duration::Seconds(direction * 1.0),
+                    defaultStartInstant_ + Duration::Seconds(direction * 4.0),
+                    defaultStartInstant_ + Duration::Seconds(direction * 10.0),
+                };
+
+                const Array<State> states = numericalSolver.integrateTime(state, sortedInstants, systemOfEquations);
+                const Array<State> fixedSizeStates =
+                    numericalSolver.integrateTime<6>(state, sortedInstants, fixedSizeSystemOfEquations);
+
+                ASSERT_EQ(states.getSize(), fixedSizeStates.getSize());
+
+                for (Index i = 0; i < states.getSize(); ++i)
+                {
+                    EXPECT_GT(
+                        1e-9,
+                        (fixedSizeStates[i].accessCoordinates() - states[i].accessCoordinates()).cwiseAbs().maxCoeff()
+                    );
+                }
+            }
+
+            for (const Instant &endInstant : {instants[4], instants[1]})
+            {
+                const State fixedSizeState =
+                    numericalSolver.integrateTime<6>(state, endInstant, fixedSizeSystemOfEquations);
+
+                EXPECT_EQ(endInstant, fixedSizeState.accessInstant());
+                EXPECT_FALSE(numericalSolver.getObservedStates().isEmpty());
+
+                validateState(fixedSizeState, 1e-8);
+            }
+        }
+    }
+
+    // Modes without a fixed size specialization fall back to the generic path
+    {
+        NumericalSolver numericalSolver = defaultRKD5_;
+        numericalSolver.setDenseOutputEnabled(true);
+
+        const Array<State> fixedSizeStates =
+            numericalSolver.integrateTime<6>(state, instants, fixedSizeSystemOfEquations);
+
+        ASSERT_EQ(instants.getSize(), fixedSizeStates.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], fixedSizeStates[i].accessInstant());
+
+            validateState(fixedSizeStates[i], 1e-9);
+        }
+    }
+
+    // The state size must match the fixed size
+    {
+        EXPECT_THROW(
+            defaultRK54_.integrateTime<6>(defaultState_, instants, fixedSizeSystemOfEquations),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            defaultRK54_.integrateTime<6>(defaultState_, instants[0], fixedSizeSystemOfEquations),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_GaussJackson)
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        0.05,
+        1.0e-13,
+        1.0e-13,
+    };
+
+    EXPECT_FALSE(numericalSolver.isGaussJacksonEnabled());
+
+    numericalSolver.setGaussJacksonEnabled(true);
+
+    EXPECT_TRUE(numericalSolver.isGaussJacksonEnabled());
+
+    // Cannot be combined with dense output
+    {
+        NumericalSolver denseOutputNumericalSolver = defaultRKD5_;
+        denseOutputNumericalSolver.setDenseOutputEnabled(true);
+
+        EXPECT_THROW(denseOutputNumericalSolver.setGaussJacksonEnabled(true), ostk::core::error::RuntimeError);
+        EXPECT_THROW(
+            NumericalSolver(numericalSolver).setDenseOutputEnabled(true), ostk::core::error::RuntimeError
+        );
+    }
+
+    // First order system, integrated with the summed Adams method
+    {
+        const Array<Instant> instants = {
+            defaultState_.accessInstant() + Duration::Seconds(4.0),
+            defaultState_.accessInstant() + Duration::Seconds(-7.03),
+            defaultState_.accessInstant(),
+            defaultState_.accessInstant() + Duration::Seconds(0.12),
+            defaultState_.accessInstant() + Duration::Seconds(10.0),
+            defaultState_.accessInstant() + Duration::Seconds(-0.01),
+        };
+
+        const Array<State> propagatedStates =
+            numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_);
+
+        ASSERT_EQ(instants.getSize(), propagatedStates.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], propagatedStates[i].accessInstant());
+        }
+
+        validatePropagatedStates(instants, propagatedStates, 1e-9);
+
+        const State propagatedState =
+            numericalSolver.integrateTime(defaultState_, defaultStartInstant_ + defaultDuration_, systemOfEquations_);
+
+        validatePropagatedStates({propagatedState.accessInstant()}, {propagatedState}, 1e-9);
+    }
+
+    // Second order system (positions followed by velocities), integrated with the Gauss-Jackson method
+    {
+        const Shared<CoordinateBroker> coordinateBroker = std::make_shared<CoordinateBroker>(CoordinateBroker({
+            std::make_shared<CoordinateSubset>("Position", 3),
+            std::make_shared<CoordinateSubset>("Velocity", 3),
+        }));
+
+        VectorXd stateVector(6);
+        stateVector << 1.0, 0.0, 0.5, 0.0, 1.0, 0.0;
+
+        const State state = {defaultStartInstant_, stateVector, gcrfSPtr_, coordinateBroker};
+
+        Size evaluationCount = 0;
+
+        const NumericalSolver::SystemOfEquationsWrapper oscillatorSystemOfEquations =
+            [&evaluationCount](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double)
+            -> void
+        {
+            ++evaluationCount;
+            dxdt.head(3) = x.segment(3, 3);
+            dxdt.tail(3) = -x.head(3);
+        };
+
+        const auto expectedStateVector = [&stateVector](const double &aTime) -> VectorXd
+        {
+            VectorXd expected(6);
+            expected.head(3) = stateVector.head(3) * std::cos(aTime) + stateVector.tail(3) * std::sin(aTime);
+            expected.tail(3) = -stateVector.head(3) * std::sin(aTime) + stateVector.tail(3) * std::cos(aTime);
+            return expected;
+        };
+
+        for (const double &duration : {100.0, -100.0, 37.01})
+        {
+            evaluationCount = 0;
+
+            const State propagatedState = numericalSolver.integrateTime(
+                state, defaultStartInstant_ + Duration::Seconds(duration), oscillatorSystemOfEquations
+            );
+
+            EXPECT_GT(
+                1e-9, (propagatedState.accessCoordinates() - expectedStateVector(duration)).cwiseAbs().maxCoeff()
+            ) << duration;
+
+            // Two evaluations per fixed step, once started
+            EXPECT_LT(evaluationCount, 2 * std::abs(duration) / 0.05 + 500);
+        }
+
+        // Conditional integration stops at the condition
+        const Instant targetInstant = defaultStartInstant_ + Duration::Seconds(12.34);
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+            state,
+            defaultStartInstant_ + Duration::Seconds(20.0),
+            oscillatorSystemOfEquations,
+            InstantCondition(RealCondition::Criterion::AnyCrossing, targetInstant)
+        );
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_LT(std::abs((conditionSolution.state.accessInstant() - targetInstant).inSeconds()), 1e-6);
+
+        const double solutionTime = (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds();
+
+        EXPECT_TRUE(conditionSolution.state.accessCoordinates().isApprox(expectedStateVector(solutionTime), 1e-8));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_SundmanTransformation)
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    {
+        EXPECT_FALSE(numericalSolver.getSundmanExponent().isDefined());
+        EXPECT_THROW(NumericalSolver::Undefined().getSundmanExponent(), ostk::core::error::runtime::Undefined);
+
+        EXPECT_THROW(numericalSolver.setSundmanExponent(0.0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(numericalSolver.setSundmanExponent(-1.0), ostk::core::error::runtime::Wrong);
+
+        NumericalSolver adamsBashforthMoultonNumericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::AdamsBashforthMoulton8,
+            5.0,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        EXPECT_THROW(adamsBashforthMoultonNumericalSolver.setSundmanExponent(1.5), ostk::core::error::RuntimeError);
+    }
+
+    // Cannot be combined with dense output or Gauss-Jackson integration
+    {
+        NumericalSolver denseOutputNumericalSolver = defaultRKD5_;
+        denseOutputNumericalSolver.setDenseOutputEnabled(true);
+
+        EXPECT_THROW(denseOutputNumericalSolver.setSundmanExponent(1.5), ostk::core::error::RuntimeError);
+
+        NumericalSolver gaussJacksonNumericalSolver = numericalSolver;
+        gaussJacksonNumericalSolver.setGaussJacksonEnabled(true);
+
+        EXPECT_THROW(gaussJacksonNumericalSolver.setSundmanExponent(1.5), ostk::core::error::RuntimeError);
+
+        NumericalSolver sundmanNumericalSolver = defaultRKD5_;
+        sundmanNumericalSolver.setSundmanExponent(1.5);
+
+        EXPECT_THROW(
+            NumericalSolver(sundmanNumericalSolver).setDenseOutputEnabled(true), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            NumericalSolver(sundmanNumericalSolver).setGaussJacksonEnabled(true), ostk::core::error::RuntimeError
+        );
+    }
+
+    NumericalSolver sundmanNumericalSolver = numericalSolver;
+    sundmanNumericalSolver.setSundmanExponent(1.5);
+
+    EXPECT_EQ(sundmanNumericalSolver.getSundmanExponent(), 1.5);
+
+    // The first three coordinates must be a position
+    {
+        EXPECT_THROW(
+            sundmanNumericalSolver.integrateTime(
+                defaultState_, defaultStartInstant_ + defaultDuration_, systemOfEquations_
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Highly eccentric Keplerian orbit
+    {
+        const double gravitationalParameter = 3.986004418e14;
+        const double periapsisRadius = 6678.0e3;
+        const double eccentricity = 0.74;
+        const double semiMajorAxis = periapsisRadius / (1.0 - eccentricity);
+        const double period = 2.0 * M_PI * std::sqrt(std::pow(semiMajorAxis, 3) / gravitationalParameter);
+        const double periapsisVelocity = std::sqrt(gravitationalParameter * (1.0 + eccentricity) / periapsisRadius);
+
+        const Shared<CoordinateBroker> coordinateBroker = std::make_shared<CoordinateBroker>(CoordinateBroker({
+            std::make_shared<CoordinateSubset>("Position", 3),
+            std::make_shared<CoordinateSubset>("Velocity", 3),
+        }));
+
+        VectorXd stateVector(6);
+        stateVector << periapsisRadius, 0.0, 0.0, 0.0, periapsisVelocity, 0.0;
+
+        const State state = {defaultStartInstant_, stateVector, gcrfSPtr_, coordinateBroker};
+
+        Size evaluationCount = 0;
+
+        const NumericalSolver::SystemOfEquationsWrapper keplerSystemOfEquations =
+            [&evaluationCount, gravitationalParameter](
+                const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double
+            ) -> void
+        {
+            ++evaluationCount;
+            dxdt.head(3) = x.segment(3, 3);
+            dxdt.tail(3) = -gravitationalParameter / std::pow(x.head(3).norm(), 3) * x.head(3);
+        };
+
+        const Array<Instant> instants = {
+            defaultStartInstant_ + Duration::Seconds(3.0 * period),
+            defaultStartInstant_ + Duration::Seconds(-0.5 * period),
+            defaultStartInstant_ + Duration::Seconds(0.5 * period),
+        };
+
+        const Array<State> propagatedStates =
+            sundmanNumericalSolver.integrateTime(state, instants, keplerSystemOfEquations);
+
+        ASSERT_EQ(instants.getSize(), propagatedStates.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], propagatedStates[i].accessInstant());
+        }
+
+        VectorXd apoapsisPosition(3);
+        apoapsisPosition << -semiMajorAxis * (1.0 + eccentricity), 0.0, 0.0;
+
+        EXPECT_GT(0.1, (propagatedStates[0].accessCoordinates().head(3) - stateVector.head(3)).norm());
+        EXPECT_GT(0.1, (propagatedStates[1].accessCoordinates().head(3) - apoapsisPosition).norm());
+        EXPECT_GT(0.1, (propagatedStates[2].accessCoordinates().head(3) - apoapsisPosition).norm());
+
+        // Fewer evaluations than integrating in time, for a similar accuracy
+        const Instant endInstant = defaultStartInstant_ + Duration::Seconds(3.0 * period);
+
+        evaluationCount = 0;
+        const State sundmanState = sundmanNumericalSolver.integrateTime(state, endInstant, keplerSystemOfEquations);
+        const Size sundmanEvaluationCount = evaluationCount;
+
+        evaluationCount = 0;
+        const State referenceState = numericalSolver.integrateTime(state, endInstant, keplerSystemOfEquations);
+        const Size referenceEvaluationCount = evaluationCount;
+
+        EXPECT_EQ(endInstant, sundmanState.accessInstant());
+        EXPECT_GT(0.1, (sundmanState.accessCoordinates().head(3) - stateVector.head(3)).norm());
+        EXPECT_GT(0.1, (referenceState.accessCoordinates().head(3) - stateVector.head(3)).norm());
+        EXPECT_LT(sundmanEvaluationCount, referenceEvaluationCount);
+
+        // Conditional integration stops at the condition
+        const Instant targetInstant = defaultStartInstant_ + Duration::Seconds(1.3 * period);
+
+        const NumericalSolver::ConditionSolution conditionSolution = sundmanNumericalSolver.integrateTime(
+            state,
+            endInstant,
+            keplerSystemOfEquations,
+            InstantCondition(RealCondition::Criterion::AnyCrossing, targetInstant)
+        );
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_LT(std::abs((conditionSolution.state.accessInstant() - targetInstant).inSeconds()), 1e-6);
+
+        const State expectedState =
+            numericalSolver.integrateTime(state, conditionSolution.state.accessInstant(), keplerSystemOfEquations);
+
+        EXPECT_GT(
+            0.1, (conditionSolution.state.accessCoordinates() - expectedState.accessCoordinates()).head(3).norm()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Profile)
+{
+    {
+        EXPECT_EQ(nullptr, defaultRKD5_.getProfile());
+        EXPECT_THROW(NumericalSolver::Undefined().getProfile(), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        // A large initial step, rejected until the tolerances are met
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            100.0,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        const Shared<NumericalSolver::Profile> profileSPtr = std::make_shared<NumericalSolver::Profile>();
+        numericalSolver.setProfile(profileSPtr);
+
+        EXPECT_EQ(profileSPtr, numericalSolver.getProfile());
+
+        const Instant targetInstant = defaultStartInstant_ + Duration::Seconds(5.0);
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+            defaultState_,
+            defaultStartInstant_ + defaultDuration_,
+            systemOfEquations_,
+            InstantCondition(RealCondition::Criterion::AnyCrossing, targetInstant)
+        );
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+
+        EXPECT_EQ(1, profileSPtr->getSolveCount());
+        EXPECT_GT(profileSPtr->getRejectedStepCount(), 0);
+        EXPECT_EQ(profileSPtr->getAcceptedStepCount(), profileSPtr->getStepSizes().getSize());
+        EXPECT_GT(profileSPtr->getEvaluationCount(), profileSPtr->getAcceptedStepCount());
+        EXPECT_GE(profileSPtr->getDuration(), profileSPtr->getEvaluationDuration());
+        EXPECT_TRUE(profileSPtr->getContributionDurations().isEmpty());
+
+        // The accepted steps span the integration up to the step crossing the condition
+        const Real stepSizeSum =
+            std::accumulate(profileSPtr->getStepSizes().begin(), profileSPtr->getStepSizes().end(), Real(0.0));
+
+        EXPECT_GE(stepSizeSum, 5.0);
+        EXPECT_LE(stepSizeSum, defaultDuration_.inSeconds() + 1e-9);
+
+        // Copies record into the same profile
+        const Size evaluationCount = profileSPtr->getEvaluationCount();
+
+        NumericalSolver numericalSolverCopy = numericalSolver;
+        numericalSolverCopy.integrateTime(defaultState_, defaultStartInstant_ + defaultDuration_, systemOfEquations_);
+
+        EXPECT_EQ(2, profileSPtr->getSolveCount());
+        EXPECT_GT(profileSPtr->getEvaluationCount(), evaluationCount);
+
+        // Contribution timers are kept on reset
+        profileSPtr->accessContributionTimer("Test")->add(std::chrono::nanoseconds(1000));
+
+        EXPECT_EQ(1, profileSPtr->getContributionDurations().getSize());
+        EXPECT_EQ("Test", profileSPtr->getContributionDurations()[0].first);
+        EXPECT_EQ(Duration::Microseconds(1.0), profileSPtr->getContributionDurations()[0].second);
+
+        profileSPtr->reset();
+
+        EXPECT_EQ(0, profileSPtr->getSolveCount());
+        EXPECT_EQ(0, profileSPtr->getEvaluationCount());
+        EXPECT_EQ(0, profileSPtr->getAcceptedStepCount());
+        EXPECT_EQ(0, profileSPtr->getRejectedStepCount());
+        EXPECT_TRUE(profileSPtr->getStepSizes().isEmpty());
+        EXPECT_EQ(1, profileSPtr->getContributionDurations().getSize());
+        EXPECT_EQ(Duration::Zero(), profileSPtr->getContributionDurations()[0].second);
+
+        // Profiling can be disabled
+        numericalSolver.setProfile(nullptr);
+        numericalSolver.integrateTime(defaultState_, defaultStartInstant_ + defaultDuration_, systemOfEquations_);
+
+        EXPECT_EQ(nullptr, numericalSolver.getProfile());
+        EXPECT_EQ(0, profileSPtr->getSolveCount());
+    }
+
+    // Steps are recorded when integrating to several instants, with and without dense output
+    {
+        const Array<Instant> instants = {
+            defaultStartInstant_ - Duration::Seconds(4.0),
+            defaultStartInstant_ + Duration::Seconds(2.0),
+            defaultStartInstant_ + defaultDuration_,
+        };
+
+        for (const bool denseOutputIsEnabled : {false, true})
+        {
+            NumericalSolver numericalSolver = defaultRKD5_;
+            numericalSolver.setDenseOutputEnabled(denseOutputIsEnabled);
+
+            const Shared<NumericalSolver::Profile> profileSPtr = std::make_shared<NumericalSolver::Profile>();
+            numericalSolver.setProfile(profileSPtr);
+
+            const Array<State> states = numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_);
+
+            EXPECT_EQ(instants.getSize(), states.getSize());
+            EXPECT_EQ(1, profileSPtr->getSolveCount());
+            EXPECT_GT(profileSPtr->getAcceptedStepCount(), 0);
+            EXPECT_EQ(profileSPtr->getAcceptedStepCount(), profileSPtr->getStepSizes().getSize());
+
+            // The accepted steps span both directions of the integration
+            Real forwardStepSizeSum = 0.0;
+            Real backwardStepSizeSum = 0.0;
+
+            for (const Real& stepSize : profileSPtr->getStepSizes())
+            {
+                (stepSize > 0.0 ? forwardStepSizeSum : backwardStepSizeSum) += stepSize;
+            }
+
+            EXPECT_NEAR(defaultDuration_.inSeconds(), forwardStepSizeSum, 1e-9);
+            EXPECT_NEAR(-4.0, backwardStepSizeSum, 1e-9);
+        }
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Conditions)
 {
     const State state = getStateVector(defaultStartInstant_);
@@ -0,0 +1,91 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Utility/FastAtan2.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+
+using ostk::astrodynamics::utility::FastAtan2;
+
+class OpenSpaceToolkit_Astrodynamics_Utility_FastAtan2 : public ::testing::Test
+{
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Utility_FastAtan2, FastAtan2)
+{
+    // All quadrants, over twelve orders of magnitude
+    {
+        const Index angleCount = 720;
+        const Index radiusCount = 25;
+
+        Eigen::ArrayXd y(angleCount * radiusCount);
+        Eigen::ArrayXd x(angleCount * radiusCount);
+
+        for (Index i = 0; i < angleCount; ++i)
+        {
+            const double angle_rad = -M_PI + 2.0 * M_PI * (i + 0.5) / angleCount;
+
+            for (Index j = 0; j < radiusCount; ++j)
+            {
+                const double radius = std::pow(10.0, -6.0 + 0.5 * j);
+
+                y(i * radiusCount + j) = radius * std::sin(angle_rad);
+                x(i * radiusCount + j) = radius * std::cos(angle_rad);
+            }
+        }
+
+        const Eigen::ArrayXd angles_rad = FastAtan2(y, x);
+
+        for (Eigen::Index k = 0; k < angles_rad.size(); ++k)
+        {
+            EXPECT_NEAR(std::atan2(y(k), x(k)), angles_rad(k), 1e-15) << y(k) << " " << x(k);
+        }
+    }
+
+    // Axes, diagonals and the octant boundary of the reduction
+    {
+        const double t = std::tan(0.66);
+
+        const Eigen::ArrayXd y = (Eigen::ArrayXd(12) << 0.0, 1.0, 0.0, -1.0, 1.0, 1.0, -1.0, -1.0, t, 1.0, -t, 1.0)
+                                     .finished();
+        const Eigen::ArrayXd x = (Eigen::ArrayXd(12) << 1.0, 0.0, -1.0, 0.0, 1.0, -1.0, 1.0, -1.0, 1.0, t, -1.0, -t)
+                                     .finished();
+
+        const Eigen::ArrayXd angles_rad = FastAtan2(y, x);
+
+        for (Eigen::Index k = 0; k < angles_rad.size(); ++k)
+        {
+            EXPECT_NEAR(std::atan2(y(k), x(k)), angles_rad(k), 1e-15) << y(k) << " " << x(k);
+        }
+    }
+
+    // Signed zeros and infinities are handled as by std::atan2
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        const Eigen::ArrayXd values = (Eigen::ArrayXd(6) << 0.0, -0.0, 1.0, -1.0, infinity, -infinity).finished();
+
+        for (Eigen::Index i = 0; i < values.size(); ++i)
+        {
+            for (Eigen::Index j = 0; j < values.size(); ++j)
+            {
+                const double expectedAngle_rad = std::atan2(values(i), values(j));
+                const double angle_rad =
+                    FastAtan2(Eigen::ArrayXd::Constant(1, values(i)), Eigen::ArrayXd::Constant(1, values(j)))(0);
+
+                EXPECT_EQ(expectedAngle_rad, angle_rad) << values(i) << " " << values(j);
+                EXPECT_EQ(std::signbit(expectedAngle_rad), std::signbit(angle_rad)) << values(i) << " " << values(j);
+            }
+        }
+    }
+
+    // Empty input
+    {
+        EXPECT_EQ(0, FastAtan2(Eigen::ArrayXd(0), Eigen::ArrayXd(0)).size());
+    }
+}
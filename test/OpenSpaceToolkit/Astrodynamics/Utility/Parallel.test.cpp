@@ -0,0 +1,86 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <OpenSpaceToolkit/Astrodynamics/Utility/Parallel.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::astrodynamics::utility::ParallelFor;
+
+class OpenSpaceToolkit_Astrodynamics_Utility_Parallel : public ::testing::Test
+{
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Utility_Parallel, ParallelFor)
+{
+    for (const Size threadCount : {0, 1, 4, 64})
+    {
+        const Size count = 20;
+
+        std::vector<std::atomic<Size>> invocationCounts(count);
+        std::atomic<bool> hasInvalidWorkerIndex {false};
+
+        ParallelFor(
+            count,
+            threadCount,
+            [&](const Index& anIndex, const Index& aWorkerIndex) -> void
+            {
+                ++invocationCounts[anIndex];
+
+                if (aWorkerIndex >= std::max<Size>(1, std::min(count, threadCount)))
+                {
+                    hasInvalidWorkerIndex.store(true);
+                }
+            }
+        );
+
+        for (const std::atomic<Size>& invocationCount : invocationCounts)
+        {
+            EXPECT_EQ(1, invocationCount.load());
+        }
+
+        EXPECT_FALSE(hasInvalidWorkerIndex.load());
+    }
+
+    {
+        Size invocationCount = 0;
+
+        ParallelFor(
+            0,
+            4,
+            [&invocationCount](const Index&, const Index&) -> void
+            {
+                ++invocationCount;
+            }
+        );
+
+        EXPECT_EQ(0, invocationCount);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Utility_Parallel, ParallelFor_Exception)
+{
+    for (const Size threadCount : {1, 4})
+    {
+        EXPECT_THROW(
+            ParallelFor(
+                100,
+                threadCount,
+                [](const Index& anIndex, const Index&) -> void
+                {
+                    if (anIndex == 10)
+                    {
+                        throw std::runtime_error("Failure");
+                    }
+                }
+            ),
+            std::runtime_error
+        );
+    }
+}